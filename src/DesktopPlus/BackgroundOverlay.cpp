@@ -2,6 +2,7 @@
 
 #include "ConfigManager.h"
 #include "OutputManager.h"
+#include "OverlayStateMirror.h"
 
 BackgroundOverlay::BackgroundOverlay() : m_OvrlHandle(vr::k_ulOverlayHandleInvalid)
 {
@@ -12,7 +13,7 @@ BackgroundOverlay::~BackgroundOverlay()
 {
     if ((m_OvrlHandle != vr::k_ulOverlayHandleInvalid) && (vr::VROverlay() != nullptr))
     {
-        vr::VROverlay()->DestroyOverlay(m_OvrlHandle);
+        OverlayStateMirror::Get().DestroyOverlay(m_OvrlHandle);
     }
 }
 
@@ -24,7 +25,7 @@ void BackgroundOverlay::Update()
         //Don't keep the overlay around if it's absolutely not needed (which is the case most of the time)
         if (m_OvrlHandle != vr::k_ulOverlayHandleInvalid)
         {
-            vr::VROverlay()->DestroyOverlay(m_OvrlHandle);
+            OverlayStateMirror::Get().DestroyOverlay(m_OvrlHandle);
             m_OvrlHandle = vr::k_ulOverlayHandleInvalid;
         }
     }
@@ -33,7 +34,7 @@ void BackgroundOverlay::Update()
         //Create overlay if it doesn't exist yet
         if (m_OvrlHandle == vr::k_ulOverlayHandleInvalid)
         {
-            vr::EVROverlayError ovrl_error = vr::VROverlay()->CreateOverlay("elvissteinjr.DesktopPlusBackground", "Desktop+ Background", &m_OvrlHandle);
+            vr::EVROverlayError ovrl_error = OverlayStateMirror::Get().CreateOverlay("elvissteinjr.DesktopPlusBackground", "Desktop+ Background", &m_OvrlHandle);
 
             if (ovrl_error != vr::VROverlayError_None)
                 return;
@@ -48,13 +49,13 @@ void BackgroundOverlay::Update()
             //Panorama overlays are weird in that they essentially poke a hole into the rendering in the area they'd cover normally
             //By doing this we ensure to always cover the field of view. The actual panorama is rendered in front of scene content, but positioned behind all overlays
             //IVRCompositor::FadeToColor() can achieve a similar effect, but the colors are washed out. Impossible to achieve full black with it.
-            vr::VROverlay()->SetOverlayFlag(m_OvrlHandle, vr::VROverlayFlags_Panorama, true);
-            vr::VROverlay()->SetOverlayWidthInMeters(m_OvrlHandle, 100.0f);
+            OverlayStateMirror::Get().SetOverlayFlag(m_OvrlHandle, vr::VROverlayFlags_Panorama, true);
+            OverlayStateMirror::Get().SetOverlayWidthInMeters(m_OvrlHandle, 100.0f);
 
             Matrix4 transform;
             transform.setTranslation({0.0f, 0.0f, -10.0f});
             vr::HmdMatrix34_t transform_openvr = transform.toOpenVR34();
-            vr::VROverlay()->SetOverlayTransformTrackedDeviceRelative(m_OvrlHandle, vr::k_unTrackedDeviceIndex_Hmd, &transform_openvr);
+            OverlayStateMirror::Get().SetOverlayTransformTrackedDeviceRelative(m_OvrlHandle, vr::k_unTrackedDeviceIndex_Hmd, &transform_openvr);
         }
 
         bool display_overlay = true; //ui_bgcolor_dispmode_always
@@ -73,17 +74,17 @@ void BackgroundOverlay::Update()
             float b = ((rgba & 0x00FF0000) >> 16) / 255.0f;
             float a = ((rgba & 0xFF000000) >> 24) / 255.0f;
 
-            vr::VROverlay()->SetOverlayColor(m_OvrlHandle, r, g, b);
-            vr::VROverlay()->SetOverlayAlpha(m_OvrlHandle, a);
+            OverlayStateMirror::Get().SetOverlayColor(m_OvrlHandle, r, g, b);
+            OverlayStateMirror::Get().SetOverlayAlpha(m_OvrlHandle, a);
 
-            if (!vr::VROverlay()->IsOverlayVisible(m_OvrlHandle))
+            if (!OverlayStateMirror::Get().IsOverlayVisible(m_OvrlHandle))
             {
-                vr::VROverlay()->ShowOverlay(m_OvrlHandle);
+                OverlayStateMirror::Get().ShowOverlay(m_OvrlHandle);
             }
         }
-        else if (vr::VROverlay()->IsOverlayVisible(m_OvrlHandle))
+        else if (OverlayStateMirror::Get().IsOverlayVisible(m_OvrlHandle))
         {
-            vr::VROverlay()->HideOverlay(m_OvrlHandle);
+            OverlayStateMirror::Get().HideOverlay(m_OvrlHandle);
         }
     }
 }
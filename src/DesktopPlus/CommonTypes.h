@@ -76,6 +76,16 @@ struct DDPPtrInfo
     bool CursorShapeChanged = false;
 };
 
+//
+// Region of interest for the capture threads, made up from the crop rects of all visible Desktop Duplication overlays
+//
+struct DDPRegionOfInterest
+{
+    std::vector<DPRect> Rects;
+    UINT Generation = 0;                        //Incremented on every change. 0 means not set yet and nothing gets culled
+    std::vector<DPRect> SkippedRects;           //Areas culled by any capture thread, checked and reset when the region changes
+};
+
 //
 // Structure that holds D3D resources not directly tied to any one thread
 //
@@ -104,6 +114,9 @@ struct DDPThreadData
     HANDLE PauseDuplicationEvent  = nullptr;
     HANDLE ResumeDuplicationEvent = nullptr;
 
+    // Signaled while the output is visible in any overlay, thread parks itself while it's not. Owned by DDPThreadManager
+    HANDLE OutputDemandEvent = nullptr;
+
     // Used by WinProc to signal to threads to exit
     HANDLE TerminateThreadsEvent = nullptr;
 
@@ -114,6 +127,7 @@ struct DDPThreadData
     DDPPtrInfo* PtrInfo = nullptr;                  //Should only be called when shared surface mutex has be aquired, always points to DDPThreadManager::m_PtrInfo
     DDPDxResources DxRes;
     DPRect* DirtyRegionTotal = nullptr;             //Should only be called when shared surface mutex has be aquired, always points to DDPThreadManager::m_DirtyRegionTotal
+    DDPRegionOfInterest* RegionOfInterest = nullptr;//Should only be called when shared surface mutex has be aquired, always points to DDPThreadManager::m_RegionOfInterest
     bool WMRIgnoreVScreens = false;
 };
 
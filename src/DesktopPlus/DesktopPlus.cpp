@@ -23,6 +23,9 @@
 #include "InterprocessMessaging.h"
 #include "ElevatedMode.h"
 #include "Logging.h"
+#include "TrackedPoseSnapshot.h"
+#include "OverlayStateMirror.h"
+#include "StartupTimer.h"
 
 // Below are lists of errors expect from Dxgi API calls when a transition event like mode change, PnpStop, PnpStart
 // desktop switch, TDR or session disconnect/reconnect. In all these cases we want the application to clean up the threads that process
@@ -272,13 +275,20 @@ int WINAPI WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance, _
         return 0;
     }
 
+    StartupTimer startup_timer;
+
     //Init WinRT DLL
+    startup_timer.BeginStage("winrt_init");
     DPWinRT_Init();
     DPLog_DPWinRT_SupportInfo();
     LOG_F(INFO, "Loaded WinRT library");
 
     //Init BrowserClientAPI (this doesn't start the browser process, only checks for presence)
+    startup_timer.BeginStage("browser_api_init");
     DPBrowserAPIClient::Get().Init();
+    startup_timer.EndStage();
+
+    LOG_F(INFO, "Startup report: %s", startup_timer.GetReportJSON().c_str());
 
     //Allow IPC messages even when elevated
     IPCManager::Get().DisableUIPForRegisteredMessages(WindowHandle);
@@ -316,6 +326,10 @@ int WINAPI WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance, _
 
     while (WM_QUIT != msg.message)
     {
+        //Tracking state is sampled again on first use in this iteration, same for state of overlays not owned by this process
+        TrackedPoseSnapshot::Get().Invalidate();
+        OverlayStateMirror::Get().BeginFrame();
+
         if ((!FirstTime) && (PeekMessage(&msg, nullptr, 0, 0, PM_REMOVE)))  //Wait for init before processing messages
         {
             // Process window messages
@@ -463,7 +477,10 @@ int WINAPI WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance, _
                 SkipFrame = false;
             }
 
-            RetUpdate = OutMgr.Update(ThreadMgr.GetPointerInfo(), ThreadMgr.GetDirtyRegionTotal(), IsNewFrame, SkipFrame);
+            //Park or resume individual capture threads depending on which outputs are visible in any overlay
+            ThreadMgr.UpdateOutputDemand(OutMgr.GetDesktopDuplicationDemandRects());
+
+            RetUpdate = OutMgr.Update(ThreadMgr.GetPointerInfo(), ThreadMgr.GetDirtyRegionTotal(), ThreadMgr.GetRegionOfInterest(), IsNewFrame, SkipFrame);
 
             //Map return value to DUPL_RETRUN Ret
             switch (RetUpdate)
@@ -482,6 +499,9 @@ int WINAPI WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance, _
             OutMgr.UpdatePerformanceStates();
         }
 
+        //Check browser launch state and send browser commands queued during this iteration (mouse moves, scrolling etc. are coalesced until here)
+        DPBrowserAPIClient::Get().Update();
+
         // Check if for errors
         if (Ret != ddp_dupl_return_success)
         {
@@ -600,6 +620,7 @@ LRESULT CALLBACK WndProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
             if (OutputManager::Get())
             {
                 LOG_F(INFO, "WM_DISPLAYCHANGE recieved. Re-enumerating outputs...");
+                OutputManager::Get()->InvalidateDisplayTopology();
                 OutputManager::Get()->EnumerateOutputs();
             }
             break;
@@ -793,6 +814,7 @@ DWORD WINAPI CaptureThreadEntry(_In_ void* Param)
 
     // Main duplication loop
     bool WaitToProcessCurrentFrame = false;
+    bool ForceFullFrame = false;
     DDPFrameData CurrentData;
 
     while (WaitForSingleObjectEx(TData.TerminateThreadsEvent, 0, FALSE) == WAIT_TIMEOUT)
@@ -817,6 +839,37 @@ DWORD WINAPI CaptureThreadEntry(_In_ void* Param)
             }
         }
 
+        //Park thread while no visible overlay is showing any part of this output
+        if ( (!WaitToProcessCurrentFrame) && (WaitForSingleObjectEx(TData.OutputDemandEvent, 0, FALSE) == WAIT_TIMEOUT) )
+        {
+            //Pointer updates aren't received while parked, so hide the cursor if this output was the last to report it instead of keeping a stale position around
+            hr = KeyMutex->AcquireSync(0, 1000);
+            if (hr == S_OK)
+            {
+                if ( (TData.PtrInfo->WhoUpdatedPositionLast == TData.Output) && (TData.PtrInfo->Visible) )
+                {
+                    TData.PtrInfo->Visible = false;
+                    ::QueryPerformanceCounter(&TData.PtrInfo->LastTimeStamp);   //Same clock as DXGI's pointer timestamps. Makes the change visible and keeps later updates newer
+                }
+
+                KeyMutex->ReleaseSync(1);
+                SetEvent(TData.NewFrameProcessedEvent);
+            }
+            else if (FAILED(hr))
+            {
+                Ret = ProcessFailure(TData.DxRes.Device.Get(), L"Unexpected error acquiring keyed mutex", L"Desktop+ Error", hr, SystemTransitionsExpectedErrors);
+                break;
+            }
+
+            //Wait until the output is needed again or the thread is terminated
+            HANDLE WaitHandles[] = {TData.OutputDemandEvent, TData.TerminateThreadsEvent};
+            WaitForMultipleObjectsEx(ARRAYSIZE(WaitHandles), WaitHandles, FALSE, INFINITE, FALSE);
+
+            //Shared surface content of this output is outdated now, so copy all of it with the next frame
+            ForceFullFrame = true;
+            continue;
+        }
+
         if (!WaitToProcessCurrentFrame)
         {
             // Get new frame from desktop duplication
@@ -867,7 +920,7 @@ DWORD WINAPI CaptureThreadEntry(_In_ void* Param)
         }
 
         // Process new frame
-        Ret = DispMgr.ProcessFrame(CurrentData, SharedSurf.Get(), TData.OffsetX, TData.OffsetY, DesktopDesc, *TData.DirtyRegionTotal);
+        Ret = DispMgr.ProcessFrame(CurrentData, SharedSurf.Get(), TData.OffsetX, TData.OffsetY, DesktopDesc, *TData.DirtyRegionTotal, *TData.RegionOfInterest, ForceFullFrame);
         if (Ret != ddp_dupl_return_success)
         {
             DuplMgr.DoneWithFrame();
@@ -876,6 +929,8 @@ DWORD WINAPI CaptureThreadEntry(_In_ void* Param)
             break;
         }
 
+        ForceFullFrame = false;
+
         // Release acquired keyed mutex
         hr = KeyMutex->ReleaseSync(1);
         if (FAILED(hr))
@@ -0,0 +1,144 @@
+#include "DirtyRectCopyPlanner.h"
+
+static long long DirtyRectCopyPlannerGetArea(const DPRect& rect)
+{
+    return (long long)rect.GetWidth() * rect.GetHeight();
+}
+
+static bool DirtyRectCopyPlannerIsEmpty(const DPRect& rect)
+{
+    return ( (rect.Min.x >= rect.Max.x) || (rect.Min.y >= rect.Max.y) );
+}
+
+void DirtyRectCopyPlanner::MergeDirtyRects()
+{
+    //Greedy pairwise merging until nothing changes anymore. Merged rects can enable further merges, which the next pass picks up
+    //Pass count is limited as this runs every frame and a slightly worse result is better than stalling on a huge number of rects
+    bool merged_any = true;
+
+    for (int pass = 0; (merged_any) && (pass < 4); ++pass)
+    {
+        merged_any = false;
+
+        for (size_t i = 0; i < m_DirtyRects.size(); ++i)
+        {
+            for (size_t j = i + 1; j < m_DirtyRects.size();)
+            {
+                DPRect rect_merged = m_DirtyRects[i];
+                rect_merged.Add(m_DirtyRects[j]);
+
+                //Merged rect costs a single draw, so it's worth it if it's not much more area than both rects (including their overdraw)
+                if (DirtyRectCopyPlannerGetArea(rect_merged) <= DirtyRectCopyPlannerGetArea(m_DirtyRects[i]) + DirtyRectCopyPlannerGetArea(m_DirtyRects[j]) + s_DrawOverheadPixels)
+                {
+                    m_DirtyRects[i] = rect_merged;
+                    m_DirtyRects[j] = m_DirtyRects.back();
+                    m_DirtyRects.pop_back();
+                    merged_any = true;
+                }
+                else
+                {
+                    ++j;
+                }
+            }
+        }
+    }
+}
+
+bool DirtyRectCopyPlanner::IsCoveredByDirtyRects(const DPRect& rect)
+{
+    //Subtract every dirty rect from the rect and see if anything is left
+    m_CoverageScratch.clear();
+    m_CoverageScratch.push_back(rect);
+
+    for (const DPRect& dirty_rect : m_DirtyRects)
+    {
+        const size_t piece_count = m_CoverageScratch.size();
+
+        for (size_t i = 0; i < piece_count; ++i)
+        {
+            const DPRect piece = m_CoverageScratch[i];
+
+            if (!piece.Overlaps(dirty_rect))
+            {
+                m_CoverageScratch.push_back(piece);
+                continue;
+            }
+
+            //Up to 4 pieces: full-width bands above and below, side pieces in between
+            if (piece.Min.y < dirty_rect.Min.y)
+                m_CoverageScratch.emplace_back(piece.Min.x, piece.Min.y, piece.Max.x, dirty_rect.Min.y);
+            if (piece.Max.y > dirty_rect.Max.y)
+                m_CoverageScratch.emplace_back(piece.Min.x, dirty_rect.Max.y, piece.Max.x, piece.Max.y);
+
+            const int middle_top    = (piece.Min.y > dirty_rect.Min.y) ? piece.Min.y : dirty_rect.Min.y;
+            const int middle_bottom = (piece.Max.y < dirty_rect.Max.y) ? piece.Max.y : dirty_rect.Max.y;
+
+            if (piece.Min.x < dirty_rect.Min.x)
+                m_CoverageScratch.emplace_back(piece.Min.x, middle_top, dirty_rect.Min.x, middle_bottom);
+            if (piece.Max.x > dirty_rect.Max.x)
+                m_CoverageScratch.emplace_back(dirty_rect.Max.x, middle_top, piece.Max.x, middle_bottom);
+        }
+
+        m_CoverageScratch.erase(m_CoverageScratch.begin(), m_CoverageScratch.begin() + piece_count);
+
+        if (m_CoverageScratch.empty())
+            return true;
+    }
+
+    return false;
+}
+
+void DirtyRectCopyPlanner::Plan(const CopyPlannerMove* moves, unsigned int move_count, const DPRect* dirty_rects, unsigned int dirty_count)
+{
+    m_MoveIDs.clear();
+    m_DirtyRects.clear();
+
+    for (unsigned int i = 0; i < dirty_count; ++i)
+    {
+        if (!DirtyRectCopyPlannerIsEmpty(dirty_rects[i]))
+        {
+            m_DirtyRects.push_back(dirty_rects[i]);
+        }
+    }
+
+    MergeDirtyRects();
+
+    for (unsigned int i = 0; i < move_count; ++i)
+    {
+        const CopyPlannerMove& move = moves[i];
+
+        if (DirtyRectCopyPlannerIsEmpty(move.DestRect))
+            continue;
+
+        //Moves are applied before dirty rects, so a move fully overwritten by them is wasted work
+        //Unless a later move reads from its destination, in which case its result is still needed in-between
+        if (IsCoveredByDirtyRects(move.DestRect))
+        {
+            bool is_read_later = false;
+
+            for (unsigned int j = i + 1; j < move_count; ++j)
+            {
+                if (moves[j].SourceRect.Overlaps(move.DestRect))
+                {
+                    is_read_later = true;
+                    break;
+                }
+            }
+
+            if (!is_read_later)
+                continue;
+        }
+
+        m_MoveIDs.push_back(i);
+    }
+}
+
+const std::vector<unsigned int>& DirtyRectCopyPlanner::GetMoveIDs() const
+{
+    return m_MoveIDs;
+}
+
+const std::vector<DPRect>& DirtyRectCopyPlanner::GetDirtyRects() const
+{
+    return m_DirtyRects;
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <vector>
+#include "DPRect.h"
+
+struct CopyPlannerMove
+{
+    DPRect SourceRect;
+    DPRect DestRect;
+};
+
+//Plans the copies for a single frame's move and dirty rects before DDPDisplayManager touches the GPU
+//All rects are in the unrotated frame coordinates reported by Desktop Duplication, rotation is left to the caller since it doesn't change overlaps.
+//Moves are kept in order as later ones may read what earlier ones wrote, but moves that would be fully overwritten by dirty rects are dropped.
+//Dirty area covered by moves is kept, since dirty rects are applied after the moves and hold content that changed after moving.
+//Overlapping or close dirty rects are merged if drawing their bounding rect is estimated to be cheaper than drawing them separately.
+//Merged rects may cover more than what was reported dirty, which is fine as the frame always contains the full current content.
+class DirtyRectCopyPlanner
+{
+    private:
+        std::vector<unsigned int> m_MoveIDs;
+        std::vector<DPRect> m_DirtyRects;
+        std::vector<DPRect> m_CoverageScratch;
+
+        void MergeDirtyRects();
+        bool IsCoveredByDirtyRects(const DPRect& rect);
+
+    public:
+        //Pixels a separate draw is considered to cost on top of its area
+        static const long long s_DrawOverheadPixels = 32 * 32;
+
+        void Plan(const CopyPlannerMove* moves, unsigned int move_count, const DPRect* dirty_rects, unsigned int dirty_count);
+
+        const std::vector<unsigned int>& GetMoveIDs() const;           //Indices into the moves passed to Plan(), to be done in order, before the dirty rects
+        const std::vector<DPRect>& GetDirtyRects() const;
+};
@@ -0,0 +1,231 @@
+#include "DirtyRectFilter.h"
+
+#include <algorithm>
+#include <climits>
+
+static long long DirtyRectFilterGetArea(const DPRect& rect)
+{
+    return (long long)rect.GetWidth() * rect.GetHeight();
+}
+
+void DirtyRectFilter::AddRectBounded(std::vector<DPRect>& rects, const DPRect& rect)
+{
+    if ( (rect.GetWidth() <= 0) || (rect.GetHeight() <= 0) )
+        return;
+
+    for (const DPRect& existing_rect : rects)
+    {
+        if (existing_rect.Contains(rect))
+            return;
+    }
+
+    for (auto it = rects.begin(); it != rects.end();)
+    {
+        (rect.Contains(*it)) ? it = rects.erase(it) : ++it;
+    }
+
+    if (rects.size() < s_SkippedRectsMax)
+    {
+        rects.push_back(rect);
+        return;
+    }
+
+    //List is full, merge into the rect growing the least
+    size_t merge_id = 0;
+    long long merge_growth = LLONG_MAX;
+
+    for (size_t i = 0; i < rects.size(); ++i)
+    {
+        DPRect merged = rects[i];
+        merged.Add(rect);
+
+        const long long growth = DirtyRectFilterGetArea(merged) - DirtyRectFilterGetArea(rects[i]);
+        if (growth < merge_growth)
+        {
+            merge_id = i;
+            merge_growth = growth;
+        }
+    }
+
+    rects[merge_id].Add(rect);
+}
+
+void DirtyRectFilter::SubtractRect(const DPRect& rect, const DPRect& cut, std::vector<DPRect>& out_rects)
+{
+    if (!rect.Overlaps(cut))
+    {
+        out_rects.push_back(rect);
+        return;
+    }
+
+    const int top    = std::max(rect.Min.y, cut.Min.y);
+    const int bottom = std::min(rect.Max.y, cut.Max.y);
+
+    if (rect.Min.y < top)
+        out_rects.emplace_back(rect.Min.x, rect.Min.y, rect.Max.x, top);
+    if (bottom < rect.Max.y)
+        out_rects.emplace_back(rect.Min.x, bottom, rect.Max.x, rect.Max.y);
+    if (rect.Min.x < cut.Min.x)
+        out_rects.emplace_back(rect.Min.x, top, cut.Min.x, bottom);
+    if (cut.Max.x < rect.Max.x)
+        out_rects.emplace_back(cut.Max.x, top, rect.Max.x, bottom);
+}
+
+bool DirtyRectFilter::IsContainedInRegion(const DPRect& rect) const
+{
+    for (const DPRect& region_rect : m_RegionRects)
+    {
+        if (region_rect.Contains(rect))
+            return true;
+    }
+
+    return false;
+}
+
+bool DirtyRectFilter::OverlapsSkipped(const DPRect& rect) const
+{
+    for (const DPRect& skipped_rect : m_SkippedRects)
+    {
+        if (skipped_rect.Overlaps(rect))
+            return true;
+    }
+
+    return false;
+}
+
+void DirtyRectFilter::SetRegionOfInterest(const std::vector<DPRect>& rects, unsigned int generation)
+{
+    if (generation == m_RegionGeneration)
+        return;
+
+    m_RegionRects      = rects;
+    m_RegionGeneration = generation;
+
+    //Culled content is outdated on the shared surface, so it needs to be refreshed if any of it is visible now
+    for (const DPRect& region_rect : m_RegionRects)
+    {
+        if (OverlapsSkipped(region_rect))
+        {
+            m_RefreshPending = true;
+            break;
+        }
+    }
+}
+
+unsigned int DirtyRectFilter::GetRegionGeneration() const
+{
+    return m_RegionGeneration;
+}
+
+bool DirtyRectFilter::FilterDirtyRect(const DPRect& rect, bool allow_clip, std::vector<DPRect>& out_rects)
+{
+    if (m_RegionGeneration == 0)
+    {
+        out_rects.push_back(rect);
+        return true;
+    }
+
+    //Common case of the rect fully being inside a single overlay's crop rect
+    if (IsContainedInRegion(rect))
+    {
+        out_rects.push_back(rect);
+        return true;
+    }
+
+    bool kept_any = false;
+    for (const DPRect& region_rect : m_RegionRects)
+    {
+        if (!region_rect.Overlaps(rect))
+            continue;
+
+        //Without clipping the whole rect is drawn, so nothing of it is culled
+        if (!allow_clip)
+        {
+            out_rects.push_back(rect);
+            return true;
+        }
+
+        //Overlapping region rects result in overlapping clipped rects, which only costs a bit of overdraw
+        DPRect rect_clipped = rect;
+        rect_clipped.ClipWithFull(region_rect);
+        out_rects.push_back(rect_clipped);
+        kept_any = true;
+    }
+
+    if (!kept_any)
+    {
+        AddRectBounded(m_SkippedRects, rect);
+        return false;
+    }
+
+    //Only remember the parts outside of all region rects as culled
+    m_ClipScratch.clear();
+    m_ClipScratch.push_back(rect);
+
+    for (const DPRect& region_rect : m_RegionRects)
+    {
+        m_ClipScratchNext.clear();
+
+        for (const DPRect& part : m_ClipScratch)
+        {
+            SubtractRect(part, region_rect, m_ClipScratchNext);
+        }
+
+        m_ClipScratch.swap(m_ClipScratchNext);
+    }
+
+    for (const DPRect& part : m_ClipScratch)
+    {
+        AddRectBounded(m_SkippedRects, part);
+    }
+
+    return true;
+}
+
+bool DirtyRectFilter::FilterMoveRect(const DPRect& source_rect, const DPRect& dest_rect)
+{
+    if (m_RegionGeneration == 0)
+        return true;
+
+    bool dest_visible = false;
+    for (const DPRect& region_rect : m_RegionRects)
+    {
+        if (region_rect.Overlaps(dest_rect))
+        {
+            dest_visible = true;
+            break;
+        }
+    }
+
+    if (!dest_visible)
+    {
+        AddRectBounded(m_SkippedRects, dest_rect);
+        return false;
+    }
+
+    //Moving outdated content into view would be wrong, do a refresh instead
+    if (OverlapsSkipped(source_rect))
+    {
+        AddRectBounded(m_SkippedRects, dest_rect);
+        m_RefreshPending = true;
+        return false;
+    }
+
+    return true;
+}
+
+bool DirtyRectFilter::IsRefreshPending() const
+{
+    return m_RefreshPending;
+}
+
+const std::vector<DPRect>& DirtyRectFilter::GetSkippedRects() const
+{
+    return m_SkippedRects;
+}
+
+void DirtyRectFilter::OnFullRefresh()
+{
+    m_SkippedRects.clear();
+    m_RefreshPending = false;
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <vector>
+#include "DPRect.h"
+
+//Culls dirty and move rects of a single output against the region of interest, which is the union of all visible Desktop Duplication overlays' crop rects
+//All rects are in shared surface coordinates. Culled areas are remembered so they get refreshed once they become part of the region of interest again
+//Only what was actually culled is remembered, as a short list of rects. Once the list is full, new areas are merged into the rect growing the least from it
+//Used by DDPDisplayManager before anything is copied to the shared surface
+class DirtyRectFilter
+{
+    private:
+        std::vector<DPRect> m_RegionRects;
+        unsigned int m_RegionGeneration = 0;            //0 means no region was set yet and nothing gets culled
+        std::vector<DPRect> m_SkippedRects;             //Culled areas since the last full refresh
+        std::vector<DPRect> m_ClipScratch;              //Kept around to avoid reallocating in FilterDirtyRect()
+        std::vector<DPRect> m_ClipScratchNext;
+        bool m_RefreshPending = false;
+
+        bool IsContainedInRegion(const DPRect& rect) const;
+        bool OverlapsSkipped(const DPRect& rect) const;
+
+    public:
+        //Does nothing if generation matches the current one. Flags a pending refresh if previously culled areas are part of the new region
+        void SetRegionOfInterest(const std::vector<DPRect>& rects, unsigned int generation);
+        unsigned int GetRegionGeneration() const;
+
+        //Appends the parts of rect that should be copied to out_rects. Without allow_clip, rect is either kept whole or dropped entirely
+        //Returns false if nothing of rect was kept
+        bool FilterDirtyRect(const DPRect& rect, bool allow_clip, std::vector<DPRect>& out_rects);
+        //Returns false if the move should be skipped. Moves from previously culled areas into the region of interest also flag a pending refresh
+        bool FilterMoveRect(const DPRect& source_rect, const DPRect& dest_rect);
+
+        bool IsRefreshPending() const;
+        const std::vector<DPRect>& GetSkippedRects() const;
+        void OnFullRefresh();                           //Call after the entire output was copied
+
+        static const unsigned int s_SkippedRectsMax = 8;
+
+        //Adds rect to a list of at most s_SkippedRectsMax rects, merging if needed. Also used for the skipped areas collected from all capture threads
+        static void AddRectBounded(std::vector<DPRect>& rects, const DPRect& rect);
+        //Appends the up to 4 parts of rect not covered by cut to out_rects
+        static void SubtractRect(const DPRect& rect, const DPRect& cut, std::vector<DPRect>& out_rects);
+};
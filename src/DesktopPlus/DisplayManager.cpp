@@ -19,30 +19,139 @@ void DDPDisplayManager::InitD3D(const DDPDxResources& Data)
 //
 // Process a given frame and its metadata
 //
-DDPDuplReturn DDPDisplayManager::ProcessFrame(const DDPFrameData& Data, _Inout_ ID3D11Texture2D* SharedSurf, INT OffsetX, INT OffsetY, const DXGI_OUTPUT_DESC& DeskDesc, _Inout_ DPRect& DirtyRectTotal)
+DDPDuplReturn DDPDisplayManager::ProcessFrame(const DDPFrameData& Data, _Inout_ ID3D11Texture2D* SharedSurf, INT OffsetX, INT OffsetY, const DXGI_OUTPUT_DESC& DeskDesc, _Inout_ DPRect& DirtyRectTotal,
+                                              _Inout_ DDPRegionOfInterest& RegionOfInterest, bool FullFrame)
 {
     DDPDuplReturn Ret = ddp_dupl_return_success;
 
+    m_DirtyFilter.SetRegionOfInterest(RegionOfInterest.Rects, RegionOfInterest.Generation);
+
+    //Copy the whole frame if requested or if previously culled areas became visible, moves and dirty rects can be ignored then
+    if ( (FullFrame) || (m_DirtyFilter.IsRefreshPending()) )
+    {
+        return CopyFull(Data.Frame.Get(), SharedSurf, OffsetX, OffsetY, DeskDesc, DirtyRectTotal);
+    }
+
     // Process dirties and moves
     if (Data.FrameInfo.TotalMetadataBufferSize)
     {
         D3D11_TEXTURE2D_DESC Desc;
         Data.Frame->GetDesc(&Desc);
 
-        if (Data.MoveCount)
+        DXGI_OUTDUPL_MOVE_RECT* MoveBuffer = reinterpret_cast<DXGI_OUTDUPL_MOVE_RECT*>(Data.MetaDataBuffer->data());
+        RECT* DirtyBufferRaw = reinterpret_cast<RECT*>(Data.MetaDataBuffer->data() + (Data.MoveCount * sizeof(DXGI_OUTDUPL_MOVE_RECT)));
+
+        //Plan copies in frame coordinates. This merges dirty rects and drops moves that would be overwritten by them anyway
+        m_CopyPlannerMoves.clear();
+        for (UINT i = 0; i < Data.MoveCount; ++i)
         {
-            Ret = CopyMove(SharedSurf, reinterpret_cast<DXGI_OUTDUPL_MOVE_RECT*>(Data.MetaDataBuffer->data()), Data.MoveCount, OffsetX, OffsetY, DeskDesc, Desc.Width, Desc.Height, DirtyRectTotal);
+            const POINT& SourcePoint = MoveBuffer[i].SourcePoint;
+            const RECT& DestRect     = MoveBuffer[i].DestinationRect;
+
+            m_CopyPlannerMoves.push_back({DPRect(SourcePoint.x, SourcePoint.y, SourcePoint.x + DestRect.right - DestRect.left, SourcePoint.y + DestRect.bottom - DestRect.top),
+                                          DPRect(DestRect.left, DestRect.top, DestRect.right, DestRect.bottom)});
+        }
+
+        m_CopyPlannerDirtyRects.clear();
+        for (UINT i = 0; i < Data.DirtyCount; ++i)
+        {
+            m_CopyPlannerDirtyRects.emplace_back(DirtyBufferRaw[i].left, DirtyBufferRaw[i].top, DirtyBufferRaw[i].right, DirtyBufferRaw[i].bottom);
+        }
+
+        m_CopyPlanner.Plan(m_CopyPlannerMoves.data(), (unsigned int)m_CopyPlannerMoves.size(), m_CopyPlannerDirtyRects.data(), (unsigned int)m_CopyPlannerDirtyRects.size());
+
+        if (!m_CopyPlanner.GetMoveIDs().empty())
+        {
+            Ret = CopyMove(SharedSurf, MoveBuffer, OffsetX, OffsetY, DeskDesc, Desc.Width, Desc.Height, DirtyRectTotal);
             if (Ret != ddp_dupl_return_success)
             {
                 return Ret;
             }
         }
 
-        if (Data.DirtyCount)
+        //A move may have brought culled content into view
+        if (m_DirtyFilter.IsRefreshPending())
+        {
+            return CopyFull(Data.Frame.Get(), SharedSurf, OffsetX, OffsetY, DeskDesc, DirtyRectTotal);
+        }
+
+        m_DirtyRectsPlanned.clear();
+        for (const DPRect& rect : m_CopyPlanner.GetDirtyRects())
         {
-            Ret = CopyDirty(Data.Frame.Get(), SharedSurf, reinterpret_cast<RECT*>(Data.MetaDataBuffer->data() + (Data.MoveCount * sizeof(DXGI_OUTDUPL_MOVE_RECT))), Data.DirtyCount, OffsetX, OffsetY, DeskDesc, 
-                            DirtyRectTotal);
+            m_DirtyRectsPlanned.push_back({rect.GetTL().x, rect.GetTL().y, rect.GetBR().x, rect.GetBR().y});
         }
+
+        if (!m_DirtyRectsPlanned.empty())
+        {
+            RECT* DirtyBuffer = m_DirtyRectsPlanned.data();
+            UINT DirtyCount = (UINT)m_DirtyRectsPlanned.size();
+
+            //Cull dirty rects no overlay would show. Clipping is only done on unrotated outputs, where surface and frame coordinates just differ by an offset
+            if (m_DirtyFilter.GetRegionGeneration() != 0)
+            {
+                const bool AllowClip = ( (DeskDesc.Rotation == DXGI_MODE_ROTATION_UNSPECIFIED) || (DeskDesc.Rotation == DXGI_MODE_ROTATION_IDENTITY) );
+                const INT SurfOffsetX = DeskDesc.DesktopCoordinates.left - OffsetX;
+                const INT SurfOffsetY = DeskDesc.DesktopCoordinates.top  - OffsetY;
+
+                m_DirtyRectsFiltered.clear();
+
+                for (UINT i = 0; i < DirtyCount; ++i)
+                {
+                    m_DirtyRectsFilterOut.clear();
+
+                    if (!m_DirtyFilter.FilterDirtyRect(GetDirtyRectSurface(DirtyBuffer[i], OffsetX, OffsetY, DeskDesc), AllowClip, m_DirtyRectsFilterOut))
+                        continue;
+
+                    if (AllowClip)
+                    {
+                        for (const DPRect& rect : m_DirtyRectsFilterOut)
+                        {
+                            m_DirtyRectsFiltered.push_back({rect.GetTL().x - SurfOffsetX, rect.GetTL().y - SurfOffsetY, rect.GetBR().x - SurfOffsetX, rect.GetBR().y - SurfOffsetY});
+                        }
+                    }
+                    else
+                    {
+                        m_DirtyRectsFiltered.push_back(DirtyBuffer[i]);
+                    }
+                }
+
+                DirtyBuffer = m_DirtyRectsFiltered.data();
+                DirtyCount  = (UINT)m_DirtyRectsFiltered.size();
+            }
+
+            if (DirtyCount != 0)
+            {
+                Ret = CopyDirty(Data.Frame.Get(), SharedSurf, DirtyBuffer, DirtyCount, OffsetX, OffsetY, DeskDesc, DirtyRectTotal);
+            }
+        }
+    }
+
+    //Let the main thread know about culled areas so it can get them refreshed once they become visible
+    for (const DPRect& SkippedRect : m_DirtyFilter.GetSkippedRects())
+    {
+        DirtyRectFilter::AddRectBounded(RegionOfInterest.SkippedRects, SkippedRect);
+    }
+
+    return Ret;
+}
+
+//
+// Copies the entire frame as a single dirty rect
+//
+DDPDuplReturn DDPDisplayManager::CopyFull(_In_ ID3D11Texture2D* SrcSurface, _Inout_ ID3D11Texture2D* SharedSurf, INT OffsetX, INT OffsetY, const DXGI_OUTPUT_DESC& DeskDesc, _Inout_ DPRect& DirtyRectTotal)
+{
+    if (SrcSurface == nullptr)
+        return ddp_dupl_return_success;
+
+    D3D11_TEXTURE2D_DESC Desc;
+    SrcSurface->GetDesc(&Desc);
+
+    RECT FullRect = {0, 0, (LONG)Desc.Width, (LONG)Desc.Height};
+    DDPDuplReturn Ret = CopyDirty(SrcSurface, SharedSurf, &FullRect, 1, OffsetX, OffsetY, DeskDesc, DirtyRectTotal);
+
+    if (Ret == ddp_dupl_return_success)
+    {
+        m_DirtyFilter.OnFullRefresh();
     }
 
     return Ret;
@@ -151,36 +260,26 @@ void DDPDisplayManager::SetMoveRect(_Out_ RECT& SrcRect, _Out_ RECT& DestRect, c
 //
 // Copy move rectangles
 //
-DDPDuplReturn DDPDisplayManager::CopyMove(_Inout_ ID3D11Texture2D* SharedSurf, _In_reads_(MoveCount) DXGI_OUTDUPL_MOVE_RECT* MoveBuffer, UINT MoveCount, INT OffsetX, INT OffsetY, const DXGI_OUTPUT_DESC& DeskDesc,
+DDPDuplReturn DDPDisplayManager::CopyMove(_Inout_ ID3D11Texture2D* SharedSurf, _In_ DXGI_OUTDUPL_MOVE_RECT* MoveBuffer, INT OffsetX, INT OffsetY, const DXGI_OUTPUT_DESC& DeskDesc,
                                           INT TexWidth, INT TexHeight, _Inout_ DPRect& DirtyRectTotal)
 {
-    D3D11_TEXTURE2D_DESC FullDesc;
-    SharedSurf->GetDesc(&FullDesc);
-
-    // Make new intermediate surface to copy into for moving
-    if (!m_MoveSurf)
-    {
-        D3D11_TEXTURE2D_DESC MoveDesc;
-        MoveDesc = FullDesc;
-        MoveDesc.Width  = DeskDesc.DesktopCoordinates.right  - DeskDesc.DesktopCoordinates.left;
-        MoveDesc.Height = DeskDesc.DesktopCoordinates.bottom - DeskDesc.DesktopCoordinates.top;
-        MoveDesc.BindFlags = D3D11_BIND_RENDER_TARGET;
-        MoveDesc.MiscFlags = 0;
-        HRESULT hr = m_Device->CreateTexture2D(&MoveDesc, nullptr, &m_MoveSurf);
-        if (FAILED(hr))
-        {
-            return ProcessFailure(m_Device.Get(), L"Failed to create staging texture for move rects", L"Desktop+ Error", hr, SystemTransitionsExpectedErrors);
-        }
-    }
-
-    for (UINT i = 0; i < MoveCount; ++i)
+    for (unsigned int MoveID : m_CopyPlanner.GetMoveIDs())
     {
         RECT SrcRect;
         RECT DestRect;
 
-        SetMoveRect(SrcRect, DestRect, DeskDesc, MoveBuffer[i], TexWidth, TexHeight);
+        SetMoveRect(SrcRect, DestRect, DeskDesc, MoveBuffer[MoveID], TexWidth, TexHeight);
 
-        // Copy rect out of shared surface
+        //Skip moves no overlay would show
+        DPRect SrcRectSurf(SrcRect.left, SrcRect.top, SrcRect.right, SrcRect.bottom);
+        DPRect DestRectSurf(DestRect.left, DestRect.top, DestRect.right, DestRect.bottom);
+        SrcRectSurf.Translate( {DeskDesc.DesktopCoordinates.left - OffsetX, DeskDesc.DesktopCoordinates.top - OffsetY});
+        DestRectSurf.Translate({DeskDesc.DesktopCoordinates.left - OffsetX, DeskDesc.DesktopCoordinates.top - OffsetY});
+
+        if (!m_DirtyFilter.FilterMoveRect(SrcRectSurf, DestRectSurf))
+            continue;
+
+        // Source rect in shared surface
         D3D11_BOX Box = {};
         Box.left   = SrcRect.left + DeskDesc.DesktopCoordinates.left - OffsetX;
         Box.top    = SrcRect.top  + DeskDesc.DesktopCoordinates.top  - OffsetY;
@@ -188,6 +287,29 @@ DDPDuplReturn DDPDisplayManager::CopyMove(_Inout_ ID3D11Texture2D* SharedSurf, _
         Box.right  = SrcRect.right  + DeskDesc.DesktopCoordinates.left - OffsetX;
         Box.bottom = SrcRect.bottom + DeskDesc.DesktopCoordinates.top  - OffsetY;
         Box.back   = 1;
+
+        //Adjust by desktop and destination offsets
+        DestRect.left += DeskDesc.DesktopCoordinates.left - OffsetX;
+        DestRect.top  += DeskDesc.DesktopCoordinates.top  - OffsetY;
+
+        // Make new intermediate surface to copy into for moving
+        //Moves always go through it, as copies with the same subresource as source and destination are dropped by D3D11
+        if (!m_MoveSurf)
+        {
+            D3D11_TEXTURE2D_DESC MoveDesc;
+            SharedSurf->GetDesc(&MoveDesc);
+            MoveDesc.Width  = DeskDesc.DesktopCoordinates.right  - DeskDesc.DesktopCoordinates.left;
+            MoveDesc.Height = DeskDesc.DesktopCoordinates.bottom - DeskDesc.DesktopCoordinates.top;
+            MoveDesc.BindFlags = D3D11_BIND_RENDER_TARGET;
+            MoveDesc.MiscFlags = 0;
+            HRESULT hr = m_Device->CreateTexture2D(&MoveDesc, nullptr, &m_MoveSurf);
+            if (FAILED(hr))
+            {
+                return ProcessFailure(m_Device.Get(), L"Failed to create staging texture for move rects", L"Desktop+ Error", hr, SystemTransitionsExpectedErrors);
+            }
+        }
+
+        // Copy rect out of shared surface
         m_DeviceContext->CopySubresourceRegion(m_MoveSurf.Get(), 0, SrcRect.left, SrcRect.top, 0, SharedSurf, 0, &Box);
 
         // Copy back to shared surface
@@ -198,20 +320,39 @@ DDPDuplReturn DDPDisplayManager::CopyMove(_Inout_ ID3D11Texture2D* SharedSurf, _
         Box.bottom = SrcRect.bottom;
         Box.back   = 1;
 
-        //Adjust by desktop and destination offsets
-        DestRect.left += DeskDesc.DesktopCoordinates.left - OffsetX;
-        DestRect.top  += DeskDesc.DesktopCoordinates.top  - OffsetY;
-
         m_DeviceContext->CopySubresourceRegion(SharedSurf, 0, DestRect.left, DestRect.top, 0, m_MoveSurf.Get(), 0, &Box);
 
         //Add rect to total dirty region rect
-        DPRect drect(DestRect.left, DestRect.top, (int)Box.right, (int)Box.bottom);
+        DPRect drect(DestRect.left, DestRect.top, DestRect.left + (SrcRect.right - SrcRect.left), DestRect.top + (SrcRect.bottom - SrcRect.top));
         (DirtyRectTotal.GetTL().x == -1) ? DirtyRectTotal = drect : DirtyRectTotal.Add(drect);
     }
 
     return ddp_dupl_return_success;
 }
 
+//
+// Get dirty rect in shared surface coordinates, compensated for rotation the same way as in SetDirtyVert()
+//
+DPRect DDPDisplayManager::GetDirtyRectSurface(const RECT& Dirty, INT OffsetX, INT OffsetY, const DXGI_OUTPUT_DESC& DeskDesc)
+{
+    INT Width  = DeskDesc.DesktopCoordinates.right  - DeskDesc.DesktopCoordinates.left;
+    INT Height = DeskDesc.DesktopCoordinates.bottom - DeskDesc.DesktopCoordinates.top;
+
+    DPRect DestDirty(Dirty.left, Dirty.top, Dirty.right, Dirty.bottom);
+
+    switch (DeskDesc.Rotation)
+    {
+        case DXGI_MODE_ROTATION_ROTATE90:  DestDirty = DPRect(Width - Dirty.bottom, Dirty.left,            Width - Dirty.top,  Dirty.right);         break;
+        case DXGI_MODE_ROTATION_ROTATE180: DestDirty = DPRect(Width - Dirty.right,  Height - Dirty.bottom, Width - Dirty.left, Height - Dirty.top);  break;
+        case DXGI_MODE_ROTATION_ROTATE270: DestDirty = DPRect(Dirty.top,            Height - Dirty.right,  Dirty.bottom,       Height - Dirty.left); break;
+        default: break;
+    }
+
+    DestDirty.Translate({DeskDesc.DesktopCoordinates.left - OffsetX, DeskDesc.DesktopCoordinates.top - OffsetY});
+
+    return DestDirty;
+}
+
 //
 // Sets up vertices for dirty rects for rotated desktops
 //
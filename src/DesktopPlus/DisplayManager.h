@@ -2,6 +2,8 @@
 #define _DISPLAYMANAGER_H_
 
 #include "CommonTypes.h"
+#include "DirtyRectFilter.h"
+#include "DirtyRectCopyPlanner.h"
 
 //
 // Handles the task of processing frames
@@ -10,18 +12,23 @@ class DDPDisplayManager
 {
     public:
         void InitD3D(const DDPDxResources& Data);
-        DDPDuplReturn ProcessFrame(const DDPFrameData& Data, _Inout_ ID3D11Texture2D* SharedSurf, INT OffsetX, INT OffsetY, const DXGI_OUTPUT_DESC& DeskDesc, _Inout_ DPRect& DirtyRectTotal);
+        //Dirty and move rects outside of RegionOfInterest are culled. FullFrame copies the entire frame regardless of the reported rects (used after the thread was parked)
+        DDPDuplReturn ProcessFrame(const DDPFrameData& Data, _Inout_ ID3D11Texture2D* SharedSurf, INT OffsetX, INT OffsetY, const DXGI_OUTPUT_DESC& DeskDesc, _Inout_ DPRect& DirtyRectTotal,
+                                   _Inout_ DDPRegionOfInterest& RegionOfInterest, bool FullFrame = false);
         void OnThreadPause(Microsoft::WRL::ComPtr<ID3D11Texture2D>& SharedSurf, Microsoft::WRL::ComPtr<IDXGIKeyedMutex>& KeyMutex);
         HRESULT OnThreadResume(Microsoft::WRL::ComPtr<ID3D11Texture2D>& SharedSurf, Microsoft::WRL::ComPtr<IDXGIKeyedMutex>& KeyMutex, HANDLE TexSharedHandle);
 
     private:
     // methods
+        DDPDuplReturn CopyFull(_In_ ID3D11Texture2D* SrcSurface, _Inout_ ID3D11Texture2D* SharedSurf, INT OffsetX, INT OffsetY, const DXGI_OUTPUT_DESC& DeskDesc, _Inout_ DPRect& DirtyRectTotal);
         DDPDuplReturn CopyDirty(_In_ ID3D11Texture2D* SrcSurface, _Inout_ ID3D11Texture2D* SharedSurf, _In_reads_(DirtyCount) RECT* DirtyBuffer, UINT DirtyCount, INT OffsetX, INT OffsetY,
                                 const DXGI_OUTPUT_DESC& DeskDesc, _Inout_ DPRect& DirtyRectTotal);
-        DDPDuplReturn CopyMove(_Inout_ ID3D11Texture2D* SharedSurf, _In_reads_(MoveCount) DXGI_OUTDUPL_MOVE_RECT* MoveBuffer, UINT MoveCount, INT OffsetX, INT OffsetY, const DXGI_OUTPUT_DESC& DeskDesc,
+        //Only does the moves planned by m_CopyPlanner
+        DDPDuplReturn CopyMove(_Inout_ ID3D11Texture2D* SharedSurf, _In_ DXGI_OUTDUPL_MOVE_RECT* MoveBuffer, INT OffsetX, INT OffsetY, const DXGI_OUTPUT_DESC& DeskDesc,
                                INT TexWidth, INT TexHeight, _Inout_ DPRect& DirtyRectTotal);
         void SetDirtyVert(_Out_writes_(DDP_NUMVERTICES) DDPVertex* Vertices, _In_ RECT* Dirty, INT OffsetX, INT OffsetY, const DXGI_OUTPUT_DESC& DeskDesc, const D3D11_TEXTURE2D_DESC& FullDesc, 
                           const D3D11_TEXTURE2D_DESC& ThisDesc, _Inout_ DPRect& DirtyRectTotal);
+        static DPRect GetDirtyRectSurface(const RECT& Dirty, INT OffsetX, INT OffsetY, const DXGI_OUTPUT_DESC& DeskDesc);    //Returns dirty rect in shared surface coordinates
         void SetMoveRect(_Out_ RECT& SrcRect, _Out_ RECT& DestRect, const DXGI_OUTPUT_DESC& DeskDesc, const DXGI_OUTDUPL_MOVE_RECT& MoveRect, INT TexWidth, INT TexHeight);
 
     // variables
@@ -36,6 +43,13 @@ class DDPDisplayManager
         Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> m_DirtyVertexShaderResource;
         Microsoft::WRL::ComPtr<ID3D11Buffer> m_DirtyVertexBuffer;
         std::vector<BYTE> m_DirtyVertexBufferData;
+        DirtyRectFilter m_DirtyFilter;
+        std::vector<RECT> m_DirtyRectsFiltered;
+        std::vector<DPRect> m_DirtyRectsFilterOut;
+        DirtyRectCopyPlanner m_CopyPlanner;
+        std::vector<CopyPlannerMove> m_CopyPlannerMoves;
+        std::vector<DPRect> m_CopyPlannerDirtyRects;
+        std::vector<RECT> m_DirtyRectsPlanned;
 };
 
 #endif
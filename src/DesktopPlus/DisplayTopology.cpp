@@ -0,0 +1,193 @@
+#include "DisplayTopology.h"
+
+#include <unordered_map>
+
+std::shared_ptr<const DisplayTopologySnapshot> DisplayTopologySnapshot::Build(DisplayTopologyEnumerator& enumerator)
+{
+    auto snapshot = std::make_shared<DisplayTopologySnapshot>();
+
+    if (!enumerator.EnumAdapters(snapshot->Adapters, snapshot->Outputs))
+    {
+        snapshot->Adapters.clear();
+        snapshot->Outputs.clear();
+        return snapshot;
+    }
+
+    //Drop outputs referring to adapters that don't exist so lookups never have to check
+    for (auto it = snapshot->Outputs.begin(); it != snapshot->Outputs.end();)
+    {
+        if ( (it->AdapterIndex < 0) || (it->AdapterIndex >= (int)snapshot->Adapters.size()) )
+        {
+            it = snapshot->Outputs.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    for (auto& adapter : snapshot->Adapters)
+    {
+        adapter.OutputFirst = (int)snapshot->Outputs.size();
+        adapter.OutputCount = 0;
+    }
+
+    for (int i = 0; i < (int)snapshot->Outputs.size(); ++i)
+    {
+        DisplayTopologyOutput& output = snapshot->Outputs[i];
+        DisplayTopologyAdapter& adapter = snapshot->Adapters[output.AdapterIndex];
+
+        if (adapter.OutputCount == 0)
+        {
+            adapter.OutputFirst = i;
+        }
+
+        output.AdapterOutputIndex = adapter.OutputCount;
+        adapter.OutputCount++;
+
+        snapshot->m_DesktopOutputs[0].push_back(i);
+
+        if (!adapter.IsWMRVirtual)
+        {
+            snapshot->m_DesktopOutputs[1].push_back(i);
+        }
+    }
+
+    snapshot->JoinColorInfo(enumerator);
+    snapshot->IsValid = true;
+
+    return snapshot;
+}
+
+std::shared_ptr<const DisplayTopologySnapshot> DisplayTopologySnapshot::BuildWithNewColorInfo(const DisplayTopologySnapshot& base, DisplayTopologyEnumerator& enumerator)
+{
+    auto snapshot = std::make_shared<DisplayTopologySnapshot>(base);
+    snapshot->JoinColorInfo(enumerator);
+
+    return snapshot;
+}
+
+void DisplayTopologySnapshot::JoinColorInfo(DisplayTopologyEnumerator& enumerator)
+{
+    //Color info is joined by device name as display config paths don't come in DXGI order
+    std::vector<DisplayTopologyColorInfo> color_info;
+    std::unordered_map<std::string, size_t> color_info_index;
+
+    if (enumerator.EnumColorInfo(color_info))
+    {
+        for (size_t i = 0; i < color_info.size(); ++i)
+        {
+            color_info_index.emplace(color_info[i].DeviceName, i);
+        }
+    }
+
+    for (DisplayTopologyOutput& output : Outputs)
+    {
+        auto it = color_info_index.find(output.DeviceName);
+        output.HasColorInfo = (it != color_info_index.end());
+        output.ColorInfo = (output.HasColorInfo) ? color_info[it->second] : DisplayTopologyColorInfo();
+    }
+}
+
+int DisplayTopologySnapshot::GetDesktopCount(bool wmr_ignore_vscreens) const
+{
+    return (int)m_DesktopOutputs[wmr_ignore_vscreens].size();
+}
+
+const DisplayTopologyOutput* DisplayTopologySnapshot::GetDesktop(int desktop_id, bool wmr_ignore_vscreens) const
+{
+    if (desktop_id == -1)
+        desktop_id = 0;
+
+    const std::vector<int>& desktop_outputs = m_DesktopOutputs[wmr_ignore_vscreens];
+
+    if ( (desktop_id < 0) || (desktop_id >= (int)desktop_outputs.size()) )
+        return nullptr;
+
+    return &Outputs[desktop_outputs[desktop_id]];
+}
+
+int DisplayTopologySnapshot::FindDesktopID(uint64_t monitor_handle, bool wmr_ignore_vscreens) const
+{
+    const std::vector<int>& desktop_outputs = m_DesktopOutputs[wmr_ignore_vscreens];
+
+    for (int i = 0; i < (int)desktop_outputs.size(); ++i)
+    {
+        if (Outputs[desktop_outputs[i]].MonitorHandle == monitor_handle)
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+float DisplayTopologySnapshot::GetHDRWhiteLevelAdjustment(int desktop_id, bool is_for_graphics_capture, bool wmr_ignore_vscreens) const
+{
+    const DisplayTopologyOutput* output = GetDesktop(desktop_id, wmr_ignore_vscreens);
+
+    if ( (output == nullptr) || (!output->HasColorInfo) )
+        return 1.0f;
+
+    const DisplayTopologyColorInfo& color_info = output->ColorInfo;
+
+    //The following is based on potentially incomplete observations and doesn't appear to be documented anywhere otherwise
+    //Checking different OS versions without access to a HDR display in a VM makes things a little bit messy... so this likely needs to be fixed up later
+    if (color_info.Is8Bit)
+    {
+        //This the easiest to check and has been observed across several Windows 10 and 11 versions, why it's like this I don't know
+        return (is_for_graphics_capture) ? 0.5f : 1.0f;
+    }
+    else if ( (color_info.IsHDREnabled) && (color_info.SDRWhiteLevel != 0) )
+    {
+        //Observed on Windows 11 24H2, but not on Windows 10 (DISPLAYCONFIG_GET_ADVANCED_COLOR_INFO_2 doesn't exist there so it won't hit this path)
+        return 1000.0f / color_info.SDRWhiteLevel;
+    }
+    else
+    {
+        //Observed on Windows 10 20H2, but potentially always applies to DISPLAYCONFIG_ADVANCED_COLOR_MODE_WCG in general and DISPLAYCONFIG_ADVANCED_COLOR_MODE_HDR doesn't exist there?
+        //However, also observed displays set to HDR get non-linear pixel data written by Desktop Duplication on there (Graphics Capture and Desktop Duplication non-HDR display pixels are correct)
+        //Might have some unknown factor causing it, even if fixable with extra steps in theory... so it is what it is for now.
+        return (is_for_graphics_capture) ? 0.5f : 1.0f;
+    }
+}
+
+DisplayTopology::DisplayTopology(DisplayTopologyEnumerator& enumerator) : m_Enumerator(enumerator)
+{
+}
+
+std::shared_ptr<const DisplayTopologySnapshot> DisplayTopology::GetSnapshot()
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    if (m_Snapshot == nullptr)
+    {
+        m_Snapshot = DisplayTopologySnapshot::Build(m_Enumerator);
+        m_BuildCount++;
+    }
+
+    return m_Snapshot;
+}
+
+void DisplayTopology::Invalidate()
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Snapshot.reset();
+}
+
+void DisplayTopology::RefreshColorInfo()
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    //Nothing to do if the next GetSnapshot() builds a new one anyway
+    if (m_Snapshot != nullptr)
+    {
+        m_Snapshot = DisplayTopologySnapshot::BuildWithNewColorInfo(*m_Snapshot, m_Enumerator);
+    }
+}
+
+unsigned long long DisplayTopology::GetBuildCount() const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_BuildCount;
+}
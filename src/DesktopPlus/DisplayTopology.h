@@ -0,0 +1,104 @@
+//Snapshot of the display topology, i.e. adapters, outputs, desktop rects and their color state
+//Enumerating adapters and outputs and querying the display config is slow and used to be done separately for every desktop and consumer.
+//DisplayTopology builds one immutable snapshot from a single pass of each and keeps handing it out until it's invalidated by a display change notification.
+//Desktop IDs are in DXGI enumeration order, optionally skipping outputs of WMR virtual display adapters (configid_int_interface_wmr_ignore_vscreens).
+//All platform calls go through DisplayTopologyEnumerator, which can be replaced to run this without real displays.
+//This file doesn't depend on any platform headers. DisplayTopology's interface is thread-safe, snapshots are never modified after they were built.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+struct DisplayTopologyAdapter
+{
+    std::string Description;                        //UTF-8
+    uint32_t DeviceID = 0;
+    bool IsWMRVirtual = false;                      //"Virtual Display Adapter" used by WMR headsets
+    int OutputFirst = 0;                            //Index into DisplayTopologySnapshot::Outputs, set by the builder
+    int OutputCount = 0;                            //Set by the builder
+};
+
+struct DisplayTopologyColorInfo
+{
+    std::string DeviceName;                         //GDI device name of the display config path's source
+    bool Is8Bit = true;
+    bool IsHDREnabled = false;
+    uint32_t SDRWhiteLevel = 1000;                  //Only valid if IsHDREnabled
+};
+
+struct DisplayTopologyOutput
+{
+    std::string DeviceName;                         //GDI device name, e.g. "\\.\DISPLAY1", UTF-8
+    uint64_t MonitorHandle = 0;
+    int AdapterIndex = 0;                           //Index into DisplayTopologySnapshot::Adapters, same as the DXGI adapter index
+    int AdapterOutputIndex = 0;                     //Output index on the adapter, set by the builder
+    int Left   = 0;                                 //Desktop coordinates
+    int Top    = 0;
+    int Right  = 0;
+    int Bottom = 0;
+    int Rotation = 0;                               //Degrees clockwise
+    bool HasColorInfo = false;                      //False if no matching display config path was found, ColorInfo is defaults then
+    DisplayTopologyColorInfo ColorInfo;             //Set by the builder
+};
+
+class DisplayTopologyEnumerator
+{
+    public:
+        virtual ~DisplayTopologyEnumerator() {}
+
+        //Adapters in DXGI order and their outputs, grouped by adapter in the same order. Adapters without outputs must be included to keep adapter indices intact
+        virtual bool EnumAdapters(std::vector<DisplayTopologyAdapter>& adapters_out, std::vector<DisplayTopologyOutput>& outputs_out) = 0;
+        //Color info of all active display config paths, in any order
+        virtual bool EnumColorInfo(std::vector<DisplayTopologyColorInfo>& color_info_out) = 0;
+};
+
+class DisplayTopologySnapshot
+{
+    private:
+        std::vector<int> m_DesktopOutputs[2];       //Output index per desktop ID, [1] skips WMR virtual display adapters
+
+        void JoinColorInfo(DisplayTopologyEnumerator& enumerator);
+
+    public:
+        std::vector<DisplayTopologyAdapter> Adapters;
+        std::vector<DisplayTopologyOutput> Outputs;
+        bool IsValid = false;                       //False if adapter enumeration failed. Still safe to use, it's just empty then
+
+        static std::shared_ptr<const DisplayTopologySnapshot> Build(DisplayTopologyEnumerator& enumerator);
+        //Copy of base with only the color info queried again
+        static std::shared_ptr<const DisplayTopologySnapshot> BuildWithNewColorInfo(const DisplayTopologySnapshot& base, DisplayTopologyEnumerator& enumerator);
+
+        int GetDesktopCount(bool wmr_ignore_vscreens) const;
+        //Returns nullptr if desktop_id is out of range. -1 is treated as 0, like the rest of the code does for the combined desktop
+        const DisplayTopologyOutput* GetDesktop(int desktop_id, bool wmr_ignore_vscreens) const;
+        //Returns -1 if no desktop uses the monitor
+        int FindDesktopID(uint64_t monitor_handle, bool wmr_ignore_vscreens) const;
+        //Multiplier to get SDR content of the desktop to its intended brightness when mirrored as HDR. 1.0 if unknown
+        float GetHDRWhiteLevelAdjustment(int desktop_id, bool is_for_graphics_capture, bool wmr_ignore_vscreens) const;
+};
+
+class DisplayTopology
+{
+    private:
+        DisplayTopologyEnumerator& m_Enumerator;
+
+        mutable std::mutex m_Mutex;
+        std::shared_ptr<const DisplayTopologySnapshot> m_Snapshot;  //nullptr when invalidated
+        unsigned long long m_BuildCount = 0;
+
+    public:
+        DisplayTopology(DisplayTopologyEnumerator& enumerator);
+
+        //Builds a new snapshot if the last one was invalidated. The returned snapshot stays valid to use for as long as it's held
+        std::shared_ptr<const DisplayTopologySnapshot> GetSnapshot();
+        //Call on display change notifications
+        void Invalidate();
+        //Queries color info again while keeping adapters and outputs. Color settings such as SDR brightness can change without a display change notification
+        void RefreshColorInfo();
+
+        unsigned long long GetBuildCount() const;
+};
@@ -6,6 +6,7 @@
 #include "Util.h"
 #include "Logging.h"
 #include "OpenVRExt.h"
+#include "OverlayStateMirror.h"
 
 #define LASER_POINTER_OVERLAY_WIDTH 0.0025f
 #define LASER_POINTER_DEFAULT_LENGTH 5.0f
@@ -17,7 +18,10 @@ LaserPointer::LaserPointer() : m_ActivationOrigin(dplp_activation_origin_none),
                                m_LastScrollTick(0),
                                m_DeviceHapticPending(vr::k_unTrackedDeviceIndexInvalid),
                                m_IsForceTargetOverlayActive(false),
-                               m_ForceTargetOverlayHandle(vr::k_ulOverlayHandleInvalid)
+                               m_ForceTargetOverlayHandle(vr::k_ulOverlayHandleInvalid),
+                               m_UIIntersectionMaskMapping(nullptr),
+                               m_UIIntersectionMaskMemory(nullptr),
+                               m_UIIntersectionMaskLastOpenTick(0)
 {
     //Not calling Update() here since the OutputManager typically needs to load the config and OpenVR first
 }
@@ -30,10 +34,22 @@ LaserPointer::~LaserPointer()
         {
             if (lp_device.OvrlHandle != vr::k_ulOverlayHandleInvalid)
             {
-                vr::VROverlay()->DestroyOverlay(lp_device.OvrlHandle);
+                OverlayStateMirror::Get().DestroyOverlay(lp_device.OvrlHandle);
             }
         }
     }
+
+    m_UIIntersectionMaskChannel.Detach();
+
+    if (m_UIIntersectionMaskMemory != nullptr)
+    {
+        ::UnmapViewOfFile(m_UIIntersectionMaskMemory);
+    }
+
+    if (m_UIIntersectionMaskMapping != nullptr)
+    {
+        ::CloseHandle(m_UIIntersectionMaskMapping);
+    }
 }
 
 void LaserPointer::CreateDeviceOverlay(vr::TrackedDeviceIndex_t device_index)
@@ -44,7 +60,7 @@ void LaserPointer::CreateDeviceOverlay(vr::TrackedDeviceIndex_t device_index)
     LaserPointerDevice& lp_device = m_Devices[device_index];
 
     std::string key = "elvissteinjr.DesktopPlusPointer" + std::to_string(device_index);
-    vr::EVROverlayError ovrl_error = vr::VROverlay()->CreateOverlay(key.c_str(), "Desktop+ Laser Pointer", &lp_device.OvrlHandle);
+    vr::EVROverlayError ovrl_error = OverlayStateMirror::Get().CreateOverlay(key.c_str(), "Desktop+ Laser Pointer", &lp_device.OvrlHandle);
 
     if (ovrl_error != vr::VROverlayError_None)
         return;
@@ -55,8 +71,8 @@ void LaserPointer::CreateDeviceOverlay(vr::TrackedDeviceIndex_t device_index)
 
     vr::VROverlay()->SetOverlayRaw(lp_device.OvrlHandle, pixels, 2, 2, 4);
 
-    vr::VROverlay()->SetOverlayWidthInMeters(lp_device.OvrlHandle, LASER_POINTER_OVERLAY_WIDTH);
-    vr::VROverlay()->SetOverlaySortOrder(lp_device.OvrlHandle, 2);
+    OverlayStateMirror::Get().SetOverlayWidthInMeters(lp_device.OvrlHandle, LASER_POINTER_OVERLAY_WIDTH);
+    OverlayStateMirror::Get().SetOverlaySortOrder(lp_device.OvrlHandle, 2);
 }
 
 void LaserPointer::UpdateDeviceOverlay(vr::TrackedDeviceIndex_t device_index)
@@ -86,7 +102,7 @@ void LaserPointer::UpdateDeviceOverlay(vr::TrackedDeviceIndex_t device_index)
     }
     else if ( (lp_device.IsVisible) && (!is_active) )
     {
-        vr::VROverlay()->HideOverlay(lp_device.OvrlHandle);
+        OverlayStateMirror::Get().HideOverlay(lp_device.OvrlHandle);
         lp_device.IsVisible = false;
     }
 
@@ -104,7 +120,7 @@ void LaserPointer::UpdateDeviceOverlay(vr::TrackedDeviceIndex_t device_index)
     float laser_spin = 0.0f;
     {
         vr::TrackedDevicePose_t poses[vr::k_unMaxTrackedDeviceCount];
-        vr::VRSystem()->GetDeviceToAbsoluteTrackingPose(vr::TrackingUniverseStanding, vr::IVRSystemEx::GetTimeNowToPhotons(), poses, vr::k_unMaxTrackedDeviceCount);
+        TrackedPoseSnapshot::Get().GetPoses(poses);
 
         if (poses[device_index].bPoseIsValid && poses[vr::k_unTrackedDeviceIndex_Hmd].bPoseIsValid)
         {
@@ -136,7 +152,7 @@ void LaserPointer::UpdateDeviceOverlay(vr::TrackedDeviceIndex_t device_index)
     {
         //Controller offsets detected, use absolute transform which will be more correct, but also lag behind a little
         vr::TrackedDevicePose_t poses[vr::k_unMaxTrackedDeviceCount];
-        vr::VRSystem()->GetDeviceToAbsoluteTrackingPose(vr::TrackingUniverseStanding, vr::IVRSystemEx::GetTimeNowToPhotons(), poses, vr::k_unMaxTrackedDeviceCount);
+        TrackedPoseSnapshot::Get().GetPoses(poses);
 
         if (!poses[device_index].bPoseIsValid)
             return;
@@ -145,44 +161,44 @@ void LaserPointer::UpdateDeviceOverlay(vr::TrackedDeviceIndex_t device_index)
         transform_ovrl *= transform_tip;
         vr::HmdMatrix34_t transform_openvr = transform_ovrl.toOpenVR34();
 
-        vr::VROverlay()->SetOverlayTransformAbsolute(lp_device.OvrlHandle, vr::TrackingUniverseStanding, &transform_openvr);
+        OverlayStateMirror::Get().SetOverlayTransformAbsolute(lp_device.OvrlHandle, vr::TrackingUniverseStanding, &transform_openvr);
     }
     else
     {
         //No offsets, glue overlay to controller
         vr::HmdMatrix34_t transform_openvr = transform_tip.toOpenVR34();
-        vr::VROverlay()->SetOverlayTransformTrackedDeviceRelative(lp_device.OvrlHandle, (lp_device.UseHMDAsOrigin) ? vr::k_unTrackedDeviceIndex_Hmd : device_index, &transform_openvr);
+        OverlayStateMirror::Get().SetOverlayTransformTrackedDeviceRelative(lp_device.OvrlHandle, (lp_device.UseHMDAsOrigin) ? vr::k_unTrackedDeviceIndex_Hmd : device_index, &transform_openvr);
     }
 
     //Adjust pointer alpha/brightness
     bool is_primary_device = (device_index == (vr::TrackedDeviceIndex_t)ConfigManager::GetValue(configid_int_state_dplus_laser_pointer_device));
     if (is_primary_device)
     {
-        vr::VROverlay()->SetOverlayAlpha(lp_device.OvrlHandle, 1.0f);
+        OverlayStateMirror::Get().SetOverlayAlpha(lp_device.OvrlHandle, 1.0f);
 
         if (lp_device.OvrlHandleTargetLast != vr::k_ulOverlayHandleInvalid)
         {
-            vr::VROverlay()->SetOverlayColor(lp_device.OvrlHandle, 1.0f, 1.0f, 1.0f);
+            OverlayStateMirror::Get().SetOverlayColor(lp_device.OvrlHandle, 1.0f, 1.0f, 1.0f);
         }
         else
         {
-            vr::VROverlay()->SetOverlayColor(lp_device.OvrlHandle, 0.25f, 0.25f, 0.25f);
+            OverlayStateMirror::Get().SetOverlayColor(lp_device.OvrlHandle, 0.25f, 0.25f, 0.25f);
         }
     }
     else if (lp_device.IsActiveForMultiLaserInput)
     {
-        vr::VROverlay()->SetOverlayAlpha(lp_device.OvrlHandle, 0.75f);
-        vr::VROverlay()->SetOverlayColor(lp_device.OvrlHandle, 0.50f, 0.50f, 0.50f);
+        OverlayStateMirror::Get().SetOverlayAlpha(lp_device.OvrlHandle, 0.75f);
+        OverlayStateMirror::Get().SetOverlayColor(lp_device.OvrlHandle, 0.50f, 0.50f, 0.50f);
     }
     else
     {
-        vr::VROverlay()->SetOverlayAlpha(lp_device.OvrlHandle, 0.125f);
-        vr::VROverlay()->SetOverlayColor(lp_device.OvrlHandle, 0.25f, 0.25f, 0.25f);
+        OverlayStateMirror::Get().SetOverlayAlpha(lp_device.OvrlHandle, 0.125f);
+        OverlayStateMirror::Get().SetOverlayColor(lp_device.OvrlHandle, 0.25f, 0.25f, 0.25f);
     }
 
     if (do_show_later)
     {
-        vr::VROverlay()->ShowOverlay(lp_device.OvrlHandle);
+        OverlayStateMirror::Get().ShowOverlay(lp_device.OvrlHandle);
     }
 }
 
@@ -203,7 +219,7 @@ bool LaserPointer::DetectDeviceOverlayCustomOffsets(vr::TrackedDeviceIndex_t dev
         return true;
 
     vr::TrackedDevicePose_t poses[vr::k_unMaxTrackedDeviceCount];
-    vr::VRSystem()->GetDeviceToAbsoluteTrackingPose(vr::TrackingUniverseStanding, vr::IVRSystemEx::GetTimeNowToPhotons(), poses, vr::k_unMaxTrackedDeviceCount);
+    TrackedPoseSnapshot::Get().GetPoses(poses);
 
     vr::TrackedDevicePose_t& device_pose = poses[device_index];
 
@@ -311,7 +327,7 @@ void LaserPointer::UpdateIntersection(vr::TrackedDeviceIndex_t device_index)
         {
             //Check if input is still enabled
             vr::VROverlayInputMethod input_method = vr::VROverlayInputMethod_None;
-            vr::VROverlay()->GetOverlayInputMethod(lp_device.OvrlHandleTargetLast, &input_method);
+            OverlayStateMirror::Get().GetOverlayInputMethod(lp_device.OvrlHandleTargetLast, &input_method);
 
             if (input_method == vr::VROverlayInputMethod_Mouse)
             {
@@ -339,7 +355,7 @@ void LaserPointer::UpdateIntersection(vr::TrackedDeviceIndex_t device_index)
                 {
                     //Check if input is enabled right now (could differ from config setting)
                     vr::VROverlayInputMethod input_method = vr::VROverlayInputMethod_None;
-                    vr::VROverlay()->GetOverlayInputMethod(overlay.GetHandle(), &input_method);
+                    OverlayStateMirror::Get().GetOverlayInputMethod(overlay.GetHandle(), &input_method);
 
                     if ( (input_method == vr::VROverlayInputMethod_Mouse) && 
                          (vr::VROverlay()->ComputeOverlayIntersection(overlay.GetHandle(), &params, &results)) && (results.fDistance < nearest_results.fDistance) )
@@ -361,11 +377,11 @@ void LaserPointer::UpdateIntersection(vr::TrackedDeviceIndex_t device_index)
             //As masks can change any frame, sending them over all the time seems tedious and inefficient... we're doing this for now though to work around that.
             for (vr::VROverlayHandle_t overlay_handle : m_OverlayHandlesUI)
             {
-                if (vr::VROverlay()->IsOverlayVisible(overlay_handle))
+                if (OverlayStateMirror::Get().IsOverlayVisible(overlay_handle))
                 {
                     //Check if input is enabled
                     vr::VROverlayInputMethod input_method = vr::VROverlayInputMethod_None;
-                    vr::VROverlay()->GetOverlayInputMethod(overlay_handle, &input_method);
+                    OverlayStateMirror::Get().GetOverlayInputMethod(overlay_handle, &input_method);
 
                     if ( (input_method == vr::VROverlayInputMethod_Mouse) && (vr::VROverlay()->ComputeOverlayIntersection(overlay_handle, &params, &results)) && 
                          (results.fDistance < nearest_results.fDistance) )
@@ -383,11 +399,11 @@ void LaserPointer::UpdateIntersection(vr::TrackedDeviceIndex_t device_index)
             //MultiLaser overlays (just keyboard right now)
             for (vr::VROverlayHandle_t overlay_handle : m_OverlayHandlesMultiLaser)
             {
-                if (vr::VROverlay()->IsOverlayVisible(overlay_handle))
+                if (OverlayStateMirror::Get().IsOverlayVisible(overlay_handle))
                 {
                     //Check if input is enabled
                     vr::VROverlayInputMethod input_method = vr::VROverlayInputMethod_None;
-                    vr::VROverlay()->GetOverlayInputMethod(overlay_handle, &input_method);
+                    OverlayStateMirror::Get().GetOverlayInputMethod(overlay_handle, &input_method);
 
                     if ( (input_method == vr::VROverlayInputMethod_Mouse) && (vr::VROverlay()->ComputeOverlayIntersection(overlay_handle, &params, &results)) && 
                          (results.fDistance < nearest_results.fDistance) )
@@ -462,12 +478,12 @@ void LaserPointer::UpdateIntersection(vr::TrackedDeviceIndex_t device_index)
         if (is_primary_device)
         {
             bool hide_intersection = false;
-            vr::VROverlay()->GetOverlayFlag(nearest_target_overlay, vr::VROverlayFlags_HideLaserIntersection, &hide_intersection);
+            OverlayStateMirror::Get().GetOverlayFlag(nearest_target_overlay, vr::VROverlayFlags_HideLaserIntersection, &hide_intersection);
 
             if (!hide_intersection)
             {
                 vr::VRTextureBounds_t tex_bounds;
-                vr::VROverlay()->GetOverlayTextureBounds(nearest_target_overlay, &tex_bounds);
+                OverlayStateMirror::Get().GetOverlayTextureBounds(nearest_target_overlay, &tex_bounds);
                 int mapped_x      = (mouse_scale.v[0] * tex_bounds.uMin);
                 int mapped_y      = (mouse_scale.v[1] * tex_bounds.vMin);
                 int mapped_width  = (mouse_scale.v[0] * tex_bounds.uMax) - mapped_x;
@@ -575,8 +591,8 @@ void LaserPointer::UpdateIntersection(vr::TrackedDeviceIndex_t device_index)
 
         //Get scroll mode from overlay and set it for VRInput
         bool send_scroll_discrete = false, send_scroll_smooth = false;
-        vr::VROverlay()->GetOverlayFlag(nearest_target_overlay, vr::VROverlayFlags_SendVRDiscreteScrollEvents, &send_scroll_discrete);
-        vr::VROverlay()->GetOverlayFlag(nearest_target_overlay, vr::VROverlayFlags_SendVRSmoothScrollEvents,   &send_scroll_smooth);
+        OverlayStateMirror::Get().GetOverlayFlag(nearest_target_overlay, vr::VROverlayFlags_SendVRDiscreteScrollEvents, &send_scroll_discrete);
+        OverlayStateMirror::Get().GetOverlayFlag(nearest_target_overlay, vr::VROverlayFlags_SendVRSmoothScrollEvents,   &send_scroll_smooth);
 
         VRInputScrollMode scroll_mode = (send_scroll_smooth) ? vrinput_scroll_smooth : (send_scroll_discrete) ? vrinput_scroll_discrete : vrinput_scroll_none;
         vr_input.SetLaserPointerScrollMode(scroll_mode);
@@ -668,7 +684,7 @@ void LaserPointer::UpdateIntersection(vr::TrackedDeviceIndex_t device_index)
     tex_bounds.uMax = 1.0f;
     tex_bounds.vMax = lp_device.LaserLength / LASER_POINTER_OVERLAY_WIDTH;
 
-    vr::VROverlay()->SetOverlayTextureBounds(lp_device.OvrlHandle, &tex_bounds);
+    OverlayStateMirror::Get().SetOverlayTextureBounds(lp_device.OvrlHandle, &tex_bounds);
 }
 
 void LaserPointer::SendDirectDragCommand(vr::VROverlayHandle_t overlay_handle_target, bool do_start_drag)
@@ -706,6 +722,8 @@ void LaserPointer::Update()
     if ( (primary_pointer_device == vr::k_unTrackedDeviceIndexInvalid) && (!m_HadPrimaryPointerDevice) )
         return;
 
+    UIIntersectionMaskUpdateFromChannel();
+
     VRInput& vr_input = OutputManager::Get()->GetVRInput();
 
     //Trigger pending vibrations if we know the action set is now active
@@ -807,7 +825,7 @@ void LaserPointer::SetActiveDevice(vr::TrackedDeviceIndex_t device_index, LaserP
     //Try finding the input value handle for this device if it's not set yet
     if (lp_device.InputValueHandle == vr::k_ulInvalidInputValueHandle)
     {
-        std::vector<vr::InputOriginInfo_t> devices_info = OutputManager::Get()->GetVRInput().GetLaserPointerDevicesInfo();
+        const VRInputDeviceInfoList& devices_info = OutputManager::Get()->GetVRInput().GetLaserPointerDevicesInfo();
         const auto it = std::find_if(devices_info.begin(), devices_info.end(), [&](const auto& input_origin_info){ return (input_origin_info.trackedDeviceIndex == device_index); });
 
         if (it != devices_info.end())
@@ -885,7 +903,7 @@ void LaserPointer::RemoveDevice(vr::TrackedDeviceIndex_t device_index)
 
     if (lp_device.OvrlHandle != vr::k_ulOverlayHandleInvalid)
     {
-        vr::VROverlay()->DestroyOverlay(lp_device.OvrlHandle);
+        OverlayStateMirror::Get().DestroyOverlay(lp_device.OvrlHandle);
     }
 
     //Send focus leave event to last entered overlay if there is any
@@ -927,7 +945,7 @@ void LaserPointer::RefreshCachedOverlayHandles()
 
     for (const char* key : ui_overlay_keys)
     {
-        vr::VROverlay()->FindOverlay(key, &overlay_handle);
+        OverlayStateMirror::Get().FindOverlay(key, &overlay_handle);
 
         if (overlay_handle != vr::k_ulOverlayHandleInvalid)
         {
@@ -936,7 +954,7 @@ void LaserPointer::RefreshCachedOverlayHandles()
     }
 
     //Find MultiLaser overlays (which is just keyboard right now)
-    vr::VROverlay()->FindOverlay("elvissteinjr.DesktopPlusUIKeyboard", &overlay_handle);
+    OverlayStateMirror::Get().FindOverlay("elvissteinjr.DesktopPlusUIKeyboard", &overlay_handle);
 
     if (overlay_handle != vr::k_ulOverlayHandleInvalid)
     {
@@ -1048,7 +1066,7 @@ vr::TrackedDeviceIndex_t LaserPointer::IsAnyOverlayHovered(float max_distance) c
                 {
                     //Check if input is enabled right now (could differ from config setting)
                     vr::VROverlayInputMethod input_method = vr::VROverlayInputMethod_None;
-                    vr::VROverlay()->GetOverlayInputMethod(overlay.GetHandle(), &input_method);
+                    OverlayStateMirror::Get().GetOverlayInputMethod(overlay.GetHandle(), &input_method);
 
                     if ( (input_method == vr::VROverlayInputMethod_Mouse) && 
                          (vr::VROverlay()->ComputeOverlayIntersection(overlay.GetHandle(), &params, &results)) && (results.fDistance <= max_distance) )
@@ -1066,7 +1084,7 @@ vr::TrackedDeviceIndex_t LaserPointer::IsAnyOverlayHovered(float max_distance) c
             //See UpdateIntersection() for current issues
             for (vr::VROverlayHandle_t overlay_handle : m_OverlayHandlesUI)
             {
-                if (vr::VROverlay()->IsOverlayVisible(overlay_handle))
+                if (OverlayStateMirror::Get().IsOverlayVisible(overlay_handle))
                 {
                     if ( (vr::VROverlay()->ComputeOverlayIntersection(overlay_handle, &params, &results)) && (results.fDistance <= max_distance) )
                     {
@@ -1081,7 +1099,7 @@ vr::TrackedDeviceIndex_t LaserPointer::IsAnyOverlayHovered(float max_distance) c
             //MultiLaser overlays (just keyboard right now)
             for (vr::VROverlayHandle_t overlay_handle : m_OverlayHandlesMultiLaser)
             {
-                if (vr::VROverlay()->IsOverlayVisible(overlay_handle))
+                if (OverlayStateMirror::Get().IsOverlayVisible(overlay_handle))
                 {
                     if ( (vr::VROverlay()->ComputeOverlayIntersection(overlay_handle, &params, &results)) && (results.fDistance <= max_distance) )
                     {
@@ -1124,15 +1142,7 @@ bool LaserPointer::IntersectionMaskHitTest(OverlayTextureSource texsource, vr::H
     {
         Vector2Int point(int(uv.v[0] * m_UIMouseScale.x), int((-uv.v[1] + 1.0f) * m_UIMouseScale.y));
 
-        for (const auto& rect : m_UIIntersectionMaskRects)
-        {
-            if (rect.Contains(point))
-            {
-                return true;
-            }
-        }
-
-        return false;
+        return m_UIIntersectionMaskIndex.Contains(point);
     }
 
     //Other texture sources don't have masks, so they always pass
@@ -1146,6 +1156,46 @@ void LaserPointer::UIIntersectionMaskAddRect(DPRect& rect)
 
 void LaserPointer::UIIntersectionMaskFinish()
 {
-    m_UIIntersectionMaskRects = m_UIIntersectionMaskRectsPending;
+    UIIntersectionMaskSet(m_UIIntersectionMaskRectsPending);
     m_UIIntersectionMaskRectsPending.clear();
 }
+
+void LaserPointer::UIIntersectionMaskSet(const std::vector<DPRect>& rects)
+{
+    //The UI sends its mask regularly even if nothing changed, so only rebuild the index when needed
+    if (rects != m_UIIntersectionMaskIndex.GetRects())
+    {
+        m_UIIntersectionMaskIndex.Build(rects);
+    }
+}
+
+void LaserPointer::UIIntersectionMaskUpdateFromChannel()
+{
+    //Shared memory is created by the UI process, so try to open it every now and then until it exists
+    if ( (!m_UIIntersectionMaskChannel.IsValid()) && (m_UIIntersectionMaskLastOpenTick + 1000 < ::GetTickCount64()) )
+    {
+        m_UIIntersectionMaskLastOpenTick = ::GetTickCount64();
+
+        const DWORD mapping_size = (DWORD)UIIntersectionMaskChannel::GetRequiredMemorySize();
+
+        if (m_UIIntersectionMaskMapping == nullptr)
+        {
+            m_UIIntersectionMaskMapping = ::OpenFileMapping(FILE_MAP_READ, FALSE, g_SharedMemoryNameUIIntersectionMask);
+        }
+
+        if ( (m_UIIntersectionMaskMapping != nullptr) && (m_UIIntersectionMaskMemory == nullptr) )
+        {
+            m_UIIntersectionMaskMemory = ::MapViewOfFile(m_UIIntersectionMaskMapping, FILE_MAP_READ, 0, 0, mapping_size);
+        }
+
+        //This fails if the UI process hasn't finished setting it up yet, in which case we try again later
+        m_UIIntersectionMaskChannel.Attach(m_UIIntersectionMaskMemory, mapping_size);
+    }
+
+    std::vector<DPRect> rects;
+
+    if (m_UIIntersectionMaskChannel.ReadIfChanged(rects))
+    {
+        UIIntersectionMaskSet(rects);
+    }
+}
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "DPRect.h"
+#include "DPRectIndex.h"
+#include "UIIntersectionMaskChannel.h"
 #include "Overlays.h"
 #include "openvr.h"
 
@@ -55,9 +57,14 @@ class LaserPointer
         vr::VROverlayHandle_t m_ForceTargetOverlayHandle;
 
         Vector2Int m_UIMouseScale;
-        std::vector<DPRect> m_UIIntersectionMaskRects;
+        DPRectIndex m_UIIntersectionMaskIndex;
         std::vector<DPRect> m_UIIntersectionMaskRectsPending;
 
+        UIIntersectionMaskChannel m_UIIntersectionMaskChannel;  //Mask rects are only sent as IPC messages if the UI couldn't set this up
+        HANDLE m_UIIntersectionMaskMapping;
+        void* m_UIIntersectionMaskMemory;
+        ULONGLONG m_UIIntersectionMaskLastOpenTick;
+
         void CreateDeviceOverlay(vr::TrackedDeviceIndex_t device_index);
         void UpdateDeviceOverlay(vr::TrackedDeviceIndex_t device_index);
         bool DetectDeviceOverlayCustomOffsets(vr::TrackedDeviceIndex_t device_index, const Matrix4& mat_tip_offset);
@@ -65,6 +72,9 @@ class LaserPointer
 
         void SendDirectDragCommand(vr::VROverlayHandle_t overlay_handle_target, bool do_start_drag);
 
+        void UIIntersectionMaskSet(const std::vector<DPRect>& rects);
+        void UIIntersectionMaskUpdateFromChannel();     //Picks up the latest mask published by the UI process, if any
+
     public:
         LaserPointer();
         ~LaserPointer();
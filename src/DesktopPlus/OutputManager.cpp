@@ -21,6 +21,7 @@ using namespace DirectX;
 #include "Util.h"
 #include "COMWrapper.h"
 #include "OpenVRExt.h"
+#include "OverlayStateMirror.h"
 #include "Logging.h"
 
 #include "DesktopPlusWinRT.h"
@@ -33,10 +34,182 @@ OutputManager* OutputManager::Get()
     return g_OutputManager;
 }
 
+//DXGI adapters and outputs plus a single QueryDisplayConfig() pass for the color state of all of them
+class DisplayTopologyEnumeratorWin32 : public DisplayTopologyEnumerator
+{
+    public:
+        virtual bool EnumAdapters(std::vector<DisplayTopologyAdapter>& adapters_out, std::vector<DisplayTopologyOutput>& outputs_out) override
+        {
+            Microsoft::WRL::ComPtr<IDXGIFactory1> factory_ptr;
+
+            HRESULT hr = CreateDXGIFactory1(__uuidof(IDXGIFactory1), (void**)&factory_ptr);
+            if (FAILED(hr))
+                return false;
+
+            Microsoft::WRL::ComPtr<IDXGIAdapter> adapter_ptr;
+            UINT i = 0;
+
+            while (factory_ptr->EnumAdapters(i, &adapter_ptr) != DXGI_ERROR_NOT_FOUND)
+            {
+                DXGI_ADAPTER_DESC adapter_desc;
+                adapter_ptr->GetDesc(&adapter_desc);
+
+                DisplayTopologyAdapter adapter;
+                adapter.Description  = StringConvertFromUTF16(adapter_desc.Description);
+                adapter.DeviceID     = adapter_desc.DeviceId;
+                adapter.IsWMRVirtual = (wcscmp(adapter_desc.Description, L"Virtual Display Adapter") == 0);
+                adapters_out.push_back(adapter);
+
+                Microsoft::WRL::ComPtr<IDXGIOutput> output_ptr;
+                UINT output_index = 0;
+                while (adapter_ptr->EnumOutputs(output_index, &output_ptr) != DXGI_ERROR_NOT_FOUND)
+                {
+                    DXGI_OUTPUT_DESC output_desc;
+                    output_ptr->GetDesc(&output_desc);
+
+                    DisplayTopologyOutput output;
+                    output.DeviceName    = StringConvertFromUTF16(output_desc.DeviceName);
+                    output.MonitorHandle = (uint64_t)output_desc.Monitor;
+                    output.AdapterIndex  = (int)i;
+                    output.Left          = output_desc.DesktopCoordinates.left;
+                    output.Top           = output_desc.DesktopCoordinates.top;
+                    output.Right         = output_desc.DesktopCoordinates.right;
+                    output.Bottom        = output_desc.DesktopCoordinates.bottom;
+
+                    switch (output_desc.Rotation)
+                    {
+                        case DXGI_MODE_ROTATION_ROTATE90:  output.Rotation = 90;  break;
+                        case DXGI_MODE_ROTATION_ROTATE180: output.Rotation = 180; break;
+                        case DXGI_MODE_ROTATION_ROTATE270: output.Rotation = 270; break;
+                        default:                           output.Rotation = 0;
+                    }
+
+                    outputs_out.push_back(output);
+
+                    ++output_index;
+                }
+
+                ++i;
+            }
+
+            return true;
+        }
+
+        virtual bool EnumColorInfo(std::vector<DisplayTopologyColorInfo>& color_info_out) override
+        {
+            #ifdef DPLUS_DUP_NO_HDR
+                return false;
+            #else
+
+            std::vector<DISPLAYCONFIG_PATH_INFO> paths;
+            std::vector<DISPLAYCONFIG_MODE_INFO> modes;
+            const UINT32 flags = QDC_ONLY_ACTIVE_PATHS | QDC_VIRTUAL_MODE_AWARE;
+            LONG result = ERROR_SUCCESS;
+
+            //Loop until buffer allocation for paths match the requirements
+            do
+            {
+                UINT32 path_count, mode_count;
+                result = ::GetDisplayConfigBufferSizes(flags, &path_count, &mode_count);
+
+                if (result != ERROR_SUCCESS)
+                {
+                    LOG_F(ERROR, "GetDisplayConfigBufferSizes() failed with %ld", result);
+                    return false;
+                }
+
+                paths.resize(path_count);
+                modes.resize(mode_count);
+
+                result = ::QueryDisplayConfig(flags, &path_count, paths.data(), &mode_count, modes.data(), nullptr);
+
+                paths.resize(path_count);
+                modes.resize(mode_count);
+            } 
+            while (result == ERROR_INSUFFICIENT_BUFFER);
+
+            if (result != ERROR_SUCCESS)
+            {
+                LOG_F(ERROR, "QueryDisplayConfig() failed with %ld", result);
+                return false;
+            }
+
+            for (auto& path : paths)
+            {
+                DISPLAYCONFIG_SOURCE_DEVICE_NAME source_name = {};
+                source_name.header.adapterId = path.sourceInfo.adapterId;
+                source_name.header.id = path.sourceInfo.id;
+                source_name.header.type = DISPLAYCONFIG_DEVICE_INFO_GET_SOURCE_NAME;
+                source_name.header.size = sizeof(source_name);
+
+                if (::DisplayConfigGetDeviceInfo(&source_name.header) != ERROR_SUCCESS)
+                    continue;
+
+                DisplayTopologyColorInfo color_info;
+                color_info.DeviceName = StringConvertFromUTF16(source_name.viewGdiDeviceName);
+
+                #if (NTDDI_VERSION >= 0x0A00000F/*NTDDI_WIN11_GA*/)
+                    DISPLAYCONFIG_GET_ADVANCED_COLOR_INFO_2 adv_color_info_2 = {};
+                    adv_color_info_2.header.adapterId = path.targetInfo.adapterId;
+                    adv_color_info_2.header.id = path.targetInfo.id;
+                    adv_color_info_2.header.type = DISPLAYCONFIG_DEVICE_INFO_GET_ADVANCED_COLOR_INFO_2;
+                    adv_color_info_2.header.size = sizeof(adv_color_info_2);
+
+                    result = ::DisplayConfigGetDeviceInfo(&adv_color_info_2.header);
+
+                    if (result == ERROR_SUCCESS)
+                    {
+                        color_info.Is8Bit = (adv_color_info_2.bitsPerColorChannel == 8);
+                        //DISPLAYCONFIG_ADVANCED_COLOR_MODE_WCG is still higher bit-depth but seems like it needs to be handled differently
+                        color_info.IsHDREnabled = (adv_color_info_2.activeColorMode == DISPLAYCONFIG_ADVANCED_COLOR_MODE_HDR);
+                    }
+
+                    if (color_info.IsHDREnabled)
+                    {
+                        DISPLAYCONFIG_SDR_WHITE_LEVEL config_sdr_white_level = {};
+                        config_sdr_white_level.header.adapterId = path.targetInfo.adapterId;
+                        config_sdr_white_level.header.id = path.targetInfo.id;
+                        config_sdr_white_level.header.type = DISPLAYCONFIG_DEVICE_INFO_GET_SDR_WHITE_LEVEL;
+                        config_sdr_white_level.header.size = sizeof(config_sdr_white_level);
+
+                        result = ::DisplayConfigGetDeviceInfo(&config_sdr_white_level.header);
+
+                        if (result == ERROR_SUCCESS)
+                        {
+                            color_info.SDRWhiteLevel = config_sdr_white_level.SDRWhiteLevel;
+                        }
+                    }
+                #endif
+
+                DISPLAYCONFIG_GET_ADVANCED_COLOR_INFO adv_color_info = {};
+                adv_color_info.header.adapterId = path.targetInfo.adapterId;
+                adv_color_info.header.id = path.targetInfo.id;
+                adv_color_info.header.type = DISPLAYCONFIG_DEVICE_INFO_GET_ADVANCED_COLOR_INFO;
+                adv_color_info.header.size = sizeof(adv_color_info);
+
+                result = ::DisplayConfigGetDeviceInfo(&adv_color_info.header);
+
+                if (result == ERROR_SUCCESS)
+                {
+                    color_info.Is8Bit = (adv_color_info.bitsPerColorChannel == 8);
+                }
+
+                color_info_out.push_back(color_info);
+            }
+
+            return true;
+
+            #endif //DPLUS_DUP_NO_HDR
+        }
+};
+
+static DisplayTopologyEnumeratorWin32 g_DisplayTopologyEnumeratorWin32;
+
 //
 //Quick note about OutputManager (and Desktop+ in general) handles multi-overlay access:
 //Most functions use the "current" overlay as set by the OverlayManager or by having ConfigManager forward config values from the *_overlay_* configids
 //When needed, the current overlay is temporarily changed to the one to act on. 
+//Per-frame code paths avoid this where possible and read config values through an OverlayConfigView taken for the overlay ID instead
 //To have the UI act in such a scenario, the configid_int_state_overlay_current_id_override is typically used, as there may be visible changes to the user for one frame otherwise
 //To change the current overlay while nested in a temporary override, post a configid_int_interface_overlay_current_id message to both applications instead of just the counterpart
 //
@@ -51,9 +224,11 @@ OutputManager::OutputManager(HANDLE PauseDuplicationEvent, HANDLE ResumeDuplicat
     m_DesktopY(0),
     m_DesktopWidth(-1),
     m_DesktopHeight(-1),
+    m_DisplayTopology(g_DisplayTopologyEnumeratorWin32),
     m_MaxActiveRefreshDelay(16),
     m_OutputPendingSkippedFrame(false),
     m_OutputPendingFullRefresh(false),
+    m_OutputPendingScreenRefresh(false),
     m_OutputHDRAvailable(false),
     m_OutputInvalid(false),
     m_OutputPendingDirtyRect{-1, -1, -1, -1},
@@ -266,6 +441,8 @@ DDPDuplReturn OutputManager::InitOutput(HWND Window, INT& SingleOutput, UINT& Ou
     int desktop_x_prev = m_DesktopX;
     int desktop_y_prev = m_DesktopY;
 
+    //Output init mostly happens after duplication was lost due to a display change, which can be before WM_DISPLAYCHANGE arrived
+    InvalidateDisplayTopology();
     EnumerateOutputs(SingleOutput, &adapter_ptr_preferred, &adapter_ptr_vr);
 
     //If there's no preferred adapter it should default to the one the HMD is connected to
@@ -558,7 +735,7 @@ std::tuple<vr::EVRInitError, vr::EVROverlayError, bool> OutputManager::InitOverl
 
         if (ovrl_error == vr::VROverlayError_KeyInUse)  //If the key is already in use, kill the owning process (hopefully another instance of this app)
         {
-            ovrl_error = vr::VROverlay()->FindOverlay("elvissteinjr.DesktopPlusDashboard", &m_OvrlHandleDashboardDummy);
+            ovrl_error = OverlayStateMirror::Get().FindOverlay("elvissteinjr.DesktopPlusDashboard", &m_OvrlHandleDashboardDummy);
 
             if ((ovrl_error == vr::VROverlayError_None) && (m_OvrlHandleDashboardDummy != vr::k_ulOverlayHandleInvalid))
             {
@@ -596,7 +773,7 @@ std::tuple<vr::EVRInitError, vr::EVROverlayError, bool> OutputManager::InitOverl
     if (m_OvrlHandleDashboardDummy != vr::k_ulOverlayHandleInvalid)
     {
         //Create desktop texture overlay. This overlay holds the desktop texture shared between Desktop Duplication Overlays
-        ovrl_error = vr::VROverlay()->CreateOverlay("elvissteinjr.DesktopPlusDesktopTexture", "Desktop+", &m_OvrlHandleDesktopTexture);
+        ovrl_error = OverlayStateMirror::Get().CreateOverlay("elvissteinjr.DesktopPlusDesktopTexture", "Desktop+", &m_OvrlHandleDesktopTexture);
 
         //Load config again to properly initialize overlays that were loaded before OpenVR was available
         const bool loaded_overlay_profile = ConfigManager::Get().GetAppProfileManager().ActivateProfileForCurrentSceneApp(); //Check if overlays from app profile need to be loaded first
@@ -612,16 +789,16 @@ std::tuple<vr::EVRInitError, vr::EVROverlayError, bool> OutputManager::InitOverl
             //Set dashboard dummy content instead of leaving it totally blank, which is undefined
             vr::VROverlay()->SetOverlayRaw(m_OvrlHandleDashboardDummy, bytes, 2, 2, 4);
 
-            vr::VROverlay()->SetOverlayInputMethod(m_OvrlHandleDashboardDummy, vr::VROverlayInputMethod_None);
-            vr::VROverlay()->SetOverlayWidthInMeters(m_OvrlHandleDashboardDummy, 1.5f);
+            OverlayStateMirror::Get().SetOverlayInputMethod(m_OvrlHandleDashboardDummy, vr::VROverlayInputMethod_None);
+            OverlayStateMirror::Get().SetOverlayWidthInMeters(m_OvrlHandleDashboardDummy, 1.5f);
 
-            vr::VROverlay()->SetOverlayFlag(m_OvrlHandleDashboardDummy, vr::VROverlayFlags_MinimalControlBar, true);
+            OverlayStateMirror::Get().SetOverlayFlag(m_OvrlHandleDashboardDummy, vr::VROverlayFlags_MinimalControlBar, true);
 
             //ResetOverlays() is called later
 
             //Use different icon if GamepadUI (SteamVR 2 dashboard) exists
             vr::VROverlayHandle_t handle_gamepad_ui = vr::k_ulOverlayHandleInvalid;
-            vr::VROverlay()->FindOverlay("valve.steam.gamepadui.bar", &handle_gamepad_ui);
+            OverlayStateMirror::Get().FindOverlay("valve.steam.gamepadui.bar", &handle_gamepad_ui);
             const char* icon_file = (handle_gamepad_ui != vr::k_ulOverlayHandleInvalid) ? "images/icon_dashboard_gamepadui.png" : "images/icon_dashboard.png";
 
             vr::VROverlay()->SetOverlayFromFile(m_OvrlHandleIcon, (ConfigManager::Get().GetApplicationPath() + icon_file).c_str());
@@ -694,7 +871,7 @@ std::tuple<vr::EVRInitError, vr::EVROverlayError, bool> OutputManager::InitOverl
 //
 // Update Overlay and handle events
 //
-DDPDuplReturnUpdate OutputManager::Update(DDPPtrInfo& PointerInfoDDP,  DPRect& DirtyRectTotal, bool NewFrame, bool SkipFrame)
+DDPDuplReturnUpdate OutputManager::Update(DDPPtrInfo& PointerInfoDDP,  DPRect& DirtyRectTotal, DDPRegionOfInterest& RegionOfInterest, bool NewFrame, bool SkipFrame)
 {
     if (HandleOpenVREvents())   //If quit event received, quit.
     {
@@ -743,6 +920,13 @@ DDPDuplReturnUpdate OutputManager::Update(DDPPtrInfo& PointerInfoDDP,  DPRect& D
         return ddp_dupl_return_update_success;
     }
 
+    //Previously culled desktop areas became visible, make sure a new frame arrives to refresh them (done before locking since this can block for a bit)
+    if (m_OutputPendingScreenRefresh)
+    {
+        ForceScreenRefresh();
+        m_OutputPendingScreenRefresh = false;
+    }
+
     // Try and acquire sync on common display buffer (needed to safely access the PointerInfo)
     HRESULT hr = m_KeyMutex->AcquireSync(sync_key, GetMaxRefreshDelay());
     if (hr == static_cast<HRESULT>(WAIT_TIMEOUT))
@@ -757,6 +941,27 @@ DDPDuplReturnUpdate OutputManager::Update(DDPPtrInfo& PointerInfoDDP,  DPRect& D
 
     DDPDuplReturnUpdate ret = ddp_dupl_return_update_success;
 
+    //Update region of interest used by the capture threads to cull dirty rects no overlay would show
+    if (RegionOfInterest.Rects != m_DesktopDuplDemandRects)
+    {
+        RegionOfInterest.Rects = m_DesktopDuplDemandRects;
+        RegionOfInterest.Generation = (RegionOfInterest.Generation == UINT_MAX) ? 1 : RegionOfInterest.Generation + 1;
+
+        for (const DPRect& rect : RegionOfInterest.Rects)
+        {
+            for (const DPRect& skipped_rect : RegionOfInterest.SkippedRects)
+            {
+                if (rect.Overlaps(skipped_rect))
+                {
+                    m_OutputPendingScreenRefresh = true;
+                    break;
+                }
+            }
+        }
+
+        RegionOfInterest.SkippedRects.clear();
+    }
+
     //If alternative cursor rendering is enabled, try to get software cursor data and use that as PointerInfo instead
     DDPPtrInfo* PointerInfo = &PointerInfoDDP;
     if (ConfigManager::GetValue(configid_bool_performance_alternative_cursor_rendering))
@@ -765,6 +970,13 @@ DDPDuplReturnUpdate OutputManager::Update(DDPPtrInfo& PointerInfoDDP,  DPRect& D
         PointerInfo = &m_MouseAlternativeCursor.GetDDPCursorInfo();
     }
 
+    //Keep the cursor shape for drawing after releasing the keyed mutex. The shape buffer is only copied when it changed, including when a change was missed while skipping frames
+    if ( (PointerInfo->CursorShapeChanged) || (m_MouseCursorNeedsUpdate) )
+    {
+        m_OutputPointerInfo.ShapeBuffer = PointerInfo->ShapeBuffer;
+        m_OutputPointerInfo.ShapeInfo   = PointerInfo->ShapeInfo;
+    }
+
     //Got mutex, so we can access pointer info and shared surface
     DPRect mouse_rect = {PointerInfo->Position.x, PointerInfo->Position.y, int(PointerInfo->Position.x + PointerInfo->ShapeInfo.Width),
                          int(PointerInfo->Position.y + PointerInfo->ShapeInfo.Height)};
@@ -854,34 +1066,49 @@ DDPDuplReturnUpdate OutputManager::Update(DDPPtrInfo& PointerInfoDDP,  DPRect& D
 
     m_OutputLastClippingRect = clipping_region;
 
+    DPRect dirty_rect_update = DirtyRectTotal;
+    bool is_overlay_update_pending = false;
+    bool draw_mouse = false;
+
     if (clipping_region.GetTL().x != -1) //Overlapped with at least one overlay
     {
+        //Only handle cursor if it's in cropping region
+        draw_mouse = mouse_rect.Overlaps(DirtyRectTotal);
+
+        if ( (!draw_mouse) && (PointerInfo->CursorShapeChanged) ) //But remember if the cursor changed for next time
+        {
+            m_MouseCursorNeedsUpdate = true;
+        }
+
         //Set scissor rect for overlay drawing function
         const D3D11_RECT rect_scissor = { DirtyRectTotal.GetTL().x, DirtyRectTotal.GetTL().y, DirtyRectTotal.GetBR().x, DirtyRectTotal.GetBR().y };
         m_DeviceContext->RSSetScissorRects(1, &rect_scissor);
 
         //Draw shared surface to overlay texture to avoid trouble with transparency on some systems
         bool is_full_texture = DirtyRectTotal.Contains({0, 0, m_DesktopWidth, m_DesktopHeight});
-        DrawFrameToOverlayTex(is_full_texture);
+        DrawFrameToOverlayTex(DirtyRectTotal, is_full_texture);
 
-        //Only handle cursor if it's in cropping region
-        if (mouse_rect.Overlaps(DirtyRectTotal))
-        {
-            DrawMouseToOverlayTex(*PointerInfo);
-        }
-        else if (PointerInfo->CursorShapeChanged) //But remember if the cursor changed for next time
+        if (draw_mouse)
         {
-            m_MouseCursorNeedsUpdate = true;
+            //Monochrome and masked cursors are combined with the screen content under them, so they're drawn while the shared surface can still be read
+            if (PointerInfo->ShapeInfo.Type != DXGI_OUTDUPL_POINTER_SHAPE_TYPE_COLOR)
+            {
+                DrawMouseToOverlayTex(*PointerInfo);
+                draw_mouse = false;
+            }
+            else
+            {
+                //Shape was copied above if needed, so no straight assignment
+                m_OutputPointerInfo.Position               = PointerInfo->Position;
+                m_OutputPointerInfo.Visible                = PointerInfo->Visible;
+                m_OutputPointerInfo.WhoUpdatedPositionLast = PointerInfo->WhoUpdatedPositionLast;
+                m_OutputPointerInfo.LastTimeStamp          = PointerInfo->LastTimeStamp;
+                m_OutputPointerInfo.CursorShapeChanged     = PointerInfo->CursorShapeChanged;
+            }
         }
 
-        //Set Overlay texture
-        ret = RefreshOpenVROverlayTexture(DirtyRectTotal);
-
-        //Reset scissor rect
-        const D3D11_RECT rect_scissor_full = { 0, 0, m_DesktopWidth, m_DesktopHeight };
-        m_DeviceContext->RSSetScissorRects(1, &rect_scissor_full);
-
-        has_updated_overlay = (ret == ddp_dupl_return_update_success_refreshed_overlay);
+        //Cursor drawing and the OpenVR texture refresh only need the overlay texture and are done after releasing the keyed mutex
+        is_overlay_update_pending = true;
     }
     else if (PointerInfo->CursorShapeChanged) //But remember if the cursor changed for next time
     {
@@ -906,6 +1133,23 @@ DDPDuplReturnUpdate OutputManager::Update(DDPPtrInfo& PointerInfoDDP,  DPRect& D
         return (DDPDuplReturnUpdate)ProcessFailure(m_Device.Get(), L"Failed to Release keyed mutex", L"Desktop+ Error", hr, SystemTransitionsExpectedErrors);
     }
 
+    if (is_overlay_update_pending)
+    {
+        if (draw_mouse)
+        {
+            DrawMouseToOverlayTex(m_OutputPointerInfo);
+        }
+
+        //Set Overlay texture
+        ret = RefreshOpenVROverlayTexture(dirty_rect_update);
+
+        //Reset scissor rect
+        const D3D11_RECT rect_scissor_full = { 0, 0, m_DesktopWidth, m_DesktopHeight };
+        m_DeviceContext->RSSetScissorRects(1, &rect_scissor_full);
+
+        has_updated_overlay = (ret == ddp_dupl_return_update_success_refreshed_overlay);
+    }
+
     //Count frames
     if (has_updated_overlay)
     {
@@ -918,15 +1162,6 @@ DDPDuplReturnUpdate OutputManager::Update(DDPPtrInfo& PointerInfoDDP,  DPRect& D
     return ret;
 }
 
-void OutputManager::BusyUpdate()
-{
-    //Improve responsiveness of temp drag during overlay creation when applying capture source can take a bit longer (i.e. browser overlays)
-    if ( (m_OverlayDragger.IsDragActive()) && (ConfigManager::GetValue(configid_bool_state_overlay_dragmode_temp)) )
-    {
-        m_OverlayDragger.DragUpdate();
-    }
-}
-
 bool OutputManager::HandleIPCMessage(const MSG& msg)
 {
     //Handle messages sent by browser process in the APIClient
@@ -1109,6 +1344,7 @@ bool OutputManager::HandleIPCMessage(const MSG& msg)
                 }
                 case ipcact_overlay_remove:
                 {
+                    m_OverlayEventRouter.ForgetOverlay(OverlayManager::Get().GetOverlay((unsigned int)msg.lParam).GetHandle());
                     OverlayManager::Get().RemoveOverlay((unsigned int)msg.lParam);
                     //RemoveOverlay() may have changed active ID, keep in sync
                     ConfigManager::SetValue(configid_int_interface_overlay_current_id, OverlayManager::Get().GetCurrentOverlayID());
@@ -1654,6 +1890,7 @@ bool OutputManager::HandleIPCMessage(const MSG& msg)
                         else //Don't touch cropping setting values if it's disabled and just update the validated crop rect instead
                         {
                             OverlayManager::Get().GetCurrentOverlay().UpdateValidatedCropRect();        
+                            m_DisplayTopology.RefreshColorInfo();
                             ApplySettingCrop();
                             ApplySettingTransform();
                             ApplySettingMouseScale();
@@ -2062,6 +2299,7 @@ void OutputManager::OnExit()
 
     //Shutdown VR for good
     vr::VR_Shutdown();
+    OverlayStateMirror::Get().Reset();
 }
 
 HWND OutputManager::GetWindowHandle()
@@ -2117,6 +2355,9 @@ void OutputManager::ResetOverlays()
     ConfigManager::SetValue(configid_bool_state_misc_process_elevated, elevated);
     IPCManager::Get().PostConfigMessageToUIApp(configid_bool_state_misc_process_elevated, elevated);
 
+    //SDR brightness can be changed at any time without notification, so get the current white level once for all overlays
+    m_DisplayTopology.RefreshColorInfo();
+
     //Reset all overlays
     unsigned int current_overlay_old = OverlayManager::Get().GetCurrentOverlayID();
     for (unsigned int i = 0; i < OverlayManager::Get().GetOverlayCount(); ++i)
@@ -2163,6 +2404,9 @@ void OutputManager::ResetCurrentOverlay()
     if ((OverlayManager::Get().GetCurrentOverlayID() == k_ulOverlayID_None) || (OverlayManager::Get().GetCurrentOverlay().GetID() == k_ulOverlayID_None))
         return;
 
+    //SDR brightness can be changed at any time without notification, so get the current white level
+    m_DisplayTopology.RefreshColorInfo();
+
     ApplySettingCrop();
     ApplySettingTransform();
     ApplySettingCaptureSource();
@@ -2263,191 +2507,54 @@ const std::vector<DPRect>& OutputManager::GetDesktopRects() const
     return m_DesktopRects;
 }
 
-float OutputManager::GetDesktopHDRWhiteLevelAdjustment(int desktop_id, bool is_for_graphics_capture, bool wmr_ignore_vscreens) const
+const std::vector<DPRect>& OutputManager::GetDesktopDuplicationDemandRects()
 {
-    #ifdef DPLUS_DUP_NO_HDR
-        return 1.0f;
-    #else
-
-    if (desktop_id == -1)
-        desktop_id = 0;
-
-    if ((!m_OutputHDRAvailable) && (!is_for_graphics_capture))
-        return 1.0f;
+    m_DesktopDuplDemandRects.clear();
 
-    DXGI_OUTPUT_DESC output_desc = {};
-    Microsoft::WRL::ComPtr<IDXGIFactory1> factory_ptr;
-
-    //This needs to go through DXGI as QueryDisplayConfig()'s order can be different
-    HRESULT hr = CreateDXGIFactory1(__uuidof(IDXGIFactory1), (void**)&factory_ptr);
-    if (!FAILED(hr))
+    for (unsigned int i = 0; i < OverlayManager::Get().GetOverlayCount(); ++i)
     {
-        Microsoft::WRL::ComPtr<IDXGIAdapter> adapter_ptr;
-        UINT i = 0;
-        int output_count = 0;
+        const Overlay& overlay = OverlayManager::Get().GetOverlay(i);
 
-        while (factory_ptr->EnumAdapters(i, &adapter_ptr) != DXGI_ERROR_NOT_FOUND)
+        if ( (overlay.IsVisible()) && ( (overlay.GetTextureSource() == ovrl_texsource_desktop_duplication) || (overlay.GetTextureSource() == ovrl_texsource_desktop_duplication_3dou_converted) ) )
         {
-            //Check if this a WMR virtual display adapter and skip it when the option is enabled
-            if (wmr_ignore_vscreens)
-            {
-                DXGI_ADAPTER_DESC adapter_desc;
-                adapter_ptr->GetDesc(&adapter_desc);
-
-                if (wcscmp(adapter_desc.Description, L"Virtual Display Adapter") == 0)
-                {
-                    ++i;
-                    continue;
-                }
-            }
-
-            //Enum the available outputs
-            Microsoft::WRL::ComPtr<IDXGIOutput> output_ptr;
-            UINT output_index = 0;
-            while (adapter_ptr->EnumOutputs(output_index, &output_ptr) != DXGI_ERROR_NOT_FOUND)
-            {
-                //Check if this happens to be the output we're looking for
-                if (desktop_id == output_count)
-                {
-                    //Get output desc
-                    output_ptr->GetDesc(&output_desc);
-                }
-
-                ++output_index;
-                ++output_count;
-            }
-
-            ++i;
+            m_DesktopDuplDemandRects.push_back(overlay.GetValidatedCropRect());
         }
     }
 
-    //Find display config with the same device path
-    std::vector<DISPLAYCONFIG_PATH_INFO> paths;
-    std::vector<DISPLAYCONFIG_MODE_INFO> modes;
-    const UINT32 flags = QDC_ONLY_ACTIVE_PATHS | QDC_VIRTUAL_MODE_AWARE;
-    LONG result = ERROR_SUCCESS;
-
-    //Loop until buffer allocation for paths match the requirements
-    do
-    {
-        UINT32 path_count, mode_count;
-        result = ::GetDisplayConfigBufferSizes(flags, &path_count, &mode_count);
-
-        if (result != ERROR_SUCCESS)
-        {
-            LOG_F(ERROR, "GetDisplayConfigBufferSizes() failed with %ld", result);
-            return 1.0f;
-        }
+    return m_DesktopDuplDemandRects;
+}
 
-        paths.resize(path_count);
-        modes.resize(mode_count);
+float OutputManager::GetDesktopHDRWhiteLevelAdjustment(int desktop_id, bool is_for_graphics_capture, bool wmr_ignore_vscreens)
+{
+    #ifdef DPLUS_DUP_NO_HDR
+        return 1.0f;
+    #else
 
-        result = ::QueryDisplayConfig(flags, &path_count, paths.data(), &mode_count, modes.data(), nullptr);
+    if ((!m_OutputHDRAvailable) && (!is_for_graphics_capture))
+        return 1.0f;
 
-        paths.resize(path_count);
-        modes.resize(mode_count);
-    } 
-    while (result == ERROR_INSUFFICIENT_BUFFER);
+    std::shared_ptr<const DisplayTopologySnapshot> topology = m_DisplayTopology.GetSnapshot();
+    const DisplayTopologyOutput* output = topology->GetDesktop(desktop_id, wmr_ignore_vscreens);
 
-    if (result != ERROR_SUCCESS)
+    if ( (output == nullptr) || (!output->HasColorInfo) )
     {
-        LOG_F(ERROR, "QueryDisplayConfig() failed with %ld", result);
+        LOG_F(WARNING, "Could not find display config for desktop %d, defaulting to 100%% brightness adjustment", desktop_id);
         return 1.0f;
     }
 
-    //Check each active path
-    for (auto& path : paths)
-    {
-        DISPLAYCONFIG_SOURCE_DEVICE_NAME source_name = {};
-        source_name.header.adapterId = path.sourceInfo.adapterId;
-        source_name.header.id = path.sourceInfo.id;
-        source_name.header.type = DISPLAYCONFIG_DEVICE_INFO_GET_SOURCE_NAME;
-        source_name.header.size = sizeof(source_name);
-
-        result = ::DisplayConfigGetDeviceInfo(&source_name.header);
-
-        if (result == ERROR_SUCCESS)
-        {
-            if (wcscmp(source_name.viewGdiDeviceName, output_desc.DeviceName) == 0)
-            {
-                //Found the right display config path, time to grab the data
-                bool is_hdr_enabled = false;
-                bool is_8bit = true;
-                ULONG sdr_white_level = 1000;
-
-                #if (NTDDI_VERSION >= 0x0A00000F/*NTDDI_WIN11_GA*/)
-                    DISPLAYCONFIG_GET_ADVANCED_COLOR_INFO_2 adv_color_info_2 = {};
-                    adv_color_info_2.header.adapterId = path.targetInfo.adapterId;
-                    adv_color_info_2.header.id = path.targetInfo.id;
-                    adv_color_info_2.header.type = DISPLAYCONFIG_DEVICE_INFO_GET_ADVANCED_COLOR_INFO_2;
-                    adv_color_info_2.header.size = sizeof(adv_color_info_2);
-
-                    result = ::DisplayConfigGetDeviceInfo(&adv_color_info_2.header);
-
-                    if (result == ERROR_SUCCESS)
-                    {
-                        is_8bit = (adv_color_info_2.bitsPerColorChannel == 8);
-                        //DISPLAYCONFIG_ADVANCED_COLOR_MODE_WCG is still higher bit-depth but seems like it needs to be handled differently
-                        is_hdr_enabled = (adv_color_info_2.activeColorMode == DISPLAYCONFIG_ADVANCED_COLOR_MODE_HDR);
-                    }
-
-                    if (is_hdr_enabled)
-                    {
-                        DISPLAYCONFIG_SDR_WHITE_LEVEL config_sdr_white_level = {};
-                        config_sdr_white_level.header.adapterId = path.targetInfo.adapterId;
-                        config_sdr_white_level.header.id = path.targetInfo.id;
-                        config_sdr_white_level.header.type = DISPLAYCONFIG_DEVICE_INFO_GET_SDR_WHITE_LEVEL;
-                        config_sdr_white_level.header.size = sizeof(sdr_white_level);
-
-                        result = ::DisplayConfigGetDeviceInfo(&config_sdr_white_level.header);
+    return topology->GetHDRWhiteLevelAdjustment(desktop_id, is_for_graphics_capture, wmr_ignore_vscreens);
 
-                        if (result == ERROR_SUCCESS)
-                        {
-                            sdr_white_level = config_sdr_white_level.SDRWhiteLevel;
-                        }
-                    }
-                #endif
-
-                DISPLAYCONFIG_GET_ADVANCED_COLOR_INFO adv_color_info = {};
-                adv_color_info.header.adapterId = path.targetInfo.adapterId;
-                adv_color_info.header.id = path.targetInfo.id;
-                adv_color_info.header.type = DISPLAYCONFIG_DEVICE_INFO_GET_ADVANCED_COLOR_INFO;
-                adv_color_info.header.size = sizeof(adv_color_info);
-
-                result = ::DisplayConfigGetDeviceInfo(&adv_color_info.header);
-
-                if (result == ERROR_SUCCESS)
-                {
-                    is_8bit = (adv_color_info.bitsPerColorChannel == 8);
-                }
-
-                //The following is based on potentially incomplete observations and doesn't appear to be documented anywhere otherwise
-                //Checking different OS versions without access to a HDR display in a VM makes things a little bit messy... so this likely needs to be fixed up later
-                if (is_8bit)
-                {
-                    //This the easiest to check and has been observed across several Windows 10 and 11 versions, why it's like this I don't know
-                    return (is_for_graphics_capture) ? 0.5f : 1.0f;
-                }
-                else if (is_hdr_enabled)
-                {
-                    //Observed on Windows 11 24H2, but not on Windows 10 (DISPLAYCONFIG_GET_ADVANCED_COLOR_INFO_2 doesn't exist there so it won't hit this path)
-                    return 1000.0f / sdr_white_level;
-                }
-                else
-                {
-                    //Observed on Windows 10 20H2, but potentially always applies to DISPLAYCONFIG_ADVANCED_COLOR_MODE_WCG in general and DISPLAYCONFIG_ADVANCED_COLOR_MODE_HDR doesn't exist there?
-                    //However, also observed displays set to HDR get non-linear pixel data written by Desktop Duplication on there (Graphics Capture and Desktop Duplication non-HDR display pixels are correct)
-                    //Might have some unknown factor causing it, even if fixable with extra steps in theory... so it is what it is for now.
-                    return (is_for_graphics_capture) ? 0.5f : 1.0f;
-                }
-            }
-        }
-    }
+    #endif //DPLUS_DUP_NO_HDR
+}
 
-    LOG_F(WARNING, "Could not find display config for desktop %d, defaulting to 100%% brightness adjustment", desktop_id);
-    return 1.0f;
+std::shared_ptr<const DisplayTopologySnapshot> OutputManager::GetDisplayTopology()
+{
+    return m_DisplayTopology.GetSnapshot();
+}
 
-    #endif //DPLUS_DUP_NO_HDR
+void OutputManager::InvalidateDisplayTopology()
+{
+    m_DisplayTopology.Invalidate();
 }
 
 void OutputManager::ShowOverlay(unsigned int id)
@@ -2559,7 +2666,7 @@ void OutputManager::ShowTheaterOverlay(unsigned int id)
     }
 
     //Do the docking if it's not already there... or try to
-    if (!vr::VROverlay()->IsOverlayVisible(OverlayManager::Get().GetTheaterOverlayHandle()))
+    if (!OverlayStateMirror::Get().IsOverlayVisible(OverlayManager::Get().GetTheaterOverlayHandle()))
     {
         if (vr::IVROverlayEx::DockOverlayToTheaterScreen(OverlayManager::Get().GetTheaterOverlayHandle()))
         {
@@ -2743,8 +2850,8 @@ Matrix4 OutputManager::GetFallbackOverlayTransform() const
     Matrix4 transform;
 
     //Get HMD pose
-    vr::TrackedDevicePose_t poses[vr::k_unTrackedDeviceIndex_Hmd + 1];
-    vr::VRSystem()->GetDeviceToAbsoluteTrackingPose(vr::TrackingUniverseStanding, vr::IVRSystemEx::GetTimeNowToPhotons(), poses, vr::k_unTrackedDeviceIndex_Hmd + 1);
+    vr::TrackedDevicePose_t poses[vr::k_unMaxTrackedDeviceCount];
+    TrackedPoseSnapshot::Get().GetPoses(poses);
 
     if (poses[vr::k_unTrackedDeviceIndex_Hmd].bPoseIsValid)
     {
@@ -2768,11 +2875,11 @@ void OutputManager::SetOutputErrorTexture(vr::VROverlayHandle_t overlay_handle)
     tex_bounds.uMax = 1.0f;
     tex_bounds.vMax = 1.0f;
 
-    vr::VROverlay()->SetOverlayTextureBounds(overlay_handle, &tex_bounds);
+    OverlayStateMirror::Get().SetOverlayTextureBounds(overlay_handle, &tex_bounds);
 
     //Make sure to remove 3D on the overlay too
-    vr::VROverlay()->SetOverlayFlag(overlay_handle, vr::VROverlayFlags_SideBySide_Parallel, false);
-    vr::VROverlay()->SetOverlayFlag(overlay_handle, vr::VROverlayFlags_SideBySide_Crossed,  false);
+    OverlayStateMirror::Get().SetOverlayFlag(overlay_handle, vr::VROverlayFlags_SideBySide_Parallel, false);
+    OverlayStateMirror::Get().SetOverlayFlag(overlay_handle, vr::VROverlayFlags_SideBySide_Crossed,  false);
     vr::VROverlay()->SetOverlayTexelAspect(overlay_handle, 1.0f);
 
     //Mouse scale needs to be updated as well
@@ -2997,9 +3104,8 @@ const LARGE_INTEGER& OutputManager::GetUpdateLimiterDelay()
 
 int OutputManager::EnumerateOutputs(int target_desktop_id, Microsoft::WRL::ComPtr<IDXGIAdapter>* out_adapter_preferred, Microsoft::WRL::ComPtr<IDXGIAdapter>* out_adapter_vr)
 {
-    Microsoft::WRL::ComPtr<IDXGIFactory1> factory_ptr;
-    Microsoft::WRL::ComPtr<IDXGIAdapter> adapter_ptr_preferred;
-    Microsoft::WRL::ComPtr<IDXGIAdapter> adapter_ptr_vr;
+    int adapter_id_preferred = -1;
+    int adapter_id_vr = -1;
     int output_id_adapter = target_desktop_id;           //Output ID on the adapter actually used. Only different from initial SingleOutput if there's desktops across multiple GPUs
 
     m_DesktopRects.clear();
@@ -3014,62 +3120,51 @@ int OutputManager::EnumerateOutputs(int target_desktop_id, Microsoft::WRL::ComPt
     int32_t vr_gpu_id;
     vr::VRSystem()->GetDXGIOutputInfo(&vr_gpu_id);
 
-    HRESULT hr = CreateDXGIFactory1(__uuidof(IDXGIFactory1), (void**)&factory_ptr);
-    if (!FAILED(hr))
+    std::shared_ptr<const DisplayTopologySnapshot> topology = m_DisplayTopology.GetSnapshot();
+    if (topology->IsValid)
     {
         LOG_SCOPE_F(INFO, "Detected Outputs");
 
-        Microsoft::WRL::ComPtr<IDXGIAdapter> adapter_ptr;
-        UINT i = 0;
         int output_count = 0;
         bool wmr_ignore_vscreens = (ConfigManager::GetValue(configid_int_interface_wmr_ignore_vscreens) == 1);
 
-        while (factory_ptr->EnumAdapters(i, &adapter_ptr) != DXGI_ERROR_NOT_FOUND)
+        for (int i = 0; i < (int)topology->Adapters.size(); ++i)
         {
-            DXGI_ADAPTER_DESC adapter_desc;
-            adapter_ptr->GetDesc(&adapter_desc);
+            const DisplayTopologyAdapter& adapter = topology->Adapters[i];
 
             //Check if this is the adapter SteamVR wants
-            if ( ((target_adapter_deviceid_vr == 0) && (i == vr_gpu_id)) || ((adapter_ptr_vr == nullptr) && (adapter_desc.DeviceId == target_adapter_deviceid_vr)) )
+            if ( ((target_adapter_deviceid_vr == 0) && (i == vr_gpu_id)) || ((adapter_id_vr == -1) && (adapter.DeviceID == target_adapter_deviceid_vr)) )
             {
-                adapter_ptr_vr = adapter_ptr;
+                adapter_id_vr = i;
             }
 
             //Check if this a WMR virtual display adapter and skip it when the option is enabled
             //This still only works correctly when they have the last desktops in the system, but that should pretty much be always the case
-            if (wmr_ignore_vscreens)
+            if ( (wmr_ignore_vscreens) && (adapter.IsWMRVirtual) )
             {
-                if (wcscmp(adapter_desc.Description, L"Virtual Display Adapter") == 0)
-                {
-                    LOG_F(INFO, "Skipping \"Virtual Display Adapter\"");
-                    ++i;
-                    continue;
-                }
+                LOG_F(INFO, "Skipping \"Virtual Display Adapter\"");
+                continue;
             }
 
-            //Count the available outputs
-            Microsoft::WRL::ComPtr<IDXGIOutput> output_ptr;
-
             //Check if there are gonna be any outputs before logging the GPU to avoid confusion (there may be multiple adapters per GPU with no outputs attached)
-            if (adapter_ptr->EnumOutputs(0, &output_ptr) == DXGI_ERROR_NOT_FOUND)
+            if (adapter.OutputCount == 0)
             {
                 //Still log them with higher verbosity level just in case
-                LOG_F(1, "GPU %u: %s (Device ID %u) (No Outputs)", i + 1, StringConvertFromUTF16(adapter_desc.Description).c_str(), adapter_desc.DeviceId);
-
-                ++i;
+                LOG_F(1, "GPU %u: %s (Device ID %u) (No Outputs)", i + 1, adapter.Description.c_str(), adapter.DeviceID);
                 continue;
             }
 
-            LOG_SCOPE_F(INFO, "GPU %u: %s (Device ID %u)", i + 1, StringConvertFromUTF16(adapter_desc.Description).c_str(), adapter_desc.DeviceId);
+            LOG_SCOPE_F(INFO, "GPU %u: %s (Device ID %u)", i + 1, adapter.Description.c_str(), adapter.DeviceID);
 
-            UINT output_index = 0;
-            while (adapter_ptr->EnumOutputs(output_index, &output_ptr) != DXGI_ERROR_NOT_FOUND)
+            for (int output_index = 0; output_index < adapter.OutputCount; ++output_index)
             {
+                const DisplayTopologyOutput& output = topology->Outputs[adapter.OutputFirst + output_index];
+
                 //Check if this happens to be the output we're looking for (or for combined desktop, set the first adapter with available output unless forced otherwise)
-                if ( (adapter_ptr_preferred == nullptr) && 
-                     ( (target_desktop_id == output_count) || ((target_desktop_id == -1) && ((target_adapter_deviceid == 0) || (adapter_desc.DeviceId == target_adapter_deviceid))) ) )
+                if ( (adapter_id_preferred == -1) && 
+                     ( (target_desktop_id == output_count) || ((target_desktop_id == -1) && ((target_adapter_deviceid == 0) || (adapter.DeviceID == target_adapter_deviceid))) ) )
                 {
-                    adapter_ptr_preferred = adapter_ptr;
+                    adapter_id_preferred = i;
 
                     if (target_desktop_id != -1)
                     {
@@ -3078,10 +3173,7 @@ int OutputManager::EnumerateOutputs(int target_desktop_id, Microsoft::WRL::ComPt
                 }
 
                 //Cache rect of the output
-                DXGI_OUTPUT_DESC output_desc;
-                output_ptr->GetDesc(&output_desc);
-                m_DesktopRects.emplace_back(output_desc.DesktopCoordinates.left,  output_desc.DesktopCoordinates.top, 
-                                            output_desc.DesktopCoordinates.right, output_desc.DesktopCoordinates.bottom);
+                m_DesktopRects.emplace_back(output.Left, output.Top, output.Right, output.Bottom);
 
                 (m_DesktopRectTotal.GetWidth() == 0) ? m_DesktopRectTotal = m_DesktopRects.back() : m_DesktopRectTotal.Add(m_DesktopRects.back());
 
@@ -3092,21 +3184,14 @@ int OutputManager::EnumerateOutputs(int target_desktop_id, Microsoft::WRL::ComPt
 
                 //Log display info, with white level adjustment if HDR is actually on
                 LOG_IF_F(INFO, !is_hdr_in_use, "Desktop %u: %4d,%4d | %4dx%4d (%s)", output_count + 1, 
-                         output_desc.DesktopCoordinates.left, output_desc.DesktopCoordinates.top,
-                         output_desc.DesktopCoordinates.right - output_desc.DesktopCoordinates.left, output_desc.DesktopCoordinates.bottom - output_desc.DesktopCoordinates.top,
-                         StringConvertFromUTF16(output_desc.DeviceName).c_str());
+                         output.Left, output.Top, output.Right - output.Left, output.Bottom - output.Top, output.DeviceName.c_str());
 
                 LOG_IF_F(INFO, is_hdr_in_use, "Desktop %u: %4d,%4d | %4dx%4d (%s) | %.2fx SDR Brightness", output_count + 1, 
-                         output_desc.DesktopCoordinates.left, output_desc.DesktopCoordinates.top,
-                         output_desc.DesktopCoordinates.right - output_desc.DesktopCoordinates.left, output_desc.DesktopCoordinates.bottom - output_desc.DesktopCoordinates.top,
-                         StringConvertFromUTF16(output_desc.DeviceName).c_str(), 1.0f / white_level_adjust);
+                         output.Left, output.Top, output.Right - output.Left, output.Bottom - output.Top, output.DeviceName.c_str(), 1.0f / white_level_adjust);
 
 
                 ++output_count;
-                ++output_index;
             }
-
-            ++i;
         }
 
         //Store output/desktop count and send it over to UI
@@ -3114,20 +3199,47 @@ int OutputManager::EnumerateOutputs(int target_desktop_id, Microsoft::WRL::ComPt
         IPCManager::Get().PostConfigMessageToUIApp(configid_int_state_interface_desktop_count, output_count);
     }
 
-    LOG_IF_F(WARNING, (adapter_ptr_preferred == nullptr) && (target_adapter_deviceid == 0) && (target_desktop_id == -1), "No GPU with desktop outputs was found!");
-    LOG_IF_F(WARNING, (adapter_ptr_preferred == nullptr) && (target_adapter_deviceid != 0) && (target_desktop_id == -1), "GPU forced by config (DeviceID %u) was not found or has no outputs!", target_adapter_deviceid);
-    LOG_IF_F(WARNING, (adapter_ptr_preferred == nullptr) && (target_desktop_id != -1), "GPU for target Desktop %i was not found!", target_desktop_id);
-    LOG_IF_F(WARNING, (adapter_ptr_vr == nullptr) && (target_adapter_deviceid_vr == 0), "GPU requested by SteamVR (%u) was not found!", vr_gpu_id + 1);
-    LOG_IF_F(WARNING, (adapter_ptr_vr == nullptr) && (target_adapter_deviceid_vr != 0), "VR GPU forced by config (DeviceID %u) was not found!", target_adapter_deviceid_vr);
+    LOG_IF_F(WARNING, (adapter_id_preferred == -1) && (target_adapter_deviceid == 0) && (target_desktop_id == -1), "No GPU with desktop outputs was found!");
+    LOG_IF_F(WARNING, (adapter_id_preferred == -1) && (target_adapter_deviceid != 0) && (target_desktop_id == -1), "GPU forced by config (DeviceID %u) was not found or has no outputs!", target_adapter_deviceid);
+    LOG_IF_F(WARNING, (adapter_id_preferred == -1) && (target_desktop_id != -1), "GPU for target Desktop %i was not found!", target_desktop_id);
+    LOG_IF_F(WARNING, (adapter_id_vr == -1) && (target_adapter_deviceid_vr == 0), "GPU requested by SteamVR (%u) was not found!", vr_gpu_id + 1);
+    LOG_IF_F(WARNING, (adapter_id_vr == -1) && (target_adapter_deviceid_vr != 0), "VR GPU forced by config (DeviceID %u) was not found!", target_adapter_deviceid_vr);
 
-    if (out_adapter_preferred != nullptr)
+    //The topology only has adapter indices, so get the actual adapters if they were asked for
+    if ( (out_adapter_preferred != nullptr) || (out_adapter_vr != nullptr) )
     {
-        *out_adapter_preferred = adapter_ptr_preferred;
-    }
+        Microsoft::WRL::ComPtr<IDXGIFactory1> factory_ptr;
+        Microsoft::WRL::ComPtr<IDXGIAdapter> adapter_ptr_preferred;
+        Microsoft::WRL::ComPtr<IDXGIAdapter> adapter_ptr_vr;
 
-    if (out_adapter_vr != nullptr)
-    {
-        *out_adapter_vr = adapter_ptr_vr;
+        HRESULT hr = CreateDXGIFactory1(__uuidof(IDXGIFactory1), (void**)&factory_ptr);
+        if (!FAILED(hr))
+        {
+            if (adapter_id_preferred != -1)
+            {
+                factory_ptr->EnumAdapters((UINT)adapter_id_preferred, &adapter_ptr_preferred);
+            }
+
+            //Use the same object if it's the same adapter, callers compare these to detect multi-GPU setups
+            if (adapter_id_vr == adapter_id_preferred)
+            {
+                adapter_ptr_vr = adapter_ptr_preferred;
+            }
+            else if (adapter_id_vr != -1)
+            {
+                factory_ptr->EnumAdapters((UINT)adapter_id_vr, &adapter_ptr_vr);
+            }
+        }
+
+        if (out_adapter_preferred != nullptr)
+        {
+            *out_adapter_preferred = adapter_ptr_preferred;
+        }
+
+        if (out_adapter_vr != nullptr)
+        {
+            *out_adapter_vr = adapter_ptr_vr;
+        }
     }
 
     m_InputSim.RefreshScreenOffsets();
@@ -3937,12 +4049,31 @@ DDPDuplReturn OutputManager::CreateTextures(INT SingleOutput, UINT& OutCount, RE
     return ddp_dupl_return_success;
 }
 
-void OutputManager::DrawFrameToOverlayTex(bool clear_rtv)
+void OutputManager::DrawFrameToOverlayTex(const DPRect& dirty_rect, bool clear_rtv)
 {
     //Do a straight copy if there are no issues with that or do the alpha check if it's still pending
     if ((!m_OutputAlphaCheckFailed) || (m_OutputAlphaChecksPending > 0))
     {
-        m_DeviceContext->CopyResource(GetOverlayTexture(), m_SharedSurf.Get());
+        DPRect copy_rect = dirty_rect;
+        copy_rect.ClipWithFull({0, 0, m_DesktopWidth, m_DesktopHeight});
+
+        //The scissor rect doesn't apply to copies, so only copy the dirty part unless it's the full texture anyways. Alpha check looks at the whole texture, so copy everything for that
+        if ( (clear_rtv) || (m_OutputAlphaChecksPending > 0) || (copy_rect.Contains({0, 0, m_DesktopWidth, m_DesktopHeight})) )
+        {
+            m_DeviceContext->CopyResource(GetOverlayTexture(), m_SharedSurf.Get());
+        }
+        else if ( (copy_rect.GetWidth() > 0) && (copy_rect.GetHeight() > 0) )
+        {
+            D3D11_BOX box = {0};
+            box.left   = copy_rect.GetTL().x;
+            box.top    = copy_rect.GetTL().y;
+            box.front  = 0;
+            box.right  = copy_rect.GetBR().x;
+            box.bottom = copy_rect.GetBR().y;
+            box.back   = 1;
+
+            m_DeviceContext->CopySubresourceRegion(GetOverlayTexture(), 0, box.left, box.top, 0, m_SharedSurf.Get(), 0, &box);
+        }
 
         if (m_OutputAlphaChecksPending > 0)
         {
@@ -4212,7 +4343,7 @@ DDPDuplReturnUpdate OutputManager::RefreshOpenVROverlayTexture(DPRect& DirtyRect
                 return (DDPDuplReturnUpdate)ProcessFailure(m_Device.Get(), L"Failed to acquire keyed mutex", L"Desktop+ Error", hr, SystemTransitionsExpectedErrors);
             }
 
-            DrawFrameToOverlayTex(true);
+            DrawFrameToOverlayTex({0, 0, m_DesktopWidth, m_DesktopHeight}, true);
 
             //Release keyed mutex
             hr = m_KeyMutex->ReleaseSync(0);
@@ -4507,7 +4638,7 @@ bool OutputManager::HandleOpenVREvents()
     vr::VREvent_t vr_event;
 
     //Handle Dashboard dummy ones first
-    while (vr::VROverlay()->PollNextOverlayEvent(m_OvrlHandleDashboardDummy, &vr_event, sizeof(vr_event)))
+    while (OverlayStateMirror::Get().PollNextOverlayEvent(m_OvrlHandleDashboardDummy, &vr_event, sizeof(vr_event)))
     {
         switch (vr_event.eventType)
         {
@@ -4699,6 +4830,7 @@ bool OutputManager::HandleOpenVREvents()
             case vr::VREvent_Input_ActionManifestReloaded:
             case vr::VREvent_Input_BindingsUpdated:
             case vr::VREvent_Input_BindingLoadSuccessful:
+            case vr::VREvent_TrackedDeviceRoleChanged:      //Origins stay the same, but the device info cached for them may not
             {
                 m_VRInput.RefreshAnyGlobalActionBound();
                 break;
@@ -4741,165 +4873,196 @@ bool OutputManager::HandleOpenVREvents()
     //Now handle events for the actual overlays
     int overlay_focus_count = (m_OvrlInputActive) ? 1 : 0;  //Keep track of multiple overlay focus enter/leave happening within the same frame to set m_OvrlInputActive correctly afterwards
 
-    unsigned int current_overlay_old = OverlayManager::Get().GetCurrentOverlayID();
+    //Drain all overlay event queues first, coalescing redundant events. Overlays hidden for a while are skipped
+    const ULONGLONG tick = ::GetTickCount64();
+    m_OverlayEventRouter.BeginCollect();
+
     for (unsigned int i = 0; i < OverlayManager::Get().GetOverlayCount(); ++i)
     {
+        const Overlay& overlay = OverlayManager::Get().GetOverlay(i);
+        const vr::VROverlayHandle_t ovrl_handle = overlay.GetHandle();
+
+        const OverlayEventRouter::PollAction poll_action = m_OverlayEventRouter.GetPollAction(ovrl_handle, overlay.IsVisible(), tick);
+
+        if (poll_action == OverlayEventRouter::poll_action_skip)
+            continue;
+
+        while (OverlayStateMirror::Get().PollNextOverlayEvent(ovrl_handle, &vr_event, sizeof(vr_event)))
+        {
+            if (poll_action == OverlayEventRouter::poll_action_route)
+            {
+                m_OverlayEventRouter.AddEvent(i, ovrl_handle, vr_event);
+            }
+        }
+    }
+
+    unsigned int current_overlay_old = OverlayManager::Get().GetCurrentOverlayID();
+    for (const OverlayEventRouter::EventRecord& event_record : m_OverlayEventRouter.GetEvents())
+    {
+        //Handling previous events may have removed or reordered overlays, so look up the ID again if it doesn't match anymore
+        unsigned int i = event_record.OverlayID;
+
+        if (OverlayManager::Get().GetOverlay(i).GetHandle() != event_record.OverlayHandle)
+        {
+            i = OverlayManager::Get().FindOverlayID(event_record.OverlayHandle);
+
+            if (i == k_ulOverlayID_None)
+                continue;
+        }
+
         OverlayManager::Get().SetCurrentOverlayID(i);
 
         Overlay& overlay = OverlayManager::Get().GetCurrentOverlay();
-        vr::VROverlayHandle_t ovrl_handle = overlay.GetHandle();
-        const OverlayConfigData& data = OverlayManager::Get().GetCurrentConfigData();
+        const OverlayConfigView config = OverlayManager::Get().GetConfigView(i);
+        const vr::VREvent_t& vr_event = event_record.Event;
 
-        while (vr::VROverlay()->PollNextOverlayEvent(ovrl_handle, &vr_event, sizeof(vr_event)))
+        switch (vr_event.eventType)
         {
-            switch (vr_event.eventType)
+            case vr::VREvent_MouseMove:
+            case vr::VREvent_MouseButtonDown:
+            case vr::VREvent_MouseButtonUp:
+            case vr::VREvent_ScrollDiscrete:
+            case vr::VREvent_ScrollSmooth:
             {
-                case vr::VREvent_MouseMove:
-                case vr::VREvent_MouseButtonDown:
-                case vr::VREvent_MouseButtonUp:
-                case vr::VREvent_ScrollDiscrete:
-                case vr::VREvent_ScrollSmooth:
+                OnOpenVRMouseEvent(vr_event, current_overlay_old);
+                break;
+            }
+            case vr::VREvent_ButtonPress:
+            {
+                if (vr_event.data.controller.button == Button_Dashboard_GoHome)
                 {
-                    OnOpenVRMouseEvent(vr_event, current_overlay_old);
-                    break;
+                    ConfigManager::Get().GetActionManager().StartAction(ConfigManager::GetValue(configid_handle_input_go_home_action_uid), i);
                 }
-                case vr::VREvent_ButtonPress:
+                else if (vr_event.data.controller.button == Button_Dashboard_GoBack)
                 {
-                    if (vr_event.data.controller.button == Button_Dashboard_GoHome)
-                    {
-                        ConfigManager::Get().GetActionManager().StartAction(ConfigManager::GetValue(configid_handle_input_go_home_action_uid), i);
-                    }
-                    else if (vr_event.data.controller.button == Button_Dashboard_GoBack)
-                    {
-                        ConfigManager::Get().GetActionManager().StartAction(ConfigManager::GetValue(configid_handle_input_go_back_action_uid), i);
-                    }
-
-                    break;
+                    ConfigManager::Get().GetActionManager().StartAction(ConfigManager::GetValue(configid_handle_input_go_back_action_uid), i);
                 }
-                case vr::VREvent_ButtonUnpress:
-                {
-                    if (vr_event.data.controller.button == Button_Dashboard_GoHome)
-                    {
-                        ConfigManager::Get().GetActionManager().StopAction(ConfigManager::GetValue(configid_handle_input_go_home_action_uid), i);
-                    }
-                    else if (vr_event.data.controller.button == Button_Dashboard_GoBack)
-                    {
-                        ConfigManager::Get().GetActionManager().StopAction(ConfigManager::GetValue(configid_handle_input_go_back_action_uid), i);
-                    }
 
-                    break;
+                break;
+            }
+            case vr::VREvent_ButtonUnpress:
+            {
+                if (vr_event.data.controller.button == Button_Dashboard_GoHome)
+                {
+                    ConfigManager::Get().GetActionManager().StopAction(ConfigManager::GetValue(configid_handle_input_go_home_action_uid), i);
                 }
-                case vr::VREvent_FocusEnter:
+                else if (vr_event.data.controller.button == Button_Dashboard_GoBack)
                 {
-                    overlay_focus_count++;
+                    ConfigManager::Get().GetActionManager().StopAction(ConfigManager::GetValue(configid_handle_input_go_back_action_uid), i);
+                }
+
+                break;
+            }
+            case vr::VREvent_FocusEnter:
+            {
+                overlay_focus_count++;
+
+                const bool drag_or_select_mode_enabled = ( (ConfigManager::GetValue(configid_bool_state_overlay_dragmode)) || (ConfigManager::GetValue(configid_bool_state_overlay_selectmode)) );
 
-                    const bool drag_or_select_mode_enabled = ( (ConfigManager::GetValue(configid_bool_state_overlay_dragmode)) || (ConfigManager::GetValue(configid_bool_state_overlay_selectmode)) );
+                if (!drag_or_select_mode_enabled)
+                {
+                    if (ConfigManager::Get().GetPrimaryLaserPointerDevice() == vr::k_unTrackedDeviceIndex_Hmd)
+                    {
+                        ResetMouseLastLaserPointerPos();
+                    }
 
-                    if (!drag_or_select_mode_enabled)
+                    //If it's a WinRT window capture, check for window management stuff
+                    if ( (overlay.GetTextureSource() == ovrl_texsource_winrt_capture) && (config.GetValue(configid_handle_overlay_state_winrt_hwnd) != 0) )
                     {
-                        if (ConfigManager::Get().GetPrimaryLaserPointerDevice() == vr::k_unTrackedDeviceIndex_Hmd)
+                        if ( (!m_MouseIgnoreMoveEvent) && (ConfigManager::GetValue(configid_bool_windows_winrt_auto_focus)) )
                         {
-                            ResetMouseLastLaserPointerPos();
+                            WindowManager::Get().RaiseAndFocusWindow((HWND)config.GetValue(configid_handle_overlay_state_winrt_hwnd), &m_InputSim);
                         }
 
-                        //If it's a WinRT window capture, check for window management stuff
-                        if ( (overlay.GetTextureSource() == ovrl_texsource_winrt_capture) && (data.ConfigHandle[configid_handle_overlay_state_winrt_hwnd] != 0) )
+                        if (ConfigManager::GetValue(configid_bool_windows_winrt_keep_on_screen))
                         {
-                            if ( (!m_MouseIgnoreMoveEvent) && (ConfigManager::GetValue(configid_bool_windows_winrt_auto_focus)) )
-                            {
-                                WindowManager::Get().RaiseAndFocusWindow((HWND)data.ConfigHandle[configid_handle_overlay_state_winrt_hwnd], &m_InputSim);
-                            }
-
-                            if (ConfigManager::GetValue(configid_bool_windows_winrt_keep_on_screen))
-                            {
-                                WindowManager::MoveWindowIntoWorkArea((HWND)data.ConfigHandle[configid_handle_overlay_state_winrt_hwnd]);
-                            }
+                            WindowManager::MoveWindowIntoWorkArea((HWND)config.GetValue(configid_handle_overlay_state_winrt_hwnd));
                         }
                     }
-
-                    break;
                 }
-                case vr::VREvent_FocusLeave:
-                {
-                    overlay_focus_count--;
-
-                    const bool drag_or_select_mode_enabled = ( (ConfigManager::GetValue(configid_bool_state_overlay_dragmode)) || (ConfigManager::GetValue(configid_bool_state_overlay_selectmode)) );
 
-                    if (!drag_or_select_mode_enabled)
-                    {
-                        //If leaving a WinRT window capture and the option is enabled, focus the active scene app
-                        if ( (!m_MouseIgnoreMoveEvent) && (ConfigManager::GetValue(configid_bool_windows_winrt_auto_focus_scene_app)) &&
-                             (overlay.GetTextureSource() == ovrl_texsource_winrt_capture) && (data.ConfigHandle[configid_handle_overlay_state_winrt_hwnd] != 0) )
-                        {
-                            WindowManager::Get().FocusActiveVRSceneApp(&m_InputSim);
-                        }
-
-                        //A resize while drag can make the pointer lose focus, which is pretty janky. Remove target and do mouse up at least.
-                        if (WindowManager::Get().GetTargetWindow() != nullptr)
-                        {
-                            const bool use_pen = ConfigManager::GetValue(configid_bool_input_mouse_simulate_pen_input);
-                            (use_pen) ? m_InputSim.PenSetPrimaryDown(false) : m_InputSim.MouseSetLeftDown(false);
+                break;
+            }
+            case vr::VREvent_FocusLeave:
+            {
+                overlay_focus_count--;
 
-                            WindowManager::Get().SetTargetWindow(nullptr);
-                        }
+                const bool drag_or_select_mode_enabled = ( (ConfigManager::GetValue(configid_bool_state_overlay_dragmode)) || (ConfigManager::GetValue(configid_bool_state_overlay_selectmode)) );
 
-                        WindowManager::Get().ClearTempTopMostWindow();
+                if (!drag_or_select_mode_enabled)
+                {
+                    //If leaving a WinRT window capture and the option is enabled, focus the active scene app
+                    if ( (!m_MouseIgnoreMoveEvent) && (ConfigManager::GetValue(configid_bool_windows_winrt_auto_focus_scene_app)) &&
+                         (overlay.GetTextureSource() == ovrl_texsource_winrt_capture) && (config.GetValue(configid_handle_overlay_state_winrt_hwnd) != 0) )
+                    {
+                        WindowManager::Get().FocusActiveVRSceneApp(&m_InputSim);
                     }
 
-                    //Finish drag if there's somehow still one going (and not temp drag mode, where this is expected)
-                    if ( (m_OverlayDragger.IsDragActive()) && (!ConfigManager::GetValue(configid_bool_state_overlay_dragmode_temp)) )
+                    //A resize while drag can make the pointer lose focus, which is pretty janky. Remove target and do mouse up at least.
+                    if (WindowManager::Get().GetTargetWindow() != nullptr)
                     {
-                        OnDragFinish();
-                        m_OverlayDragger.DragFinish();
+                        const bool use_pen = ConfigManager::GetValue(configid_bool_input_mouse_simulate_pen_input);
+                        (use_pen) ? m_InputSim.PenSetPrimaryDown(false) : m_InputSim.MouseSetLeftDown(false);
 
-                        ApplySettingTransform();
+                        WindowManager::Get().SetTargetWindow(nullptr);
                     }
 
-                    //For browser overlays, forward leave event to browser process
-                    if (overlay.GetTextureSource() == ovrl_texsource_browser)
-                    {
-                        DPBrowserAPIClient::Get().DPBrowser_MouseLeave(overlay.GetHandle());
-                        break;
-                    }
+                    WindowManager::Get().ClearTempTopMostWindow();
+                }
 
-                    m_InputSim.PenLeave();
+                //Finish drag if there's somehow still one going (and not temp drag mode, where this is expected)
+                if ( (m_OverlayDragger.IsDragActive()) && (!ConfigManager::GetValue(configid_bool_state_overlay_dragmode_temp)) )
+                {
+                    OnDragFinish();
+                    m_OverlayDragger.DragFinish();
 
-                    break;
+                    ApplySettingTransform();
                 }
-                case vr::VREvent_OverlayClosed:
-                case vr::VREvent_OverlayHidden:
-                {
-                    //Theater overlay was hidden by something (close button, other overlay taking over, etc.), disable it
-                    //There may be cases where the overlay doesn't send the hidden event for this (varies between SteamVR builds), for that we also have a hack further below,
-                    //though it's mostly harmless if this doesn't work (phantom dashboard tab)
-                    if (OverlayManager::Get().GetTheaterOverlayID() == i)
-                    {
-                        if (!m_OvrlTheaterJustDocked)
-                        {
-                            SetOverlayEnabled(i, false);
-                        }
 
-                        m_OvrlTheaterJustDocked = false;
-                    }
+                //For browser overlays, forward leave event to browser process
+                if (overlay.GetTextureSource() == ovrl_texsource_browser)
+                {
+                    DPBrowserAPIClient::Get().DPBrowser_MouseLeave(overlay.GetHandle());
                     break;
                 }
-                case vr::VREvent_ChaperoneUniverseHasChanged:
+
+                m_InputSim.PenLeave();
+
+                break;
+            }
+            case vr::VREvent_OverlayClosed:
+            case vr::VREvent_OverlayHidden:
+            {
+                //Theater overlay was hidden by something (close button, other overlay taking over, etc.), disable it
+                //There may be cases where the overlay doesn't send the hidden event for this (varies between SteamVR builds), for that we also have a hack further below,
+                //though it's mostly harmless if this doesn't work (phantom dashboard tab)
+                if (OverlayManager::Get().GetTheaterOverlayID() == i)
                 {
-                    //We also get this when tracking is lost, which ends up updating the dashboard position
-                    if (m_OvrlActiveCount != 0)
+                    if (!m_OvrlTheaterJustDocked)
                     {
-                        ApplySettingTransform();
+                        SetOverlayEnabled(i, false);
                     }
-                    break;
+
+                    m_OvrlTheaterJustDocked = false;
                 }
-                default:
+                break;
+            }
+            case vr::VREvent_ChaperoneUniverseHasChanged:
+            {
+                //We also get this when tracking is lost, which ends up updating the dashboard position
+                if (m_OvrlActiveCount != 0)
                 {
-                    //Output unhandled events when looking for something useful
-                    /*std::wstringstream ss;
-                    ss << L"Event: " << (int)vr_event.eventType << L"\n";
-                    OutputDebugString(ss.str().c_str());*/
-                    break;
+                    ApplySettingTransform();
                 }
+                break;
+            }
+            default:
+            {
+                //Output unhandled events when looking for something useful
+                /*std::wstringstream ss;
+                ss << L"Event: " << (int)vr_event.eventType << L"\n";
+                OutputDebugString(ss.str().c_str());*/
+                break;
             }
         }
     }
@@ -4954,19 +5117,28 @@ bool OutputManager::HandleOpenVREvents()
         dashboard_origin_was_updated = true;
     }
 
+    //Per-frame transform and gaze fade updates are gathered from the frame's pose snapshot, computed together and then applied in one pass
+    m_OverlayFrameJobs.clear();
+
     bool transform_frame_update_was_done = false; //Frame transform updates need to track the last time they were done, but only once for all overlays
     for (unsigned int i = 0; i < OverlayManager::Get().GetOverlayCount(); ++i)
     {
-        OverlayManager::Get().SetCurrentOverlayID(i);
-        Overlay& overlay = OverlayManager::Get().GetCurrentOverlay();
-        const OverlayConfigData& data = OverlayManager::Get().GetCurrentConfigData();
+        //Only switch the current overlay for the functions still depending on it. Config reads and the per-frame transform and gaze fade updates don't need it
+        const OverlayConfigView config = OverlayManager::Get().GetConfigView(i);
+        const Overlay& overlay = OverlayManager::Get().GetOverlay(i);
 
-        if (data.ConfigBool[configid_bool_overlay_enabled])
+        if (config.GetValue(configid_bool_overlay_enabled))
         {
+            bool do_transform_update = false;
+
             if (overlay.IsVisible())
             {
+                const int origin = config.GetValue(configid_int_overlay_origin);
+
                 if (m_OverlayDragger.GetDragOverlayID() == overlay.GetID())
                 {
+                    OverlayManager::Get().SetCurrentOverlayID(i);
+
                     if (m_OverlayDragger.IsDragActive())
                     {
                         m_OverlayDragger.DragUpdate();
@@ -4976,24 +5148,37 @@ bool OutputManager::HandleOpenVREvents()
                         m_OverlayDragger.DragGestureUpdate();
                     }
                 }
-                else if ((data.ConfigInt[configid_int_overlay_origin] == ovrl_origin_hmd_floor) || (data.ConfigInt[configid_int_overlay_origin] == ovrl_origin_hmd))
+                else if ((origin == ovrl_origin_hmd_floor) || (origin == ovrl_origin_hmd))
                 {
-                    if (DetachedTransformFrameUpdate())
-                    {
-                        transform_frame_update_was_done = true;
-                    }
+                    do_transform_update = DetachedTransformFrameUpdateIsDue(i);
                 }
                 else if ( (dashboard_origin_was_updated) && (m_OverlayDragger.GetDragDeviceID() == -1) && (!m_OverlayDragger.IsDragGestureActive()) && 
-                          (data.ConfigInt[configid_int_overlay_origin] == ovrl_origin_dashboard) )
+                          (origin == ovrl_origin_dashboard) )
                 {
+                    OverlayManager::Get().SetCurrentOverlayID(i);
                     ApplySettingTransform();
                 }
             }
 
-            DetachedOverlayGazeFade();
+            m_OverlayFrameJobs.emplace_back();
+
+            if (DetachedOverlayFrameJobInit(m_OverlayFrameJobs.back(), i, do_transform_update, true))
+            {
+                transform_frame_update_was_done |= do_transform_update;
+            }
+            else
+            {
+                m_OverlayFrameJobs.pop_back();
+            }
         }
     }
 
+    for (OverlayFrameJob& job : m_OverlayFrameJobs)
+    {
+        OverlayFrameUpdater::Compute(job);
+        DetachedOverlayFrameJobApply(job);
+    }
+
     if (transform_frame_update_was_done)
     {
         m_LastFrameTransformUpdateTick = ::GetTickCount64();
@@ -5018,7 +5203,7 @@ bool OutputManager::HandleOpenVREvents()
         if ((!m_OvrlTheaterJustDocked) && (vr::VROverlay()->IsDashboardVisible()))
         {
             vr::VROverlayHandle_t system_dashboard;
-            vr::VROverlay()->FindOverlay("system.systemui", &system_dashboard);
+            OverlayStateMirror::Get().FindOverlay("system.systemui", &system_dashboard);
 
             const Matrix4 mat_dashboard = m_OverlayDragger.GetBaseOffsetMatrix(ovrl_origin_dashboard);
             const Matrix4 mat_theater   = OverlayManager::Get().GetOverlayMiddleTransform(OverlayManager::Get().GetTheaterOverlayID());
@@ -5287,7 +5472,7 @@ void OutputManager::OnOpenVRMouseEvent(const vr::VREvent_t& vr_event, unsigned i
 
                             if ( (overlay.GetTextureSource() != ovrl_texsource_none) && (overlay.GetTextureSource() != ovrl_texsource_ui) && (overlay.GetTextureSource() != ovrl_texsource_browser) )
                             {
-                                vr::VROverlay()->SetOverlayFlag(overlay.GetHandle(), vr::VROverlayFlags_HideLaserIntersection, true);
+                                OverlayStateMirror::Get().SetOverlayFlag(overlay.GetHandle(), vr::VROverlayFlags_HideLaserIntersection, true);
                             }
                         }
                     }
@@ -5884,6 +6069,8 @@ void OutputManager::CropToDisplay(int display_id, bool do_not_apply_setting)
     //Applying the setting when a duplication resets happens right after has the chance of screwing up the transform (too many transform updates?), so give the option to not do it
     if (!do_not_apply_setting)
     {
+        m_DisplayTopology.RefreshColorInfo();
+
         ApplySettingCrop();
         ApplySettingTransform();
         ApplySettingMouseScale();
@@ -6174,13 +6361,13 @@ void OutputManager::ApplySetting3DMode()
     {
         if (data.ConfigBool[configid_bool_overlay_3D_swapped])
         {
-            vr::VROverlay()->SetOverlayFlag(ovrl_handle, vr::VROverlayFlags_SideBySide_Parallel, false);
-            vr::VROverlay()->SetOverlayFlag(ovrl_handle, vr::VROverlayFlags_SideBySide_Crossed, true);
+            OverlayStateMirror::Get().SetOverlayFlag(ovrl_handle, vr::VROverlayFlags_SideBySide_Parallel, false);
+            OverlayStateMirror::Get().SetOverlayFlag(ovrl_handle, vr::VROverlayFlags_SideBySide_Crossed, true);
         }
         else
         {
-            vr::VROverlay()->SetOverlayFlag(ovrl_handle, vr::VROverlayFlags_SideBySide_Parallel, true);
-            vr::VROverlay()->SetOverlayFlag(ovrl_handle, vr::VROverlayFlags_SideBySide_Crossed, false);
+            OverlayStateMirror::Get().SetOverlayFlag(ovrl_handle, vr::VROverlayFlags_SideBySide_Parallel, true);
+            OverlayStateMirror::Get().SetOverlayFlag(ovrl_handle, vr::VROverlayFlags_SideBySide_Crossed, false);
         }
 
         switch (mode)
@@ -6206,8 +6393,8 @@ void OutputManager::ApplySetting3DMode()
     }
     else
     {
-        vr::VROverlay()->SetOverlayFlag(ovrl_handle, vr::VROverlayFlags_SideBySide_Parallel, false);
-        vr::VROverlay()->SetOverlayFlag(ovrl_handle, vr::VROverlayFlags_SideBySide_Crossed, false);
+        OverlayStateMirror::Get().SetOverlayFlag(ovrl_handle, vr::VROverlayFlags_SideBySide_Parallel, false);
+        OverlayStateMirror::Get().SetOverlayFlag(ovrl_handle, vr::VROverlayFlags_SideBySide_Crossed, false);
         vr::VROverlay()->SetOverlayTexelAspect(ovrl_handle, 1.0f);
     }
 
@@ -6297,7 +6484,7 @@ void OutputManager::ApplySettingTransform()
     if ( (is_primary_dashboard_overlay) || (primary_dashboard_overlay_id == k_ulOverlayID_None) )           //When no dashboard overlay exists we set this on every overlay, not ideal.
     {
         float old_dummy_height = 0.0f;
-        vr::VROverlay()->GetOverlayWidthInMeters(m_OvrlHandleDashboardDummy, &old_dummy_height);
+        OverlayStateMirror::Get().GetOverlayWidthInMeters(m_OvrlHandleDashboardDummy, &old_dummy_height);
 
         dummy_height = std::max(dummy_height + 0.30f, 1.5f); //Enforce minimum height to fit default height offset (which makes space for Floating UI)
 
@@ -6330,12 +6517,12 @@ void OutputManager::ApplySettingTransform()
                                                                         ConfigManager::GetValue(configid_float_overlay_offset_up),
                                                                         ConfigManager::GetValue(configid_float_overlay_offset_forward));
 
-            vr::VROverlay()->SetOverlayTransformAbsolute(ovrl_handle, universe_origin, &matrix);
+            OverlayStateMirror::Get().SetOverlayTransformAbsolute(ovrl_handle, universe_origin, &matrix);
             break;
         }
         case ovrl_origin_hmd_floor:
         {
-            DetachedTransformFrameUpdate();
+            DetachedTransformFrameUpdate(overlay.GetID());
             break;
         }
         case ovrl_origin_seated_universe:
@@ -6348,7 +6535,7 @@ void OutputManager::ApplySettingTransform()
                                            ConfigManager::GetValue(configid_float_overlay_offset_forward));
 
             matrix = matrix_base.toOpenVR34();
-            vr::VROverlay()->SetOverlayTransformAbsolute(ovrl_handle, vr::TrackingUniverseStanding, &matrix);
+            OverlayStateMirror::Get().SetOverlayTransformAbsolute(ovrl_handle, vr::TrackingUniverseStanding, &matrix);
             break;
         }
         case ovrl_origin_dashboard:
@@ -6370,7 +6557,7 @@ void OutputManager::ApplySettingTransform()
 
             matrix = matrix_base.toOpenVR34();
 
-            vr::VROverlay()->SetOverlayTransformAbsolute(ovrl_handle, universe_origin, &matrix);
+            OverlayStateMirror::Get().SetOverlayTransformAbsolute(ovrl_handle, universe_origin, &matrix);
             break;
         }
         case ovrl_origin_hmd:
@@ -6385,11 +6572,11 @@ void OutputManager::ApplySettingTransform()
                                                                             ConfigManager::GetValue(configid_float_overlay_offset_up),
                                                                             ConfigManager::GetValue(configid_float_overlay_offset_forward));
 
-                vr::VROverlay()->SetOverlayTransformTrackedDeviceRelative(ovrl_handle, vr::k_unTrackedDeviceIndex_Hmd, &matrix);
+                OverlayStateMirror::Get().SetOverlayTransformTrackedDeviceRelative(ovrl_handle, vr::k_unTrackedDeviceIndex_Hmd, &matrix);
             }
             else
             {
-                DetachedTransformFrameUpdate();
+                DetachedTransformFrameUpdate(overlay.GetID());
             }
             break;
         }
@@ -6406,11 +6593,11 @@ void OutputManager::ApplySettingTransform()
                                                                             ConfigManager::GetValue(configid_float_overlay_offset_up),
                                                                             ConfigManager::GetValue(configid_float_overlay_offset_forward));
 
-                vr::VROverlay()->SetOverlayTransformTrackedDeviceRelative(ovrl_handle, device_index, &matrix);
+                OverlayStateMirror::Get().SetOverlayTransformTrackedDeviceRelative(ovrl_handle, device_index, &matrix);
             }
             else //No controller connected, uh put it to 0?
             {
-                vr::VROverlay()->SetOverlayTransformAbsolute(ovrl_handle, universe_origin, &matrix);
+                OverlayStateMirror::Get().SetOverlayTransformAbsolute(ovrl_handle, universe_origin, &matrix);
             }
             break;
         }
@@ -6427,11 +6614,11 @@ void OutputManager::ApplySettingTransform()
                                                                             ConfigManager::GetValue(configid_float_overlay_offset_up),
                                                                             ConfigManager::GetValue(configid_float_overlay_offset_forward));
 
-                vr::VROverlay()->SetOverlayTransformTrackedDeviceRelative(ovrl_handle, device_index, &matrix);
+                OverlayStateMirror::Get().SetOverlayTransformTrackedDeviceRelative(ovrl_handle, device_index, &matrix);
             }
             else //No controller connected, uh put it to 0?
             {
-                vr::VROverlay()->SetOverlayTransformAbsolute(ovrl_handle, universe_origin, &matrix);
+                OverlayStateMirror::Get().SetOverlayTransformAbsolute(ovrl_handle, universe_origin, &matrix);
             }
             break;
         }
@@ -6448,11 +6635,11 @@ void OutputManager::ApplySettingTransform()
                                                                             ConfigManager::GetValue(configid_float_overlay_offset_up),
                                                                             ConfigManager::GetValue(configid_float_overlay_offset_forward));
 
-                vr::VROverlay()->SetOverlayTransformTrackedDeviceRelative(ovrl_handle, index_tracker, &matrix);
+                OverlayStateMirror::Get().SetOverlayTransformTrackedDeviceRelative(ovrl_handle, index_tracker, &matrix);
             }
             else //Not connected, uh put it to 0?
             {
-                vr::VROverlay()->SetOverlayTransformAbsolute(ovrl_handle, universe_origin, &matrix);
+                OverlayStateMirror::Get().SetOverlayTransformAbsolute(ovrl_handle, universe_origin, &matrix);
             }
 
             break;
@@ -6460,7 +6647,7 @@ void OutputManager::ApplySettingTransform()
     }
 
     //Update Width
-    vr::VROverlay()->SetOverlayWidthInMeters(ovrl_handle, width);
+    OverlayStateMirror::Get().SetOverlayWidthInMeters(ovrl_handle, width);
 
     //Update Curvature
     vr::VROverlay()->SetOverlayCurvature(ovrl_handle, ConfigManager::GetValue(configid_float_overlay_curvature));
@@ -6468,10 +6655,10 @@ void OutputManager::ApplySettingTransform()
     //Update Brightness
     //We use the logarithmic counterpart since the changes in higher steps are barely visible while the lower range can really use those additional steps
     float brightness = lin2log(ConfigManager::GetValue(configid_float_overlay_brightness)) * ConfigManager::GetValue(configid_float_overlay_state_brightness_extra_multiplier);
-    vr::VROverlay()->SetOverlayColor(ovrl_handle, brightness, brightness, brightness);
+    OverlayStateMirror::Get().SetOverlayColor(ovrl_handle, brightness, brightness, brightness);
 
     //Set backside visibility
-    vr::VROverlay()->SetOverlayFlag(ovrl_handle, vr::VROverlayFlags_NoBackside, !data.ConfigBool[configid_bool_overlay_show_backside]);
+    OverlayStateMirror::Get().SetOverlayFlag(ovrl_handle, vr::VROverlayFlags_NoBackside, !data.ConfigBool[configid_bool_overlay_show_backside]);
 
     //Set last tick for dashboard dummy delayed update
     m_LastApplyTransformTick = ::GetTickCount64();
@@ -6501,7 +6688,7 @@ void OutputManager::ApplySettingCrop()
         tex_bounds.uMax = 1.0f;
         tex_bounds.vMax = 1.0f;
 
-        vr::VROverlay()->SetOverlayTextureBounds(ovrl_handle, &tex_bounds);
+        OverlayStateMirror::Get().SetOverlayTextureBounds(ovrl_handle, &tex_bounds);
         return;
     }
 
@@ -6550,7 +6737,7 @@ void OutputManager::ApplySettingCrop()
 
         if (!needs_full_refresh)
         {
-            vr::VROverlay()->GetOverlayTextureBounds(ovrl_handle, &tex_bounds_prev);
+            OverlayStateMirror::Get().GetOverlayTextureBounds(ovrl_handle, &tex_bounds_prev);
 
             needs_full_refresh = ((tex_bounds.uMin < tex_bounds_prev.uMin) || (tex_bounds.vMin < tex_bounds_prev.vMin) || 
                                   (tex_bounds.uMax > tex_bounds_prev.uMax) || (tex_bounds.vMax > tex_bounds_prev.vMax));
@@ -6562,7 +6749,7 @@ void OutputManager::ApplySettingCrop()
         }
     }
 
-    vr::VROverlay()->SetOverlayTextureBounds(ovrl_handle, &tex_bounds);
+    OverlayStateMirror::Get().SetOverlayTextureBounds(ovrl_handle, &tex_bounds);
 }
 
 void OutputManager::ApplySettingInputMode()
@@ -6585,16 +6772,16 @@ void OutputManager::ApplySettingInputMode()
             //Don't activate drag mode for HMD origin when the pointer is also the HMD (or it's the dashboard overlay)
             if ( ((ConfigManager::Get().GetPrimaryLaserPointerDevice() == vr::k_unTrackedDeviceIndex_Hmd) && (ConfigManager::GetValue(configid_int_overlay_origin) == ovrl_origin_hmd)) )
             {
-                vr::VROverlay()->SetOverlayInputMethod(ovrl_handle, vr::VROverlayInputMethod_None);
+                OverlayStateMirror::Get().SetOverlayInputMethod(ovrl_handle, vr::VROverlayInputMethod_None);
             }
             else
             {
-                vr::VROverlay()->SetOverlayInputMethod(ovrl_handle, vr::VROverlayInputMethod_Mouse);
+                OverlayStateMirror::Get().SetOverlayInputMethod(ovrl_handle, vr::VROverlayInputMethod_Mouse);
             }
         }
         else
         {
-            vr::VROverlay()->SetOverlayInputMethod(ovrl_handle, vr::VROverlayInputMethod_None);
+            OverlayStateMirror::Get().SetOverlayInputMethod(ovrl_handle, vr::VROverlayInputMethod_None);
         }
 
         //Sync matrix if it's been turned off
@@ -6639,20 +6826,20 @@ void OutputManager::ApplySettingMouseInput()
             //Temp drag needs every input-enabled overlay to have smooth scroll
             if ( (ConfigManager::GetValue(configid_bool_input_mouse_scroll_smooth)) || (ConfigManager::GetValue(configid_bool_state_overlay_dragmode_temp)) || (drag_mode_enabled) )
             {
-                vr::VROverlay()->SetOverlayFlag(ovrl_handle, vr::VROverlayFlags_SendVRDiscreteScrollEvents, false);
-                vr::VROverlay()->SetOverlayFlag(ovrl_handle, vr::VROverlayFlags_SendVRSmoothScrollEvents,   true);
+                OverlayStateMirror::Get().SetOverlayFlag(ovrl_handle, vr::VROverlayFlags_SendVRDiscreteScrollEvents, false);
+                OverlayStateMirror::Get().SetOverlayFlag(ovrl_handle, vr::VROverlayFlags_SendVRSmoothScrollEvents,   true);
             }
             else
             {
-                vr::VROverlay()->SetOverlayFlag(ovrl_handle, vr::VROverlayFlags_SendVRDiscreteScrollEvents, true);
-                vr::VROverlay()->SetOverlayFlag(ovrl_handle, vr::VROverlayFlags_SendVRSmoothScrollEvents,   false);
+                OverlayStateMirror::Get().SetOverlayFlag(ovrl_handle, vr::VROverlayFlags_SendVRDiscreteScrollEvents, true);
+                OverlayStateMirror::Get().SetOverlayFlag(ovrl_handle, vr::VROverlayFlags_SendVRSmoothScrollEvents,   false);
             }
 
-            vr::VROverlay()->SetOverlayInputMethod(ovrl_handle, vr::VROverlayInputMethod_Mouse);
+            OverlayStateMirror::Get().SetOverlayInputMethod(ovrl_handle, vr::VROverlayInputMethod_Mouse);
         }
         else
         {
-            vr::VROverlay()->SetOverlayInputMethod(ovrl_handle, vr::VROverlayInputMethod_None);
+            OverlayStateMirror::Get().SetOverlayInputMethod(ovrl_handle, vr::VROverlayInputMethod_None);
         }
 
         //Set intersection blob state
@@ -6668,7 +6855,7 @@ void OutputManager::ApplySettingMouseInput()
             hide_intersection = !ConfigManager::GetValue(configid_bool_input_mouse_render_intersection_blob);
         }
 
-        vr::VROverlay()->SetOverlayFlag(ovrl_handle, vr::VROverlayFlags_HideLaserIntersection, hide_intersection);
+        OverlayStateMirror::Get().SetOverlayFlag(ovrl_handle, vr::VROverlayFlags_HideLaserIntersection, hide_intersection);
 
         ApplySettingMouseScale();
 
@@ -6888,6 +7075,7 @@ void OutputManager::ApplySettingExtraBrightness()
     {
         const bool ignore_wmr_vscreens = (ConfigManager::GetValue(configid_int_interface_wmr_ignore_vscreens) == 1);
 
+        //Color info isn't refreshed here as this is called for every overlay during resets. Callers refresh it once before applying to a batch of overlays
         switch (overlay.GetTextureSource())
         {
             case ovrl_texsource_desktop_duplication:
@@ -6904,7 +7092,7 @@ void OutputManager::ApplySettingExtraBrightness()
                 if (desktop_id == -2)
                 {
                     HMONITOR monitor_handle = ::MonitorFromWindow((HWND)data.ConfigHandle[configid_handle_overlay_state_winrt_hwnd], MONITOR_DEFAULTTONEAREST);
-                    desktop_id = GetDisplayIDFromHMonitor(monitor_handle, ignore_wmr_vscreens);
+                    desktop_id = m_DisplayTopology.GetSnapshot()->FindDesktopID((uint64_t)monitor_handle, ignore_wmr_vscreens);
                 }
 
                 extra_brightness_mulitplier = GetDesktopHDRWhiteLevelAdjustment(desktop_id, true, ignore_wmr_vscreens);
@@ -6980,11 +7168,11 @@ void OutputManager::DetachedTransformReset(unsigned int overlay_id_ref)
         float ref_overlay_alpha_orig = 0.0f;
 
         //GetTransformForOverlayCoordinates() won't work if the reference overlay is not visible, so make it "visible" by showing it with 0% alpha
-        if (!vr::VROverlay()->IsOverlayVisible(ovrl_handle_ref))
+        if (!OverlayStateMirror::Get().IsOverlayVisible(ovrl_handle_ref))
         {
-            vr::VROverlay()->GetOverlayAlpha(ovrl_handle_ref, &ref_overlay_alpha_orig);
-            vr::VROverlay()->SetOverlayAlpha(ovrl_handle_ref, 0.0f);
-            vr::VROverlay()->ShowOverlay(ovrl_handle_ref);
+            OverlayStateMirror::Get().GetOverlayAlpha(ovrl_handle_ref, &ref_overlay_alpha_orig);
+            OverlayStateMirror::Get().SetOverlayAlpha(ovrl_handle_ref, 0.0f);
+            OverlayStateMirror::Get().ShowOverlay(ovrl_handle_ref);
 
             //Showing overlays and getting coordinates from them has a race condition if it's the first time the overlay is shown
             //Doesn't seem like it can be truly detected when it's ready, so as cheap as it is, this Sleep() seems to get around the issue
@@ -6998,7 +7186,7 @@ void OutputManager::DetachedTransformReset(unsigned int overlay_id_ref)
 
         //Get x-offset multiplier, taking width differences into account
         float ref_overlay_width;
-        vr::VROverlay()->GetOverlayWidthInMeters(ovrl_handle_ref, &ref_overlay_width);
+        OverlayStateMirror::Get().GetOverlayWidthInMeters(ovrl_handle_ref, &ref_overlay_width);
         float dashboard_scale = GetDashboardScale();
         float x_offset_mul = ( (data.ConfigFloat[configid_float_overlay_width] / ref_overlay_width) / 2.0f) + 1.0f;
 
@@ -7022,8 +7210,8 @@ void OutputManager::DetachedTransformReset(unsigned int overlay_id_ref)
         //Restore reference overlay state if it was changed
         if (ref_overlay_changed)
         {
-            vr::VROverlay()->HideOverlay(ovrl_handle_ref);
-            vr::VROverlay()->SetOverlayAlpha(ovrl_handle_ref, ref_overlay_alpha_orig);
+            OverlayStateMirror::Get().HideOverlay(ovrl_handle_ref);
+            OverlayStateMirror::Get().SetOverlayAlpha(ovrl_handle_ref, ref_overlay_alpha_orig);
         }
 
         //If the reference overlay appears to be below ground we assume it has an invalid origin (i.e. dashboard tab never opened for dashboard overlay) and use the fallback transform
@@ -7166,9 +7354,9 @@ void OutputManager::DetachedTransformAdjust(unsigned int packed_value)
     if (target == ipcactv_ovrl_pos_adjust_lookat)
     {
         //Get HMD pose
-        vr::TrackedDevicePose_t poses[vr::k_unTrackedDeviceIndex_Hmd + 1];
+        vr::TrackedDevicePose_t poses[vr::k_unMaxTrackedDeviceCount];
         vr::TrackingUniverseOrigin universe_origin = vr::TrackingUniverseStanding;
-        vr::VRSystem()->GetDeviceToAbsoluteTrackingPose(universe_origin, vr::IVRSystemEx::GetTimeNowToPhotons(), poses, vr::k_unTrackedDeviceIndex_Hmd + 1);
+        TrackedPoseSnapshot::Get().GetPoses(poses, universe_origin);
 
         if (poses[vr::k_unTrackedDeviceIndex_Hmd].bPoseIsValid)
         {
@@ -7280,11 +7468,11 @@ void OutputManager::DetachedTransformConvertOrigin(unsigned int overlay_id, Over
     if ( (origin_from == ovrl_origin_hmd_floor) && ((origin_from == ovrl_origin_hmd) && (data.ConfigInt[configid_int_overlay_origin_smoothing_level] != 0)) )
     {
         //Only trust that transform if the overlay is visible, however
-        if (vr::VROverlay()->IsOverlayVisible(overlay.GetHandle()))
+        if (OverlayStateMirror::Get().IsOverlayVisible(overlay.GetHandle()))
         {
             vr::HmdMatrix34_t transform_ovr;
             vr::TrackingUniverseOrigin origin;
-            vr::VROverlay()->GetOverlayTransformAbsolute(overlay.GetHandle(), &origin, &transform_ovr);
+            OverlayStateMirror::Get().GetOverlayTransformAbsolute(overlay.GetHandle(), &origin, &transform_ovr);
 
             transform = transform_ovr;
 
@@ -7329,13 +7517,13 @@ void OutputManager::DetachedTransformConvertOrigin(unsigned int overlay_id, Over
     overlay.GetSmootherRot().ResetLastPos();
 }
 
-bool OutputManager::DetachedTransformFrameUpdate()
+bool OutputManager::DetachedTransformFrameUpdateIsDue(unsigned int overlay_id) const
 {
-    const OverlayConfigData& data = OverlayManager::Get().GetCurrentConfigData();
+    const OverlayConfigView config = OverlayManager::Get().GetConfigView(overlay_id);
+    const int origin = config.GetValue(configid_int_overlay_origin);
 
     //Skip if no frame level adjustments are needed
-    if (  (data.ConfigInt[configid_int_overlay_origin] != ovrl_origin_hmd_floor) && 
-         ((data.ConfigInt[configid_int_overlay_origin] != ovrl_origin_hmd) || (data.ConfigInt[configid_int_overlay_origin_smoothing_level] == 0)) )
+    if ( (origin != ovrl_origin_hmd_floor) && ((origin != ovrl_origin_hmd) || (config.GetValue(configid_int_overlay_origin_smoothing_level) == 0)) )
     {
         return false;
     }
@@ -7343,134 +7531,75 @@ bool OutputManager::DetachedTransformFrameUpdate()
     //We need to update the overlay pos at a somewhat constant rate for smoothing to be actually smooth
     //The way RadialFollowCore works doesn't take time into account however
     //Ideally this would be offloaded into a separate thread doing this at a truly fixed rate, but for now we just skip if we're going too fast (active overlays already force minimum update rate)
-    if (::GetTickCount64() < m_LastFrameTransformUpdateTick + m_MaxActiveRefreshDelay - 3)
-    {
+    return (::GetTickCount64() >= m_LastFrameTransformUpdateTick + m_MaxActiveRefreshDelay - 3);
+}
+
+bool OutputManager::DetachedTransformFrameUpdate(unsigned int overlay_id)
+{
+    if (!DetachedTransformFrameUpdateIsDue(overlay_id))
         return false;
-    }
 
-    Overlay& overlay = OverlayManager::Get().GetCurrentOverlay();
+    OverlayFrameJob job;
+    DetachedOverlayFrameJobInit(job, overlay_id, true, false);
+    OverlayFrameUpdater::Compute(job);
+    DetachedOverlayFrameJobApply(job);
+
+    return true;
+}
+
+bool OutputManager::DetachedOverlayFrameJobInit(OverlayFrameJob& job, unsigned int overlay_id, bool do_transform_update, bool do_gaze_fade)
+{
+    const OverlayConfigView config = OverlayManager::Get().GetConfigView(overlay_id);
+    Overlay& overlay = OverlayManager::Get().GetOverlay(overlay_id);
 
-    Matrix4 matrix = m_OverlayDragger.GetBaseOffsetMatrix();
-    matrix *= ConfigManager::Get().GetOverlayDetachedTransform();
+    job.OverlayID         = overlay_id;
+    job.DoTransformUpdate = do_transform_update;
+    job.DoGazeFade        = ( (do_gaze_fade) && (config.GetValue(configid_bool_overlay_gazefade_enabled)) );
 
-    //Offset transform by additional offset values
-    matrix.translate_relative(data.ConfigFloat[configid_float_overlay_offset_right],
-                              data.ConfigFloat[configid_float_overlay_offset_up],
-                              data.ConfigFloat[configid_float_overlay_offset_forward]);
+    if ( (!job.DoTransformUpdate) && (!job.DoGazeFade) )
+        return false;
+
+    job.BaseOffset = m_OverlayDragger.GetBaseOffsetMatrix(config);
+    job.Transform  = config.GetTransform();
 
-    //Use overlay's smoothers to filter the new matrix' position and rotation
-    if (data.ConfigInt[configid_int_overlay_origin_smoothing_level] != 0)
+    if (job.DoTransformUpdate)
     {
-        DetachedTransformFrameUpdateApplySmoothingParameters(overlay, data.ConfigInt[configid_int_overlay_origin_smoothing_level]);
-        matrix.setTranslation( overlay.GetSmootherPos().Filter(matrix.getTranslation()) );
-        matrix.setRotation(    overlay.GetSmootherRot().FilterWrapped(matrix.getRotation(), 0.0f, 360.0f) );
+        job.Offset = {config.GetValue(configid_float_overlay_offset_right), config.GetValue(configid_float_overlay_offset_up), config.GetValue(configid_float_overlay_offset_forward)};
+        job.SmoothingLevel = config.GetValue(configid_int_overlay_origin_smoothing_level);
+        job.SmootherPos    = &overlay.GetSmootherPos();
+        job.SmootherRot    = &overlay.GetSmootherRot();
     }
 
-    vr::HmdMatrix34_t matrix_ovr = matrix.toOpenVR34();
-    vr::VROverlay()->SetOverlayTransformAbsolute(OverlayManager::Get().GetCurrentOverlay().GetHandle(), vr::TrackingUniverseStanding, &matrix_ovr);
+    if (job.DoGazeFade)
+    {
+        //Drag/select mode or pointing at the overlay or the Floating UI targeting it keep the overlay at the most visible alpha setting
+        job.GazeFadeForceMaxOpacity = ( (ConfigManager::GetValue(configid_bool_state_overlay_dragmode)) || (ConfigManager::GetValue(configid_bool_state_overlay_selectmode)) || 
+                                        (ConfigManager::Get().IsLaserPointerTargetOverlay(overlay.GetHandle())) || 
+                                        ((unsigned int)ConfigManager::GetValue(configid_int_state_interface_floating_ui_hovered_id) == overlay.GetID()) );
+        job.PoseHMD        = TrackedPoseSnapshot::Get().GetPose(vr::k_unTrackedDeviceIndex_Hmd);
+        job.OpacityMax     = config.GetValue(configid_float_overlay_opacity);
+        job.OpacityMin     = config.GetValue(configid_float_overlay_gazefade_opacity);
+        job.GazeDistance   = config.GetValue(configid_float_overlay_gazefade_distance);
+        job.GazeRate       = config.GetValue(configid_float_overlay_gazefade_rate);
+        job.OpacityCurrent = overlay.GetOpacity();
+    }
 
     return true;
 }
 
-void OutputManager::DetachedTransformFrameUpdateApplySmoothingParameters(Overlay& overlay, int preset_id)
+void OutputManager::DetachedOverlayFrameJobApply(const OverlayFrameJob& job)
 {
-    preset_id = clamp(preset_id, 0, 5);
+    Overlay& overlay = OverlayManager::Get().GetOverlay(job.OverlayID);
 
-    RadialFollowCore& smoother_pos = overlay.GetSmootherPos();
-    RadialFollowCore& smoother_rot = overlay.GetSmootherRot();
-
-    switch (preset_id)
+    if (job.DoTransformUpdate)
     {
-        case 0: //Not really used, calling Filter() is skipped entirely instead
-        {
-            smoother_pos.SetOuterRadius(0.0);
-            smoother_pos.SetInnerRadius(0.0);
-            smoother_pos.SetSmoothingCoefficient(0.0);
-            smoother_pos.SetSoftKneeScale(0.0);
-            smoother_pos.SetSmoothingLeakCoefficient(0.0);
-
-            smoother_rot.SetOuterRadius(0.0);
-            smoother_rot.SetInnerRadius(0.0);
-            smoother_rot.SetSmoothingCoefficient(0.0);
-            smoother_rot.SetSoftKneeScale(0.0);
-            smoother_rot.SetSmoothingLeakCoefficient(0.0);
-            break;
-        }
-        case 1:
-        {
-            smoother_pos.SetOuterRadius(0.0);
-            smoother_pos.SetInnerRadius(0.0);
-            smoother_pos.SetSmoothingCoefficient(0.85);
-            smoother_pos.SetSoftKneeScale(1.0);
-            smoother_pos.SetSmoothingLeakCoefficient(1.0);
-
-            smoother_rot.SetOuterRadius(0.0);
-            smoother_rot.SetInnerRadius(0.0);
-            smoother_rot.SetSmoothingCoefficient(0.8);
-            smoother_rot.SetSoftKneeScale(1.0);
-            smoother_rot.SetSmoothingLeakCoefficient(1.0);
-            break;
-        }
-        case 2:
-        {
-            smoother_pos.SetOuterRadius(0.0);
-            smoother_pos.SetInnerRadius(0.0);
-            smoother_pos.SetSmoothingCoefficient(0.90);
-            smoother_pos.SetSoftKneeScale(1.0);
-            smoother_pos.SetSmoothingLeakCoefficient(0.95);
-
-            smoother_rot.SetOuterRadius(0.5);
-            smoother_rot.SetInnerRadius(0.0);
-            smoother_rot.SetSmoothingCoefficient(0.85);
-            smoother_rot.SetSoftKneeScale(1.0);
-            smoother_rot.SetSmoothingLeakCoefficient(1.0);
-            break;
-        }
-        case 3:
-        {
-            smoother_pos.SetOuterRadius(0.02);
-            smoother_pos.SetInnerRadius(0.01);
-            smoother_pos.SetSmoothingCoefficient(0.95);
-            smoother_pos.SetSoftKneeScale(1.0);
-            smoother_pos.SetSmoothingLeakCoefficient(0.90);
-
-            smoother_rot.SetOuterRadius(1.0);
-            smoother_rot.SetInnerRadius(0.5);
-            smoother_rot.SetSmoothingCoefficient(0.75);
-            smoother_rot.SetSoftKneeScale(1.0);
-            smoother_rot.SetSmoothingLeakCoefficient(1.00);
-            break;
-        }
-        case 4:
-        {
-            smoother_pos.SetOuterRadius(0.10);
-            smoother_pos.SetInnerRadius(0.10);
-            smoother_pos.SetSmoothingCoefficient(0.93);
-            smoother_pos.SetSoftKneeScale(1.0);
-            smoother_pos.SetSmoothingLeakCoefficient(0.97);
-
-            smoother_rot.SetOuterRadius(7.5);
-            smoother_rot.SetInnerRadius(7.5);
-            smoother_rot.SetSmoothingCoefficient(0.75);
-            smoother_rot.SetSoftKneeScale(0.8);
-            smoother_rot.SetSmoothingLeakCoefficient(1.0);
-            break;
-        }
-        case 5:
-        {
-            smoother_pos.SetOuterRadius(0.25);
-            smoother_pos.SetInnerRadius(0.20);
-            smoother_pos.SetSmoothingCoefficient(0.95);
-            smoother_pos.SetSoftKneeScale(1.0);
-            smoother_pos.SetSmoothingLeakCoefficient(0.97);
+        vr::HmdMatrix34_t matrix_ovr = job.TransformResult.toOpenVR34();
+        OverlayStateMirror::Get().SetOverlayTransformAbsolute(overlay.GetHandle(), vr::TrackingUniverseStanding, &matrix_ovr);
+    }
 
-            smoother_rot.SetOuterRadius(30.0);
-            smoother_rot.SetInnerRadius(10.0);
-            smoother_rot.SetSmoothingCoefficient(0.96);
-            smoother_rot.SetSoftKneeScale(0.80);
-            smoother_rot.SetSmoothingLeakCoefficient(0.85);
-            break;
-        }
+    if (job.DoGazeFade)
+    {
+        overlay.SetOpacity(job.OpacityResult);
     }
 }
 
@@ -7538,88 +7667,10 @@ void OutputManager::DetachedInteractionAutoToggleAll()
     }
 }
 
-void OutputManager::DetachedOverlayGazeFade()
-{
-    if (ConfigManager::GetValue(configid_bool_overlay_gazefade_enabled))
-    {
-        Overlay& current_overlay = OverlayManager::Get().GetCurrentOverlay();
-
-        //When drag/select mode are active or HMD pose not available, default to most visible alpha setting
-        const float max_alpha = ConfigManager::GetValue(configid_float_overlay_opacity);
-        const float min_alpha = ConfigManager::GetValue(configid_float_overlay_gazefade_opacity);
-        float alpha = std::max(min_alpha, max_alpha);
-
-        if ((!ConfigManager::GetValue(configid_bool_state_overlay_dragmode)) && (!ConfigManager::GetValue(configid_bool_state_overlay_selectmode)))
-        {
-            vr::TrackingUniverseOrigin universe_origin = vr::TrackingUniverseStanding;
-            vr::TrackedDevicePose_t poses[vr::k_unTrackedDeviceIndex_Hmd + 1];
-            vr::VRSystem()->GetDeviceToAbsoluteTrackingPose(universe_origin, vr::IVRSystemEx::GetTimeNowToPhotons(), poses, vr::k_unTrackedDeviceIndex_Hmd + 1);
-
-            if (poses[vr::k_unTrackedDeviceIndex_Hmd].bPoseIsValid)
-            {
-                //Distance the gaze point is offset from HMD (useful range 0.25 - 1.0)
-                float gaze_distance = ConfigManager::GetValue(configid_float_overlay_gazefade_distance);
-                //Rate the fading gets applied when looking off the gaze point (useful range 4.0 - 30, depends on overlay size) 
-                float fade_rate = ConfigManager::GetValue(configid_float_overlay_gazefade_rate) * 10.0f; 
-
-                Matrix4 mat_pose = poses[vr::k_unTrackedDeviceIndex_Hmd].mDeviceToAbsoluteTracking;
-
-                Matrix4 mat_overlay = m_OverlayDragger.GetBaseOffsetMatrix();
-                mat_overlay *= ConfigManager::Get().GetOverlayDetachedTransform();
-
-                //Infinite/Auto distance mode
-                if (gaze_distance == 0.0f) 
-                {
-                    gaze_distance = mat_overlay.getTranslation().distance(mat_pose.getTranslation()); //Match gaze distance to distance between HMD and overlay
-                }
-                else
-                {
-                    gaze_distance += 0.20f; //Useful range starts at ~0.20 - 0.25 (lower is in HMD or culled away), so offset the settings value
-                }
-
-                mat_pose.translate_relative(0.0f, 0.0f, -gaze_distance);
-
-                Vector3 pos_gaze = mat_pose.getTranslation();
-                float distance = mat_overlay.getTranslation().distance(pos_gaze);
-
-                gaze_distance = std::min(gaze_distance, 1.0f); //To get useful fading past 1m distance we'll have to limit the value to 1m here for the math below
-
-                alpha = clamp((distance * -fade_rate) + ((gaze_distance - 0.1f) * 10.0f), 0.0f, 1.0f); //There's nothing smart behind this, just trial and error
-
-                //Use max alpha when the overlay or the Floating UI targeting the overlay is being pointed at
-                if ((ConfigManager::Get().IsLaserPointerTargetOverlay(current_overlay.GetHandle())) || 
-                    ((unsigned int)ConfigManager::GetValue(configid_int_state_interface_floating_ui_hovered_id) == current_overlay.GetID()))
-                {
-                    alpha = std::max(min_alpha, max_alpha); //Take whatever's more visible as the user probably wants to be able to see the overlay
-                }
-                else //Adapt alpha result from a 0.0 - 1.0 range to gazefade_opacity - overlay_opacity and invert if necessary
-                {
-                    const float range_length = max_alpha - min_alpha;
-
-                    if (range_length >= 0.0f)
-                    {
-                        alpha = (alpha * range_length) + min_alpha;
-                    }
-                    else //Gaze Fade target opacity higher than overlay opcacity, invert behavior
-                    {
-                        alpha = ((alpha - 1.0f) * range_length) + max_alpha;
-                    }
-                }
-            }
-        }
-
-        //Limit alpha change per frame to smooth out things when abrupt changes happen (i.e. overlay capture took a bit to re-enable or laser pointer forces full alpha)
-        const float prev_alpha = current_overlay.GetOpacity();
-        const float diff = alpha - prev_alpha;
-
-        current_overlay.SetOpacity(prev_alpha + clamp(diff, -0.1f, 0.1f));
-    }
-}
-
 void OutputManager::DetachedOverlayGazeFadeAutoConfigure()
 {
-    vr::TrackedDevicePose_t poses[vr::k_unTrackedDeviceIndex_Hmd + 1];
-    vr::VRSystem()->GetDeviceToAbsoluteTrackingPose(vr::TrackingUniverseStanding, vr::IVRSystemEx::GetTimeNowToPhotons(), poses, vr::k_unTrackedDeviceIndex_Hmd + 1);
+    vr::TrackedDevicePose_t poses[vr::k_unMaxTrackedDeviceCount];
+    TrackedPoseSnapshot::Get().GetPoses(poses);
 
     if (poses[vr::k_unTrackedDeviceIndex_Hmd].bPoseIsValid)
     {
@@ -7667,7 +7718,7 @@ void OutputManager::DetachedOverlayAutoDockingAll()
     int config_value = 0;
 
     vr::TrackedDevicePose_t poses[vr::k_unMaxTrackedDeviceCount];
-    vr::VRSystem()->GetDeviceToAbsoluteTrackingPose(vr::TrackingUniverseStanding, vr::IVRSystemEx::GetTimeNowToPhotons(), poses, vr::k_unMaxTrackedDeviceCount);
+    TrackedPoseSnapshot::Get().GetPoses(poses);
 
     //Check left and right hand controller
     vr::ETrackedControllerRole controller_role = vr::TrackedControllerRole_LeftHand;
@@ -7828,6 +7879,7 @@ void OutputManager::FinishQueuedOverlayRemovals()
 
     for (unsigned int overlay_id : m_RemoveOverlayQueue)
     {
+        m_OverlayEventRouter.ForgetOverlay(OverlayManager::Get().GetOverlay(overlay_id).GetHandle());
         OverlayManager::Get().RemoveOverlay(overlay_id);
 
         IPCManager::Get().PostMessageToUIApp(ipcmsg_action, ipcact_overlay_remove, overlay_id);
@@ -7846,10 +7898,9 @@ void OutputManager::FixInvalidDashboardLaunchState()
     //There are other things that aren't quite right and Desktop+ relies on the info to be correct in many cases.
     //This somewhat works around the issue by opening the dashboard for our dashboard overlay. 
     //While a little bit intrusive and not 100% reliable when Desktop+ is auto-launched alongside, it's better than nothing.
-    vr::VROverlayHandle_t system_dashboard;
-    vr::VROverlay()->FindOverlay("system.systemui", &system_dashboard);
+    vr::VROverlayHandle_t system_dashboard = TrackedPoseSnapshot::Get().GetSystemUIOverlayHandle();
 
-    if ( (vr::VROverlay()->IsOverlayVisible(system_dashboard)) && (!vr::VROverlay()->IsDashboardVisible()) )
+    if ( (OverlayStateMirror::Get().IsOverlayVisible(system_dashboard)) && (!vr::VROverlay()->IsDashboardVisible()) )
     {
         vr::VROverlay()->ShowDashboard("elvissteinjr.DesktopPlusDashboard");
     }
@@ -7870,15 +7921,14 @@ bool OutputManager::HasDashboardMoved()
     vr::HmdMatrix34_t hmd_matrix = {0};
     vr::TrackingUniverseOrigin universe_origin = vr::TrackingUniverseStanding;
 
-    if (vr::VROverlay()->IsOverlayVisible(m_OvrlHandleDashboardDummy))
+    if (OverlayStateMirror::Get().IsOverlayVisible(m_OvrlHandleDashboardDummy))
     {
         vr::VROverlay()->GetTransformForOverlayCoordinates(m_OvrlHandleDashboardDummy, universe_origin, {0.0f, 0.0f}, &hmd_matrix);
         matrix_new = hmd_matrix;
     }
     else
     {
-        vr::VROverlayHandle_t handle_gamepad_ui = vr::k_ulOverlayHandleInvalid;
-        vr::VROverlay()->FindOverlay("valve.steam.gamepadui.bar", &handle_gamepad_ui);
+        vr::VROverlayHandle_t handle_gamepad_ui = TrackedPoseSnapshot::Get().GetGamepadUIOverlayHandle();
 
         //Use GamepadUI as a reference. Legacy dashboard can't be reliably checked like this anymore and is unsupported beyond our own dashboard tab
         vr::VROverlayHandle_t handle_dashboard = handle_gamepad_ui;
@@ -7910,33 +7960,31 @@ void OutputManager::DimDashboard(bool do_dim)
         return;
 
     //This *could* terribly conflict with other apps messing with these settings, but I'm unaware of any that are right now, so let's just say we're the first
-    vr::VROverlayHandle_t system_dashboard;
-    vr::VROverlay()->FindOverlay("system.systemui", &system_dashboard);
+    vr::VROverlayHandle_t system_dashboard = TrackedPoseSnapshot::Get().GetSystemUIOverlayHandle();
 
     if (system_dashboard != vr::k_ulOverlayHandleInvalid)
     {
         if (do_dim)
         {
-            vr::VROverlay()->SetOverlayColor(system_dashboard, 0.05f, 0.05f, 0.05f);
+            OverlayStateMirror::Get().SetOverlayColor(system_dashboard, 0.05f, 0.05f, 0.05f);
         }
         else
         {
-            vr::VROverlay()->SetOverlayColor(system_dashboard, 1.0f, 1.0f, 1.0f);
+            OverlayStateMirror::Get().SetOverlayColor(system_dashboard, 1.0f, 1.0f, 1.0f);
         }
     }
 
-    vr::VROverlayHandle_t gamepadui;
-    vr::VROverlay()->FindOverlay("valve.steam.gamepadui.bar", &gamepadui);
+    vr::VROverlayHandle_t gamepadui = TrackedPoseSnapshot::Get().GetGamepadUIOverlayHandle();
 
     if (gamepadui != vr::k_ulOverlayHandleInvalid)
     {
         if (do_dim)
         {
-            vr::VROverlay()->SetOverlayColor(gamepadui, 0.05f, 0.05f, 0.05f);
+            OverlayStateMirror::Get().SetOverlayColor(gamepadui, 0.05f, 0.05f, 0.05f);
         }
         else
         {
-            vr::VROverlay()->SetOverlayColor(gamepadui, 1.0f, 1.0f, 1.0f);
+            OverlayStateMirror::Get().SetOverlayColor(gamepadui, 1.0f, 1.0f, 1.0f);
         }
     }
 }
@@ -7944,15 +7992,15 @@ void OutputManager::DimDashboard(bool do_dim)
 void OutputManager::UpdatePendingDashboardDummyHeight()
 {
     float old_dummy_height = 0.0f;
-    vr::VROverlay()->GetOverlayWidthInMeters(m_OvrlHandleDashboardDummy, &old_dummy_height);
+    OverlayStateMirror::Get().GetOverlayWidthInMeters(m_OvrlHandleDashboardDummy, &old_dummy_height);
 
     //Check for dummy height changes but enforce a minimum difference as the underlying size seems to flicker under certain conditions in current SteamVR versions for some reason
     if (fabs(m_PendingDashboardDummyHeight - old_dummy_height) > 0.01f)
     {
-        vr::VROverlay()->SetOverlayWidthInMeters(m_OvrlHandleDashboardDummy, m_PendingDashboardDummyHeight);
+        OverlayStateMirror::Get().SetOverlayWidthInMeters(m_OvrlHandleDashboardDummy, m_PendingDashboardDummyHeight);
 
         //Perform tactical sleep to avoid flickering caused by dummy adjustments not being done in time when dashboard overlay positioning depends on it
-        if (vr::VROverlay()->IsOverlayVisible(m_OvrlHandleDashboardDummy))
+        if (OverlayStateMirror::Get().IsOverlayVisible(m_OvrlHandleDashboardDummy))
         {
             ::Sleep(100);
         }
@@ -20,6 +20,9 @@
 #include "InterprocessMessaging.h"
 #include "OverlayDragger.h"
 #include "LaserPointer.h"
+#include "OverlayEventRouter.h"
+#include "OverlayFrameUpdater.h"
+#include "DisplayTopology.h"
 
 class Overlay;
 //
@@ -38,8 +41,7 @@ class OutputManager
         void CleanRefsDesktopDuplicationOnly();
         DDPDuplReturn InitOutput(HWND Window, INT& SingleOutput, UINT& OutCount, RECT& DeskBounds);
         std::tuple<vr::EVRInitError, vr::EVROverlayError, bool> InitOverlay();  //Returns error state <InitError, OverlayError, VRInputInitSuccess>
-        DDPDuplReturnUpdate Update(DDPPtrInfo& PointerInfo, DPRect& DirtyRegionTotal, bool NewFrame, bool SkipFrame);
-        void BusyUpdate();                        //Updates minimal state (i.e. OverlayDragger) during busy waits (i.e. waiting for browser startup) to appear more responsive
+        DDPDuplReturnUpdate Update(DDPPtrInfo& PointerInfo, DPRect& DirtyRegionTotal, DDPRegionOfInterest& RegionOfInterest, bool NewFrame, bool SkipFrame);
         bool HandleIPCMessage(const MSG& msg);    //Returns true if message caused a duplication reset (i.e. desktop switch)
         void HandleWinRTMessage(const MSG& msg);  //Messages sent by the Desktop+ WinRT library
         void HandleHotkeyMessage(const MSG& msg);
@@ -62,7 +64,10 @@ class OutputManager
         int GetDesktopWidth() const;
         int GetDesktopHeight() const;
         const std::vector<DPRect>& GetDesktopRects() const;
-        float GetDesktopHDRWhiteLevelAdjustment(int desktop_id, bool is_for_graphics_capture, bool wmr_ignore_vscreens) const;
+        const std::vector<DPRect>& GetDesktopDuplicationDemandRects();  //Refreshes and returns crop rects of all visible Desktop Duplication overlays, used to park unneeded capture threads
+        float GetDesktopHDRWhiteLevelAdjustment(int desktop_id, bool is_for_graphics_capture, bool wmr_ignore_vscreens);
+        std::shared_ptr<const DisplayTopologySnapshot> GetDisplayTopology();
+        void InvalidateDisplayTopology();   //Called on display change notifications, next access to the topology re-enumerates
 
         void ShowOverlay(unsigned int id);
         void ShowTheaterOverlay(unsigned int id);
@@ -104,7 +109,7 @@ class OutputManager
                                              Microsoft::WRL::ComPtr<ID3D11Texture2D>& out_tex, DXGI_FORMAT& out_tex_format, D3D11_BOX& box);
         DDPDuplReturn InitShaders();
         DDPDuplReturn CreateTextures(INT SingleOutput, UINT& OutCount, RECT& DeskBounds);
-        void DrawFrameToOverlayTex(bool clear_rtv = true);
+        void DrawFrameToOverlayTex(const DPRect& dirty_rect, bool clear_rtv = true);
         DDPDuplReturn DrawMouseToOverlayTex(DDPPtrInfo& PtrInfo);
         DDPDuplReturnUpdate RefreshOpenVROverlayTexture(DPRect& DirtyRectTotal, bool force_full_copy = false); //Refreshes the overlay texture of the VR runtime with content of the m_OvrlTex backing texture
         bool RecreateOverlayTex();
@@ -143,12 +148,14 @@ class OutputManager
         void DetachedTransformConvertOrigin(unsigned int overlay_id, OverlayOrigin origin_from, OverlayOrigin origin_to);
         void DetachedTransformConvertOrigin(unsigned int overlay_id, OverlayOrigin origin_from, OverlayOrigin origin_to, 
                                             const OverlayOriginConfig& origin_config_from, const OverlayOriginConfig& origin_config_to);
-        bool DetachedTransformFrameUpdate();  //Returns if update was applied (not skipped)
-        void DetachedTransformFrameUpdateApplySmoothingParameters(Overlay& overlay, int preset_id);
+        bool DetachedTransformFrameUpdateIsDue(unsigned int overlay_id) const;
+        bool DetachedTransformFrameUpdate(unsigned int overlay_id);  //Returns if update was applied (not skipped)
+        //Fills job with the overlay's frame update inputs, returns false if there's nothing to do for the overlay
+        bool DetachedOverlayFrameJobInit(OverlayFrameJob& job, unsigned int overlay_id, bool do_transform_update, bool do_gaze_fade);
+        void DetachedOverlayFrameJobApply(const OverlayFrameJob& job);
         void DetachedTransformUpdateSeatedPosition();
 
         void DetachedInteractionAutoToggleAll();
-        void DetachedOverlayGazeFade();
         void DetachedOverlayGazeFadeAutoConfigure();
         void DetachedOverlayAutoDockingAll();
 
@@ -177,6 +184,8 @@ class OutputManager
         BackgroundOverlay m_BackgroundOverlay;
         OverlayDragger m_OverlayDragger;
         LaserPointer m_LaserPointer;
+        OverlayEventRouter m_OverlayEventRouter;
+        std::vector<OverlayFrameJob> m_OverlayFrameJobs;
 
         Microsoft::WRL::ComPtr<ID3D11Device> m_Device;
         Microsoft::WRL::ComPtr<ID3D11DeviceContext> m_DeviceContext;
@@ -201,17 +210,21 @@ class OutputManager
         int m_DesktopWidth;
         int m_DesktopHeight;
         std::vector<DPRect> m_DesktopRects;     //Cached position and size of available desktops
+        std::vector<DPRect> m_DesktopDuplDemandRects;
         DPRect m_DesktopRectTotal;              //Total rect of all available desktops (may not be the same as above Desktop Duplication rect if that's not using the combined desktop)
         std::vector<float> m_DesktopHDRWhiteLevelAdjustments; //Cached GetDesktopHDRWhiteLevelAdjustment() results used during cursor updates
+        DisplayTopology m_DisplayTopology;
         DWORD m_MaxActiveRefreshDelay;
         bool m_OutputHDRAvailable;              //False if OS doesn't support the required interface, regardless of hardware connected
         bool m_OutputInvalid;
         bool m_OutputPendingSkippedFrame;
         bool m_OutputPendingFullRefresh;
+        bool m_OutputPendingScreenRefresh;      //Set when desktop areas culled by the capture threads became visible
         DPRect m_OutputPendingDirtyRect;
         DPRect m_OutputLastClippingRect;
         int m_OutputAlphaChecksPending;
         bool m_OutputAlphaCheckFailed;          //Output appears to be translucent and needs its alpha channel stripped during texture copy
+        DDPPtrInfo m_OutputPointerInfo;         //Copy of the pointer info for drawing color cursors after releasing the keyed mutex
 
         vr::VROverlayHandle_t m_OvrlHandleDashboardDummy;
         vr::VROverlayHandle_t m_OvrlHandleIcon;
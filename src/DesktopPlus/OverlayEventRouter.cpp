@@ -0,0 +1,109 @@
+#include "OverlayEventRouter.h"
+
+void OverlayEventRouter::BeginCollect()
+{
+    m_Events.clear();
+    m_CoalescedCount = 0;
+}
+
+OverlayEventRouter::PollAction OverlayEventRouter::GetPollAction(vr::VROverlayHandle_t overlay_handle, bool is_visible, uint64_t tick)
+{
+    const auto it = m_LastVisibleTick.find(overlay_handle);
+
+    if (is_visible)
+    {
+        //Not tracked means it wasn't polled for a while (or never), so anything in the queue is stale
+        if (it == m_LastVisibleTick.end())
+        {
+            m_LastVisibleTick[overlay_handle] = tick;
+            return poll_action_discard;
+        }
+
+        it->second = tick;
+        return poll_action_route;
+    }
+
+    if (it == m_LastVisibleTick.end())
+        return poll_action_skip;
+
+    if (tick < it->second + s_PollGracePeriodMs)
+        return poll_action_route;
+
+    //Grace period is over, stop polling until it's visible again
+    m_LastVisibleTick.erase(it);
+    return poll_action_skip;
+}
+
+void OverlayEventRouter::AddEvent(unsigned int overlay_id, vr::VROverlayHandle_t overlay_handle, const vr::VREvent_t& vr_event)
+{
+    if (!m_Events.empty())
+    {
+        EventRecord& record_prev = m_Events.back();
+
+        if ( (record_prev.OverlayHandle == overlay_handle) && (CanCoalesce(record_prev.Event, vr_event)) )
+        {
+            Coalesce(record_prev.Event, vr_event);
+            m_CoalescedCount++;
+            return;
+        }
+    }
+
+    m_Events.push_back({overlay_id, overlay_handle, vr_event});
+}
+
+void OverlayEventRouter::ForgetOverlay(vr::VROverlayHandle_t overlay_handle)
+{
+    m_LastVisibleTick.erase(overlay_handle);
+}
+
+const std::vector<OverlayEventRouter::EventRecord>& OverlayEventRouter::GetEvents() const
+{
+    return m_Events;
+}
+
+size_t OverlayEventRouter::GetCoalescedCount() const
+{
+    return m_CoalescedCount;
+}
+
+bool OverlayEventRouter::CanCoalesce(const vr::VREvent_t& event_prev, const vr::VREvent_t& event_next)
+{
+    if ( (event_prev.eventType != event_next.eventType) || (event_prev.trackedDeviceIndex != event_next.trackedDeviceIndex) )
+        return false;
+
+    switch (event_next.eventType)
+    {
+        //Only the last position matters
+        case vr::VREvent_MouseMove:
+        {
+            return (event_prev.data.mouse.cursorIndex == event_next.data.mouse.cursorIndex);
+        }
+        //Deltas add up. Discrete scrolling isn't merged since its handling depends on the time between events
+        case vr::VREvent_ScrollSmooth:
+        {
+            return (event_prev.data.scroll.cursorIndex == event_next.data.scroll.cursorIndex);
+        }
+        //Handled the same way regardless of how many are in a row
+        case vr::VREvent_ChaperoneUniverseHasChanged:
+        {
+            return true;
+        }
+        default: return false;
+    }
+}
+
+void OverlayEventRouter::Coalesce(vr::VREvent_t& event_prev, const vr::VREvent_t& event_next)
+{
+    if (event_next.eventType == vr::VREvent_ScrollSmooth)
+    {
+        vr::VREvent_t event_merged = event_next;
+        event_merged.data.scroll.xdelta += event_prev.data.scroll.xdelta;
+        event_merged.data.scroll.ydelta += event_prev.data.scroll.ydelta;
+
+        event_prev = event_merged;
+    }
+    else
+    {
+        event_prev = event_next;
+    }
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+
+#include "openvr.h"
+
+//Collects events from all overlay event queues in one pass before they're dispatched by OutputManager::HandleOpenVREvents()
+//Consecutive mouse moves, smooth scrolls and redundant notifications of the same overlay and device are coalesced while keeping the order of everything else intact
+//Overlays that have been hidden for a while are not polled at all, as they can't receive input and would only have stale events to deliver
+//Their queues still fill up in the meantime, so they're drained and discarded once they become visible again
+class OverlayEventRouter
+{
+    public:
+        struct EventRecord
+        {
+            unsigned int OverlayID;
+            vr::VROverlayHandle_t OverlayHandle;        //Used to verify the ID is still valid during dispatch
+            vr::VREvent_t Event;
+        };
+
+        enum PollAction
+        {
+            poll_action_skip,                           //Don't poll the queue
+            poll_action_route,                          //Poll the queue and add its events
+            poll_action_discard                         //Poll the queue and throw its events away, they were queued while the overlay wasn't polled
+        };
+
+        static const uint64_t s_PollGracePeriodMs = 1000;   //Time overlays are still polled after being hidden, long enough to catch focus leave and similar events
+
+    private:
+        std::vector<EventRecord> m_Events;
+        std::unordered_map<vr::VROverlayHandle_t, uint64_t> m_LastVisibleTick;
+        size_t m_CoalescedCount = 0;
+
+    public:
+        void BeginCollect();                            //Clears events from the last collection
+        //Returns what to do with the overlay's queue. Call for every overlay on each collection to keep track of visibility
+        PollAction GetPollAction(vr::VROverlayHandle_t overlay_handle, bool is_visible, uint64_t tick);
+        //Adds polled event, coalescing it with the last added one if possible
+        void AddEvent(unsigned int overlay_id, vr::VROverlayHandle_t overlay_handle, const vr::VREvent_t& vr_event);
+        void ForgetOverlay(vr::VROverlayHandle_t overlay_handle);
+
+        const std::vector<EventRecord>& GetEvents() const;
+        size_t GetCoalescedCount() const;               //Number of events merged into others since last BeginCollect()
+
+        static bool CanCoalesce(const vr::VREvent_t& event_prev, const vr::VREvent_t& event_next);
+        static void Coalesce(vr::VREvent_t& event_prev, const vr::VREvent_t& event_next);
+};
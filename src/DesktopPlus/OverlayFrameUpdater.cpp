@@ -0,0 +1,186 @@
+#include "OverlayFrameUpdater.h"
+
+#include <algorithm>
+
+#include "Util.h"
+
+void OverlayFrameUpdater::Compute(OverlayFrameJob& job)
+{
+    if (job.DoTransformUpdate)
+    {
+        Matrix4 matrix = job.BaseOffset;
+        matrix *= job.Transform;
+
+        //Offset transform by additional offset values
+        matrix.translate_relative(job.Offset.x, job.Offset.y, job.Offset.z);
+
+        //Use overlay's smoothers to filter the new matrix' position and rotation
+        if ( (job.SmoothingLevel != 0) && (job.SmootherPos != nullptr) && (job.SmootherRot != nullptr) )
+        {
+            ApplySmoothingParameters(*job.SmootherPos, *job.SmootherRot, job.SmoothingLevel);
+            matrix.setTranslation( job.SmootherPos->Filter(matrix.getTranslation()) );
+            matrix.setRotation(    job.SmootherRot->FilterWrapped(matrix.getRotation(), 0.0f, 360.0f) );
+        }
+
+        job.TransformResult = matrix;
+    }
+
+    if (job.DoGazeFade)
+    {
+        //When drag/select mode are active or HMD pose not available, default to most visible alpha setting
+        const float max_alpha = job.OpacityMax;
+        const float min_alpha = job.OpacityMin;
+        float alpha = std::max(min_alpha, max_alpha);
+
+        const vr::TrackedDevicePose_t& pose_hmd = job.PoseHMD;
+
+        //Also keep max alpha when the overlay or the Floating UI targeting the overlay is being pointed at (already part of GazeFadeForceMaxOpacity)
+        if ( (!job.GazeFadeForceMaxOpacity) && (pose_hmd.bPoseIsValid) )
+        {
+            //Distance the gaze point is offset from HMD (useful range 0.25 - 1.0)
+            float gaze_distance = job.GazeDistance;
+            //Rate the fading gets applied when looking off the gaze point (useful range 4.0 - 30, depends on overlay size) 
+            const float fade_rate = job.GazeRate * 10.0f;
+
+            Matrix4 mat_pose = pose_hmd.mDeviceToAbsoluteTracking;
+
+            Matrix4 mat_overlay = job.BaseOffset;
+            mat_overlay *= job.Transform;
+
+            //Infinite/Auto distance mode
+            if (gaze_distance == 0.0f) 
+            {
+                gaze_distance = mat_overlay.getTranslation().distance(mat_pose.getTranslation()); //Match gaze distance to distance between HMD and overlay
+            }
+            else
+            {
+                gaze_distance += 0.20f; //Useful range starts at ~0.20 - 0.25 (lower is in HMD or culled away), so offset the settings value
+            }
+
+            mat_pose.translate_relative(0.0f, 0.0f, -gaze_distance);
+
+            Vector3 pos_gaze = mat_pose.getTranslation();
+            float distance = mat_overlay.getTranslation().distance(pos_gaze);
+
+            gaze_distance = std::min(gaze_distance, 1.0f); //To get useful fading past 1m distance we'll have to limit the value to 1m here for the math below
+
+            alpha = clamp((distance * -fade_rate) + ((gaze_distance - 0.1f) * 10.0f), 0.0f, 1.0f); //There's nothing smart behind this, just trial and error
+
+            //Adapt alpha result from a 0.0 - 1.0 range to gazefade_opacity - overlay_opacity and invert if necessary
+            const float range_length = max_alpha - min_alpha;
+
+            if (range_length >= 0.0f)
+            {
+                alpha = (alpha * range_length) + min_alpha;
+            }
+            else //Gaze Fade target opacity higher than overlay opcacity, invert behavior
+            {
+                alpha = ((alpha - 1.0f) * range_length) + max_alpha;
+            }
+        }
+
+        //Limit alpha change per frame to smooth out things when abrupt changes happen (i.e. overlay capture took a bit to re-enable or laser pointer forces full alpha)
+        const float diff = alpha - job.OpacityCurrent;
+
+        job.OpacityResult = job.OpacityCurrent + clamp(diff, -0.1f, 0.1f);
+    }
+}
+
+void OverlayFrameUpdater::ApplySmoothingParameters(RadialFollowCore& smoother_pos, RadialFollowCore& smoother_rot, int preset_id)
+{
+    preset_id = clamp(preset_id, 0, 5);
+
+    switch (preset_id)
+    {
+        case 0: //Not really used, calling Filter() is skipped entirely instead
+        {
+            smoother_pos.SetOuterRadius(0.0);
+            smoother_pos.SetInnerRadius(0.0);
+            smoother_pos.SetSmoothingCoefficient(0.0);
+            smoother_pos.SetSoftKneeScale(0.0);
+            smoother_pos.SetSmoothingLeakCoefficient(0.0);
+
+            smoother_rot.SetOuterRadius(0.0);
+            smoother_rot.SetInnerRadius(0.0);
+            smoother_rot.SetSmoothingCoefficient(0.0);
+            smoother_rot.SetSoftKneeScale(0.0);
+            smoother_rot.SetSmoothingLeakCoefficient(0.0);
+            break;
+        }
+        case 1:
+        {
+            smoother_pos.SetOuterRadius(0.0);
+            smoother_pos.SetInnerRadius(0.0);
+            smoother_pos.SetSmoothingCoefficient(0.85);
+            smoother_pos.SetSoftKneeScale(1.0);
+            smoother_pos.SetSmoothingLeakCoefficient(1.0);
+
+            smoother_rot.SetOuterRadius(0.0);
+            smoother_rot.SetInnerRadius(0.0);
+            smoother_rot.SetSmoothingCoefficient(0.8);
+            smoother_rot.SetSoftKneeScale(1.0);
+            smoother_rot.SetSmoothingLeakCoefficient(1.0);
+            break;
+        }
+        case 2:
+        {
+            smoother_pos.SetOuterRadius(0.0);
+            smoother_pos.SetInnerRadius(0.0);
+            smoother_pos.SetSmoothingCoefficient(0.90);
+            smoother_pos.SetSoftKneeScale(1.0);
+            smoother_pos.SetSmoothingLeakCoefficient(0.95);
+
+            smoother_rot.SetOuterRadius(0.5);
+            smoother_rot.SetInnerRadius(0.0);
+            smoother_rot.SetSmoothingCoefficient(0.85);
+            smoother_rot.SetSoftKneeScale(1.0);
+            smoother_rot.SetSmoothingLeakCoefficient(1.0);
+            break;
+        }
+        case 3:
+        {
+            smoother_pos.SetOuterRadius(0.02);
+            smoother_pos.SetInnerRadius(0.01);
+            smoother_pos.SetSmoothingCoefficient(0.95);
+            smoother_pos.SetSoftKneeScale(1.0);
+            smoother_pos.SetSmoothingLeakCoefficient(0.90);
+
+            smoother_rot.SetOuterRadius(1.0);
+            smoother_rot.SetInnerRadius(0.5);
+            smoother_rot.SetSmoothingCoefficient(0.75);
+            smoother_rot.SetSoftKneeScale(1.0);
+            smoother_rot.SetSmoothingLeakCoefficient(1.00);
+            break;
+        }
+        case 4:
+        {
+            smoother_pos.SetOuterRadius(0.10);
+            smoother_pos.SetInnerRadius(0.10);
+            smoother_pos.SetSmoothingCoefficient(0.93);
+            smoother_pos.SetSoftKneeScale(1.0);
+            smoother_pos.SetSmoothingLeakCoefficient(0.97);
+
+            smoother_rot.SetOuterRadius(7.5);
+            smoother_rot.SetInnerRadius(7.5);
+            smoother_rot.SetSmoothingCoefficient(0.75);
+            smoother_rot.SetSoftKneeScale(0.8);
+            smoother_rot.SetSmoothingLeakCoefficient(1.0);
+            break;
+        }
+        case 5:
+        {
+            smoother_pos.SetOuterRadius(0.25);
+            smoother_pos.SetInnerRadius(0.20);
+            smoother_pos.SetSmoothingCoefficient(0.95);
+            smoother_pos.SetSoftKneeScale(1.0);
+            smoother_pos.SetSmoothingLeakCoefficient(0.97);
+
+            smoother_rot.SetOuterRadius(30.0);
+            smoother_rot.SetInnerRadius(10.0);
+            smoother_rot.SetSmoothingCoefficient(0.96);
+            smoother_rot.SetSoftKneeScale(0.80);
+            smoother_rot.SetSmoothingLeakCoefficient(0.85);
+            break;
+        }
+    }
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "openvr.h"
+#include "Matrices.h"
+#include "RadialFollowSmoothing.h"
+
+//Input and results of a single overlay's frame update
+//Inputs are gathered on the main thread, results are computed by OverlayFrameUpdater::Compute() and applied on the main thread again
+struct OverlayFrameJob
+{
+    unsigned int OverlayID = 0;
+
+    //Transform update (smoothed HMD and HMD Floor origins)
+    bool DoTransformUpdate = false;
+    Matrix4 BaseOffset;                             //From OverlayDragger::GetBaseOffsetMatrix(), also used for gaze fade
+    Matrix4 Transform;                              //Overlay's detached transform
+    Vector3 Offset;                                 //Offset right, up and forward
+    int SmoothingLevel = 0;
+    RadialFollowCore* SmootherPos = nullptr;
+    RadialFollowCore* SmootherRot = nullptr;
+
+    //Gaze Fade
+    bool DoGazeFade = false;
+    bool GazeFadeForceMaxOpacity = false;           //True when drag/select mode is active or the overlay is being pointed at
+    vr::TrackedDevicePose_t PoseHMD = {};           //From the frame's TrackedPoseSnapshot
+    float OpacityMax     = 1.0f;
+    float OpacityMin     = 0.0f;
+    float GazeDistance   = 0.0f;
+    float GazeRate       = 0.0f;
+    float OpacityCurrent = 1.0f;
+
+    //Results
+    Matrix4 TransformResult;
+    float OpacityResult = 1.0f;
+};
+
+//Computes per-frame overlay updates. Compute() only depends on the job, so all OpenVR and config access stays in gathering and applying the jobs
+class OverlayFrameUpdater
+{
+    public:
+        static void Compute(OverlayFrameJob& job);
+        static void ApplySmoothingParameters(RadialFollowCore& smoother_pos, RadialFollowCore& smoother_rot, int preset_id);
+};
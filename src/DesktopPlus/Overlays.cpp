@@ -4,6 +4,7 @@
 
 #include "CommonTypes.h"
 #include "OpenVRExt.h"
+#include "OverlayStateMirror.h"
 #include "OverlayManager.h"
 #include "OutputManager.h"
 #include "DesktopPlusWinRT.h"
@@ -95,16 +96,16 @@ void Overlay::InitOverlay()
         overlay_handle_find = vr::k_ulOverlayHandleInvalid;
         id_offset++;
 
-        vr::VROverlay()->FindOverlay(key.c_str(), &overlay_handle_find);
+        OverlayStateMirror::Get().FindOverlay(key.c_str(), &overlay_handle_find);
     }
     while (overlay_handle_find != vr::k_ulOverlayHandleInvalid);
 
     vr::VROverlayError ovrl_error = vr::VROverlayError_None;
-    ovrl_error = vr::VROverlay()->CreateOverlay(key.c_str(), "Desktop+", &m_OvrlHandle);
+    ovrl_error = OverlayStateMirror::Get().CreateOverlay(key.c_str(), "Desktop+", &m_OvrlHandle);
 
     if (ovrl_error == vr::VROverlayError_None)
     {
-        vr::VROverlay()->SetOverlayAlpha(m_OvrlHandle, m_Opacity);
+        OverlayStateMirror::Get().SetOverlayAlpha(m_OvrlHandle, m_Opacity);
     } 
     else //Creation failed, send error to UI so the user at least knows (typically this only happens when the overlay limit is exceeded)
     {
@@ -187,7 +188,7 @@ void Overlay::SetOpacity(float opacity)
     if (data.ConfigInt[configid_int_overlay_origin] == ovrl_origin_theater_screen)
         opacity = std::max(opacity, 0.00001f);
 
-    vr::VROverlay()->SetOverlayAlpha(m_OvrlHandle, opacity);
+    OverlayStateMirror::Get().SetOverlayAlpha(m_OvrlHandle, opacity);
 
     if (m_Opacity == 0.0f) //If it was previously 0%, show if needed
     {
@@ -219,7 +220,7 @@ float Overlay::GetOpacity() const
 void Overlay::SetVisible(bool visible)
 {
     m_Visible = visible;
-    (visible) ? vr::VROverlay()->ShowOverlay(m_OvrlHandle) : vr::VROverlay()->HideOverlay(m_OvrlHandle);
+    (visible) ? OverlayStateMirror::Get().ShowOverlay(m_OvrlHandle) : OverlayStateMirror::Get().HideOverlay(m_OvrlHandle);
 
     m_SmootherPos.ResetLastPos();
     m_SmootherRot.ResetLastPos();
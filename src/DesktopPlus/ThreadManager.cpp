@@ -8,6 +8,7 @@ DWORD WINAPI CaptureThreadEntry(_In_ void* Param);
 void DDPThreadManager::Clean()
 {
     m_PtrInfo = DDPPtrInfo();
+    m_RegionOfInterest = DDPRegionOfInterest();
 
     for (const auto& thread_handle : m_ThreadHandles)
     {
@@ -15,7 +16,17 @@ void DDPThreadManager::Clean()
     }
     m_ThreadHandles.clear();
 
+    for (const auto& thread_data : m_ThreadData)
+    {
+        if (thread_data.OutputDemandEvent != nullptr)
+        {
+            ::CloseHandle(thread_data.OutputDemandEvent);
+        }
+    }
+
     m_ThreadData.clear();
+    m_OutputRects.clear();
+    m_OutputDemand.clear();
 }
 
 
@@ -27,6 +38,8 @@ DDPDuplReturn DDPThreadManager::Initialize(INT SingleOutput, UINT OutputCount, H
                                            HANDLE SharedHandle, const RECT& DesktopDim, Microsoft::WRL::ComPtr<IDXGIAdapter> DXGIAdapter, bool WMRIgnoreVScreens)
 {
     m_ThreadData.resize(OutputCount);
+    m_OutputRects.resize(OutputCount);
+    m_OutputDemand.assign(OutputCount, true);   //Threads start out unparked
 
     // Create appropriate # of threads for duplication
     DDPDuplReturn Ret = ddp_dupl_return_success;
@@ -46,8 +59,23 @@ DDPDuplReturn DDPThreadManager::Initialize(INT SingleOutput, UINT OutputCount, H
         ThreadData.OffsetY                = DesktopDim.top;
         ThreadData.PtrInfo                = &m_PtrInfo;
         ThreadData.DirtyRegionTotal       = &m_DirtyRegionTotal;
+        ThreadData.RegionOfInterest       = &m_RegionOfInterest;
         ThreadData.WMRIgnoreVScreens      = WMRIgnoreVScreens;
 
+        //Event signaled while the output is needed by any visible overlay
+        ThreadData.OutputDemandEvent = ::CreateEvent(nullptr, TRUE, TRUE, nullptr);
+        if (ThreadData.OutputDemandEvent == nullptr)
+        {
+            return ProcessFailure(nullptr, L"OutputDemandEvent creation failed", L"Desktop+ Error", E_UNEXPECTED);
+        }
+
+        //Cache output rect in shared surface coordinates. Left empty if unknown, which keeps the thread from ever being parked
+        //This uses the thread's actual output instead of indexing the cached desktop rects as those span all adapters
+        if (GetOutputDesktopRect(ThreadData.Output, WMRIgnoreVScreens, m_OutputRects[i]))
+        {
+            m_OutputRects[i].Translate({-DesktopDim.left, -DesktopDim.top});
+        }
+
         Ret = InitializeDx(ThreadData.DxRes, DXGIAdapter.Get());
         if (Ret != ddp_dupl_return_success)
         {
@@ -68,6 +96,60 @@ DDPDuplReturn DDPThreadManager::Initialize(INT SingleOutput, UINT OutputCount, H
     return Ret;
 }
 
+//
+// Get desktop coordinates of the output a capture thread duplicates
+//
+bool DDPThreadManager::GetOutputDesktopRect(UINT Output, bool WMRIgnoreVScreens, DPRect& OutRect)
+{
+    Microsoft::WRL::ComPtr<IDXGIFactory1> factory_ptr;
+
+    HRESULT hr = CreateDXGIFactory1(__uuidof(IDXGIFactory1), (void**)&factory_ptr);
+    if (FAILED(hr))
+        return false;
+
+    Microsoft::WRL::ComPtr<IDXGIAdapter> adapter_ptr;
+    UINT i = 0;
+    UINT output_count = 0;
+
+    while (factory_ptr->EnumAdapters(i, &adapter_ptr) != DXGI_ERROR_NOT_FOUND)
+    {
+        //Check if this a WMR virtual display adapter and skip it when the option is enabled
+        if (WMRIgnoreVScreens)
+        {
+            DXGI_ADAPTER_DESC adapter_desc;
+            adapter_ptr->GetDesc(&adapter_desc);
+
+            if (wcscmp(adapter_desc.Description, L"Virtual Display Adapter") == 0)
+            {
+                ++i;
+                continue;
+            }
+        }
+
+        Microsoft::WRL::ComPtr<IDXGIOutput> output_ptr;
+        UINT output_index = 0;
+        while (adapter_ptr->EnumOutputs(output_index, &output_ptr) != DXGI_ERROR_NOT_FOUND)
+        {
+            if (output_count == Output)
+            {
+                DXGI_OUTPUT_DESC output_desc;
+                output_ptr->GetDesc(&output_desc);
+
+                OutRect = DPRect(output_desc.DesktopCoordinates.left,  output_desc.DesktopCoordinates.top, 
+                                 output_desc.DesktopCoordinates.right, output_desc.DesktopCoordinates.bottom);
+                return true;
+            }
+
+            ++output_count;
+            ++output_index;
+        }
+
+        ++i;
+    }
+
+    return false;
+}
+
 //
 // Get DDPDxResources
 //
@@ -166,6 +248,75 @@ DPRect& DDPThreadManager::GetDirtyRegionTotal()
     return m_DirtyRegionTotal;
 }
 
+DDPRegionOfInterest& DDPThreadManager::GetRegionOfInterest()
+{
+    return m_RegionOfInterest;
+}
+
+//
+// Parks or resumes capture threads depending on whether their output is visible in any of the demand rects
+//
+bool DDPThreadManager::UpdateOutputDemand(const std::vector<DPRect>& DemandRects)
+{
+    if (m_ThreadData.empty())
+        return false;
+
+    ComputeOutputDemand(m_OutputRects, DemandRects, m_OutputDemandNew);
+
+    bool resumed_any = false;
+    for (size_t i = 0; i < m_ThreadData.size(); ++i)
+    {
+        if (m_OutputDemandNew[i] == m_OutputDemand[i])
+            continue;
+
+        if (m_OutputDemandNew[i])
+        {
+            //Thread does a full refresh of its output after waking up
+            ::SetEvent(m_ThreadData[i].OutputDemandEvent);
+            resumed_any = true;
+        }
+        else
+        {
+            ::ResetEvent(m_ThreadData[i].OutputDemandEvent);
+        }
+
+        m_OutputDemand[i] = m_OutputDemandNew[i];
+    }
+
+    //Same workaround as when resuming all threads, makes sure the resumed outputs get a new frame soon
+    if (resumed_any)
+    {
+        ForceScreenRefresh();
+    }
+
+    return resumed_any;
+}
+
+void DDPThreadManager::ComputeOutputDemand(const std::vector<DPRect>& OutputRects, const std::vector<DPRect>& DemandRects, std::vector<bool>& OutDemand)
+{
+    OutDemand.assign(OutputRects.size(), false);
+
+    for (size_t i = 0; i < OutputRects.size(); ++i)
+    {
+        const DPRect& output_rect = OutputRects[i];
+
+        if ( (output_rect.GetWidth() <= 0) || (output_rect.GetHeight() <= 0) )
+        {
+            OutDemand[i] = true;
+            continue;
+        }
+
+        for (const DPRect& demand_rect : DemandRects)
+        {
+            if (output_rect.Overlaps(demand_rect))
+            {
+                OutDemand[i] = true;
+                break;
+            }
+        }
+    }
+}
+
 //
 // Waits infinitely for all spawned threads to terminate
 //
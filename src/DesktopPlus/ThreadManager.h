@@ -12,15 +12,28 @@ class DDPThreadManager
                                  HANDLE SharedHandle, const RECT& DesktopDim, Microsoft::WRL::ComPtr<IDXGIAdapter> DXGIAdapter, bool WMRIgnoreVScreens);
         DDPPtrInfo& GetPointerInfo();       //Should only be called when shared surface mutex has be aquired
         DPRect& GetDirtyRegionTotal();      //Should only be called when shared surface mutex has be aquired
+        DDPRegionOfInterest& GetRegionOfInterest(); //Should only be called when shared surface mutex has be aquired
         void WaitForThreadTermination();
 
+        //Parks capture threads of outputs not overlapping any of the demand rects (shared surface coordinates) and resumes the ones that do
+        //Resumed threads do a full refresh of their output. Returns true if any thread was resumed
+        bool UpdateOutputDemand(const std::vector<DPRect>& DemandRects);
+
+        //Pure part of UpdateOutputDemand(). Outputs with an empty rect (unknown) are always considered in demand
+        static void ComputeOutputDemand(const std::vector<DPRect>& OutputRects, const std::vector<DPRect>& DemandRects, std::vector<bool>& OutDemand);
+
     private:
         DDPDuplReturn InitializeDx(DDPDxResources& Data, IDXGIAdapter* DXGIAdapter); //Doesn't Release() the DXGIAdapter
+        static bool GetOutputDesktopRect(UINT Output, bool WMRIgnoreVScreens, DPRect& OutRect);  //Finds the output the same way DDPDuplicationManager does
 
         DDPPtrInfo m_PtrInfo;
         DPRect m_DirtyRegionTotal;
+        DDPRegionOfInterest m_RegionOfInterest;
         std::vector<HANDLE> m_ThreadHandles;
         std::vector<DDPThreadData> m_ThreadData;
+        std::vector<DPRect> m_OutputRects;          //Output rects in shared surface coordinates, same order as m_ThreadData
+        std::vector<bool> m_OutputDemand;
+        std::vector<bool> m_OutputDemandNew;        //Kept around to avoid reallocating in UpdateOutputDemand()
 };
 
 #endif
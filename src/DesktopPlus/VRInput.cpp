@@ -4,6 +4,7 @@
 #define NOMINMAX
 #include <string>
 #include <sstream>
+#include <algorithm>
 #include <windows.h>
 
 #include "ConfigManager.h"
@@ -32,7 +33,8 @@ VRInput::VRInput() : m_HandleActionsetShortcuts(vr::k_ulInvalidActionSetHandle),
                      m_KeyboardDeviceToggleState{0},
                      m_KeyboardDeviceIsToggleKeyDown(false),
                      m_KeyboardDeviceClickState{0},
-                     m_KeyboardDeviceDragState{0}
+                     m_KeyboardDeviceDragState{0},
+                     m_IsLaserPointerDevicesInfoCacheValid(false)
 {
 }
 
@@ -141,6 +143,158 @@ vr::InputDigitalActionData_t VRInput::CombineDigitalActionData(vr::InputDigitalA
     return data_out;
 }
 
+void VRInput::UpdateLaserPointerDevicesInfoCache()
+{
+    VRInputDeviceInfoList& devices_info = m_LaserPointerDevicesInfoCache;
+    devices_info.Count = 0;
+
+    vr::VRInputValueHandle_t input_value_handles[vr::k_unMaxTrackedDeviceCount];
+    vr::VRInput()->GetActionOrigins(m_HandleActionsetLaserPointer, m_HandleActionLaserPointerLeftClick, input_value_handles, vr::k_unMaxTrackedDeviceCount);
+
+    vr::InputOriginInfo_t origin_info = {0};
+    for (auto input_value_handle : input_value_handles)
+    {
+        if ( (input_value_handle != vr::k_ulInvalidInputValueHandle) && (vr::VRInput()->GetOriginTrackedDeviceInfo(input_value_handle, &origin_info, sizeof(vr::InputOriginInfo_t)) == vr::VRInputError_None) )
+        {
+            devices_info.Items[devices_info.Count++] = origin_info;
+        }
+    }
+
+    //If GetActionOrigins() did not return anything useful, try at least getting origins for left and right hand controllers
+    if (devices_info.empty())
+    {
+        for (int controller_role = vr::TrackedControllerRole_LeftHand; controller_role <= vr::TrackedControllerRole_RightHand; ++controller_role)
+        {
+            origin_info = {0};
+
+            origin_info.trackedDeviceIndex = vr::VRSystem()->GetTrackedDeviceIndexForControllerRole((vr::ETrackedControllerRole)controller_role);
+
+            if (origin_info.trackedDeviceIndex != vr::k_unTrackedDeviceIndexInvalid)
+            {
+                vr::VRInput()->GetInputSourceHandle((controller_role == vr::TrackedControllerRole_LeftHand) ? "/user/hand/left" : "/user/hand/right", &origin_info.devicePath);
+
+                devices_info.Items[devices_info.Count++] = origin_info;
+            }
+        }
+    }
+
+    m_IsLaserPointerDevicesInfoCacheValid = true;
+}
+
+void VRInput::UpdateSnapshot()
+{
+    const bool use_keyboard_device = ConfigManager::GetValue(configid_bool_input_laser_pointer_hmd_device);
+
+    //Enable Global Laser Pointer is part of the shortcuts action set, which is always active
+    m_Snapshot.EnableGlobalLaserPointerState = {0};
+    vr::VRInput()->GetDigitalActionData(m_HandleActionEnableGlobalLaserPointer, &m_Snapshot.EnableGlobalLaserPointerState, sizeof(vr::InputDigitalActionData_t), 
+                                        vr::k_ulInvalidInputValueHandle);
+
+    if (use_keyboard_device)
+    {
+        m_Snapshot.EnableGlobalLaserPointerState = CombineDigitalActionData(m_Snapshot.EnableGlobalLaserPointerState, m_KeyboardDeviceToggleState);
+    }
+
+    //Laser pointer and scroll actions can only be active while their action sets are, so don't bother asking otherwise
+    m_Snapshot.ClickState.fill({0});
+    m_Snapshot.DragState           = {0};
+    m_Snapshot.ScrollDiscreteState = {0};
+    m_Snapshot.ScrollSmoothState   = {0};
+
+    if (m_IsLaserPointerInputActive)
+    {
+        ReadLaserPointerDigitalActionData(vr::k_ulInvalidInputValueHandle, m_Snapshot.ClickState, m_Snapshot.DragState);
+
+        if (m_LaserPointerScrollMode == vrinput_scroll_discrete)
+        {
+            vr::VRInput()->GetAnalogActionData(m_HandleActionLaserPointerScrollDiscrete, &m_Snapshot.ScrollDiscreteState, sizeof(vr::InputAnalogActionData_t), 
+                                               vr::k_ulInvalidInputValueHandle);
+        }
+        else if (m_LaserPointerScrollMode == vrinput_scroll_smooth)
+        {
+            vr::VRInput()->GetAnalogActionData(m_HandleActionLaserPointerScrollSmooth, &m_Snapshot.ScrollSmoothState, sizeof(vr::InputAnalogActionData_t), 
+                                               vr::k_ulInvalidInputValueHandle);
+        }
+    }
+
+    if (use_keyboard_device)
+    {
+        for (size_t i = 0; i < m_Snapshot.ClickState.size(); ++i)
+        {
+            m_Snapshot.ClickState[i] = CombineDigitalActionData(m_Snapshot.ClickState[i], m_KeyboardDeviceClickState[i]);
+        }
+
+        m_Snapshot.DragState = CombineDigitalActionData(m_Snapshot.DragState, m_KeyboardDeviceDragState);
+    }
+
+    //Device list, only asked from SteamVR Input when bindings or devices changed
+    if (!m_IsLaserPointerDevicesInfoCacheValid)
+    {
+        UpdateLaserPointerDevicesInfoCache();
+    }
+
+    m_Snapshot.LaserPointerDevicesInfo = m_LaserPointerDevicesInfoCache;
+
+    if (use_keyboard_device)
+    {
+        vr::InputOriginInfo_t& origin_info = m_Snapshot.LaserPointerDevicesInfo.Items[m_Snapshot.LaserPointerDevicesInfo.Count++];
+        origin_info = {0};
+        origin_info.trackedDeviceIndex = vr::k_unTrackedDeviceIndex_Hmd;    //Simulated Keyboard device is used for HMD interaction only so we use that
+        origin_info.devicePath = m_KeyboardDeviceInputValueHandle;
+    }
+
+    //Device-restricted state is read again on demand
+    m_Snapshot.DeviceActionStateCount = 0;
+}
+
+void VRInput::ReadLaserPointerDigitalActionData(vr::VRInputValueHandle_t restrict_to_device, std::array<vr::InputDigitalActionData_t, 5>& click_state, 
+                                                vr::InputDigitalActionData_t& drag_state) const
+{
+    vr::VRInput()->GetDigitalActionData(m_HandleActionLaserPointerLeftClick,   &click_state[0], sizeof(vr::InputDigitalActionData_t), restrict_to_device);
+    vr::VRInput()->GetDigitalActionData(m_HandleActionLaserPointerRightClick,  &click_state[1], sizeof(vr::InputDigitalActionData_t), restrict_to_device);
+    vr::VRInput()->GetDigitalActionData(m_HandleActionLaserPointerMiddleClick, &click_state[2], sizeof(vr::InputDigitalActionData_t), restrict_to_device);
+    vr::VRInput()->GetDigitalActionData(m_HandleActionLaserPointerAux01Click,  &click_state[3], sizeof(vr::InputDigitalActionData_t), restrict_to_device);
+    vr::VRInput()->GetDigitalActionData(m_HandleActionLaserPointerAux02Click,  &click_state[4], sizeof(vr::InputDigitalActionData_t), restrict_to_device);
+    vr::VRInput()->GetDigitalActionData(m_HandleActionLaserPointerDrag,        &drag_state,     sizeof(vr::InputDigitalActionData_t), restrict_to_device);
+}
+
+const VRInputDeviceActionState& VRInput::GetDeviceActionState(vr::VRInputValueHandle_t device) const
+{
+    auto states_begin = m_Snapshot.DeviceActionStates.begin();
+    auto states_end   = states_begin + m_Snapshot.DeviceActionStateCount;
+    auto it = std::find_if(states_begin, states_end, [&](const auto& state){ return (state.InputValueHandle == device); });
+
+    if (it != states_end)
+        return *it;
+
+    //Not read yet this frame. Reuse the last slot if somehow full, it's only state for a single frame either way
+    if (m_Snapshot.DeviceActionStateCount < m_Snapshot.DeviceActionStates.size())
+    {
+        m_Snapshot.DeviceActionStateCount++;
+    }
+
+    VRInputDeviceActionState& state = m_Snapshot.DeviceActionStates[m_Snapshot.DeviceActionStateCount - 1];
+    state = VRInputDeviceActionState();
+    state.InputValueHandle = device;
+
+    if (m_IsLaserPointerInputActive)
+    {
+        ReadLaserPointerDigitalActionData(device, state.ClickState, state.DragState);
+    }
+
+    if ( (device == m_KeyboardDeviceInputValueHandle) && (ConfigManager::GetValue(configid_bool_input_laser_pointer_hmd_device)) )
+    {
+        for (size_t i = 0; i < state.ClickState.size(); ++i)
+        {
+            state.ClickState[i] = CombineDigitalActionData(state.ClickState[i], m_KeyboardDeviceClickState[i]);
+        }
+
+        state.DragState = CombineDigitalActionData(state.DragState, m_KeyboardDeviceDragState);
+    }
+
+    return state;
+}
+
 bool VRInput::Init()
 {
     //Load manifest, this will fail with VRInputError_MismatchedActionManifest when a Steam configured manifest is already associated with the app key, but we can just ignore that
@@ -251,6 +405,8 @@ void VRInput::Update()
     {
         RefreshAnyGlobalActionBound();
     }
+
+    UpdateSnapshot();
 }
 
 void VRInput::RefreshAnyGlobalActionBound()
@@ -276,6 +432,9 @@ void VRInput::RefreshAnyGlobalActionBound()
         return false;
     };
 
+    //Bindings or devices changed, so the laser pointer device list needs to be refreshed as well
+    m_IsLaserPointerDevicesInfoCacheValid = false;
+
     //Doesn't trigger on app start since its actions are not valid yet
     m_IsAnyGlobalActionBound = false;
 
@@ -333,9 +492,7 @@ void VRInput::TriggerLaserPointerHaptics(vr::VRInputValueHandle_t restrict_to_de
         //All devices, but we're going to exclude the gamepad one and trigger manually for the rest
         //Asking for haptic action origin doesn't seem to work, but GetLaserPointerDevicesInfo() gets every device with left click bound, which is good enough
         //This function is usually not called with this value either way
-        std::vector<vr::InputOriginInfo_t> lp_devices_info = GetLaserPointerDevicesInfo();
-
-        for (vr::InputOriginInfo_t device_info : lp_devices_info)
+        for (const vr::InputOriginInfo_t& device_info : GetLaserPointerDevicesInfo())
         {
             if (device_info.devicePath != m_GamepadDeviceInputValueHandle)
             {
@@ -364,6 +521,17 @@ vr::InputOriginInfo_t VRInput::GetOriginTrackedDeviceInfoEx(vr::VRInputValueHand
     {
         origin_info.trackedDeviceIndex = vr::k_unTrackedDeviceIndex_Hmd;
         origin_info.devicePath = origin;
+
+        return origin_info;
+    }
+
+    //Action origins are usually the devices themselves, which are already known from the snapshot
+    const VRInputDeviceInfoList& devices_info = m_Snapshot.LaserPointerDevicesInfo;
+    const auto it = std::find_if(devices_info.begin(), devices_info.end(), [&](const auto& device_info){ return (device_info.devicePath == origin); });
+
+    if (it != devices_info.end())
+    {
+        origin_info = *it;
     }
     else
     {
@@ -375,133 +543,43 @@ vr::InputOriginInfo_t VRInput::GetOriginTrackedDeviceInfoEx(vr::VRInputValueHand
 
 vr::InputDigitalActionData_t VRInput::GetEnableGlobalLaserPointerState() const
 {
-    vr::InputDigitalActionData_t data;
-    vr::VRInput()->GetDigitalActionData(m_HandleActionEnableGlobalLaserPointer, &data, sizeof(data), vr::k_ulInvalidInputValueHandle);
-
-    if (ConfigManager::GetValue(configid_bool_input_laser_pointer_hmd_device))
-    {
-        data = CombineDigitalActionData(data, m_KeyboardDeviceToggleState);
-    }
-
-    return data;
+    return m_Snapshot.EnableGlobalLaserPointerState;
 }
 
-std::vector<vr::InputOriginInfo_t> VRInput::GetLaserPointerDevicesInfo() const
+const VRInputDeviceInfoList& VRInput::GetLaserPointerDevicesInfo() const
 {
-    std::vector<vr::InputOriginInfo_t> devices_info;
-    vr::VRInputValueHandle_t input_value_handles[vr::k_unMaxTrackedDeviceCount];
-    vr::EVRInputError err = vr::VRInput()->GetActionOrigins(m_HandleActionsetLaserPointer, m_HandleActionLaserPointerLeftClick, input_value_handles, vr::k_unMaxTrackedDeviceCount);
-
-    vr::InputOriginInfo_t origin_info = {0};
-    for (auto input_value_handle : input_value_handles)
-    {
-        if ( (input_value_handle != vr::k_ulInvalidInputValueHandle) && (vr::VRInput()->GetOriginTrackedDeviceInfo(input_value_handle, &origin_info, sizeof(vr::InputOriginInfo_t)) == vr::VRInputError_None) )
-        {
-            devices_info.push_back(origin_info);
-        }
-    }
-
-    //If GetActionOrigins() did not return anything useful, try at least getting origins for left and right hand controllers
-    if (devices_info.empty())
-    {
-        for (int controller_role = vr::TrackedControllerRole_LeftHand; controller_role <= vr::TrackedControllerRole_RightHand; ++controller_role)
-        {
-            origin_info = {0};
-
-            origin_info.trackedDeviceIndex = vr::VRSystem()->GetTrackedDeviceIndexForControllerRole((vr::ETrackedControllerRole)controller_role);
-
-            if (origin_info.trackedDeviceIndex != vr::k_unTrackedDeviceIndexInvalid)
-            {
-                vr::VRInputValueHandle_t input_value = vr::k_ulInvalidInputValueHandle;
-                vr::VRInput()->GetInputSourceHandle((controller_role == vr::TrackedControllerRole_LeftHand) ? "/user/hand/left" : "/user/hand/right", &origin_info.devicePath);
-
-                devices_info.push_back(origin_info);
-            }
-        }
-    }
-
-    if (ConfigManager::GetValue(configid_bool_input_laser_pointer_hmd_device))
-    {
-        vr::InputOriginInfo_t origin_info = {0};
-        origin_info.trackedDeviceIndex = vr::k_unTrackedDeviceIndex_Hmd;    //Simulated Keyboard device is used for HMD interaction only so we use that
-        origin_info.devicePath = m_KeyboardDeviceInputValueHandle;
-
-        devices_info.push_back(origin_info);
-    }
-
-    return devices_info;
+    return m_Snapshot.LaserPointerDevicesInfo;
 }
 
 vr::InputDigitalActionData_t VRInput::GetLaserPointerLeftClickState(vr::VRInputValueHandle_t restrict_to_device) const
 {
-    vr::InputDigitalActionData_t data = {0};
-    vr::VRInput()->GetDigitalActionData(m_HandleActionLaserPointerLeftClick, &data, sizeof(data), restrict_to_device);
-
-    if (ConfigManager::GetValue(configid_bool_input_laser_pointer_hmd_device))
-    {
-        if ((restrict_to_device == vr::k_ulInvalidInputValueHandle) || (restrict_to_device == m_KeyboardDeviceInputValueHandle))
-        {
-            data = CombineDigitalActionData(data, m_KeyboardDeviceClickState[0]);
-        }
-    }
-
-    return data;
+    return GetLaserPointerClickState(restrict_to_device)[0];
 }
 
 std::array<vr::InputDigitalActionData_t, 5> VRInput::GetLaserPointerClickState(vr::VRInputValueHandle_t restrict_to_device) const
 {
-    std::array<vr::InputDigitalActionData_t, 5> data = {0};
-
-    vr::VRInput()->GetDigitalActionData(m_HandleActionLaserPointerLeftClick,   &data[0], sizeof(vr::InputDigitalActionData_t), restrict_to_device);
-    vr::VRInput()->GetDigitalActionData(m_HandleActionLaserPointerRightClick,  &data[1], sizeof(vr::InputDigitalActionData_t), restrict_to_device);
-    vr::VRInput()->GetDigitalActionData(m_HandleActionLaserPointerMiddleClick, &data[2], sizeof(vr::InputDigitalActionData_t), restrict_to_device);
-    vr::VRInput()->GetDigitalActionData(m_HandleActionLaserPointerAux01Click,  &data[3], sizeof(vr::InputDigitalActionData_t), restrict_to_device);
-    vr::VRInput()->GetDigitalActionData(m_HandleActionLaserPointerAux02Click,  &data[4], sizeof(vr::InputDigitalActionData_t), restrict_to_device);
-
-    if (ConfigManager::GetValue(configid_bool_input_laser_pointer_hmd_device))
-    {
-        if ((restrict_to_device == vr::k_ulInvalidInputValueHandle) || (restrict_to_device == m_KeyboardDeviceInputValueHandle))
-        {
-            for (int i = 0; i < data.size(); ++i)
-            {
-                data[i] = CombineDigitalActionData(data[i], m_KeyboardDeviceClickState[i]);
-            }
-        }
-    }
+    if (restrict_to_device == vr::k_ulInvalidInputValueHandle)
+        return m_Snapshot.ClickState;
 
-    return data;
+    return GetDeviceActionState(restrict_to_device).ClickState;
 }
 
 vr::InputAnalogActionData_t VRInput::GetLaserPointerScrollDiscreteState() const
 {
-    vr::InputAnalogActionData_t data = {0};
-    vr::VRInput()->GetAnalogActionData(m_HandleActionLaserPointerScrollDiscrete, &data, sizeof(vr::InputAnalogActionData_t), vr::k_ulInvalidInputValueHandle);
-
-    return data;
+    return m_Snapshot.ScrollDiscreteState;
 }
 
 vr::InputAnalogActionData_t VRInput::GetLaserPointerScrollSmoothState() const
 {
-    vr::InputAnalogActionData_t data = {0};
-    vr::VRInput()->GetAnalogActionData(m_HandleActionLaserPointerScrollSmooth, &data, sizeof(vr::InputAnalogActionData_t), vr::k_ulInvalidInputValueHandle);
-
-    return data;
+    return m_Snapshot.ScrollSmoothState;
 }
 
 vr::InputDigitalActionData_t VRInput::GetLaserPointerDragState(vr::VRInputValueHandle_t restrict_to_device) const
 {
-    vr::InputDigitalActionData_t data = {0};
-    vr::VRInput()->GetDigitalActionData(m_HandleActionLaserPointerDrag, &data, sizeof(data), restrict_to_device);
-
-    if (ConfigManager::GetValue(configid_bool_input_laser_pointer_hmd_device))
-    {
-        if ((restrict_to_device == vr::k_ulInvalidInputValueHandle) || (restrict_to_device == m_KeyboardDeviceInputValueHandle))
-        {
-            data = CombineDigitalActionData(data, m_KeyboardDeviceDragState);
-        }
-    }
+    if (restrict_to_device == vr::k_ulInvalidInputValueHandle)
+        return m_Snapshot.DragState;
 
-    return data;
+    return GetDeviceActionState(restrict_to_device).DragState;
 }
 
 void VRInput::SetLaserPointerActive(bool is_active)
@@ -528,3 +606,8 @@ vr::VRInputValueHandle_t VRInput::GetKeyboardDeviceInputValueHandle() const
 {
     return m_KeyboardDeviceInputValueHandle;
 }
+
+const VRInputSnapshot& VRInput::GetSnapshot() const
+{
+    return m_Snapshot;
+}
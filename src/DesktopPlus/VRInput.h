@@ -20,6 +20,40 @@ enum VRInputScrollMode
     vrinput_scroll_smooth,
 };
 
+//Fixed-size list of laser pointer input devices, iterable like a container
+struct VRInputDeviceInfoList
+{
+    std::array<vr::InputOriginInfo_t, vr::k_unMaxTrackedDeviceCount + 1> Items;   //+1 for the simulated keyboard device
+    size_t Count = 0;
+
+    const vr::InputOriginInfo_t* begin() const { return Items.data(); }
+    const vr::InputOriginInfo_t* end()   const { return Items.data() + Count; }
+    bool empty()                         const { return (Count == 0); }
+};
+
+//Laser pointer action state restricted to a single input device
+struct VRInputDeviceActionState
+{
+    vr::VRInputValueHandle_t InputValueHandle = vr::k_ulInvalidInputValueHandle;
+    std::array<vr::InputDigitalActionData_t, 5> ClickState = {0};
+    vr::InputDigitalActionData_t DragState = {0};
+};
+
+//Input state of a single frame. Built once in VRInput::Update() so all queries in the same frame see the same data without calling into SteamVR Input again.
+//Device-restricted state is only read for devices that are actually queried, but at most once per frame as well.
+struct VRInputSnapshot
+{
+    vr::InputDigitalActionData_t EnableGlobalLaserPointerState = {0};
+    std::array<vr::InputDigitalActionData_t, 5> ClickState = {0};                  //Any device, keyboard device merged
+    vr::InputDigitalActionData_t DragState = {0};                                  //Any device, keyboard device merged
+    vr::InputAnalogActionData_t ScrollDiscreteState = {0};
+    vr::InputAnalogActionData_t ScrollSmoothState = {0};
+    VRInputDeviceInfoList LaserPointerDevicesInfo;
+
+    std::array<VRInputDeviceActionState, vr::k_unMaxTrackedDeviceCount + 1> DeviceActionStates;
+    size_t DeviceActionStateCount = 0;
+};
+
 //Can't be used with open dashboard, but handles global shortcuts and Desktop+ laser pointer input instead.
 class VRInput
 {
@@ -55,7 +89,16 @@ class VRInput
         std::array<vr::InputDigitalActionData_t, 5> m_KeyboardDeviceClickState;
         vr::InputDigitalActionData_t m_KeyboardDeviceDragState;
 
+        VRInputDeviceInfoList m_LaserPointerDevicesInfoCache;    //Without keyboard device, refreshed when bindings or devices change
+        bool m_IsLaserPointerDevicesInfoCacheValid;
+        mutable VRInputSnapshot m_Snapshot;                     //Device-restricted state is filled on demand, so it's mutable
+
         void UpdateKeyboardDeviceState();
+        void UpdateLaserPointerDevicesInfoCache();
+        void UpdateSnapshot();
+        void ReadLaserPointerDigitalActionData(vr::VRInputValueHandle_t restrict_to_device, std::array<vr::InputDigitalActionData_t, 5>& click_state, 
+                                               vr::InputDigitalActionData_t& drag_state) const;
+        const VRInputDeviceActionState& GetDeviceActionState(vr::VRInputValueHandle_t device) const;
 
         static vr::InputDigitalActionData_t CombineDigitalActionData(vr::InputDigitalActionData_t data_a, vr::InputDigitalActionData_t data_b);
 
@@ -66,11 +109,11 @@ class VRInput
         void RefreshAnyGlobalActionBound();
         void HandleGlobalActionShortcuts(OutputManager& outmgr);
         void TriggerLaserPointerHaptics(vr::VRInputValueHandle_t restrict_to_device = vr::k_ulInvalidInputValueHandle) const;
-        vr::InputOriginInfo_t GetOriginTrackedDeviceInfoEx(vr::VRInputValueHandle_t origin) const; //Wraps GetOriginTrackedDeviceInfo() with keyboard device support
+        vr::InputOriginInfo_t GetOriginTrackedDeviceInfoEx(vr::VRInputValueHandle_t origin) const; //Wraps GetOriginTrackedDeviceInfo() with keyboard device support and snapshot lookup
 
         vr::InputDigitalActionData_t GetEnableGlobalLaserPointerState() const;
 
-        std::vector<vr::InputOriginInfo_t> GetLaserPointerDevicesInfo() const;
+        const VRInputDeviceInfoList& GetLaserPointerDevicesInfo() const;
         vr::InputDigitalActionData_t GetLaserPointerLeftClickState(vr::VRInputValueHandle_t restrict_to_device = vr::k_ulInvalidInputValueHandle)  const;
         std::array<vr::InputDigitalActionData_t, 5> GetLaserPointerClickState(vr::VRInputValueHandle_t restrict_to_device = vr::k_ulInvalidInputValueHandle)  const;
         vr::InputAnalogActionData_t GetLaserPointerScrollDiscreteState() const;
@@ -83,6 +126,7 @@ class VRInput
 
         bool IsAnyGlobalActionBound() const;
         vr::VRInputValueHandle_t GetKeyboardDeviceInputValueHandle() const;
+        const VRInputSnapshot& GetSnapshot() const;
 };
 
 #endif
\ No newline at end of file
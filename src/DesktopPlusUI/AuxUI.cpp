@@ -4,6 +4,7 @@
 #include "InterprocessMessaging.h"
 #include "WindowManager.h"
 #include "OpenVRExt.h"
+#include "OverlayStateMirror.h"
 
 AuxUIWindow::AuxUIWindow(AuxUIID ui_id) : m_AuxUIID(ui_id), m_Visible(false), m_Alpha(0.0f), m_IsTransitionFading(false), m_AutoSizeFrames(-1)
 {
@@ -48,7 +49,7 @@ bool AuxUIWindow::WindowUpdateBase()
         //Set overlay alpha when not in desktop mode
         if ( (!UIManager::Get()->IsInDesktopMode()) && (alpha_prev != m_Alpha) )
         {
-            vr::VROverlay()->SetOverlayAlpha(UIManager::Get()->GetOverlayHandleAuxUI(), m_Alpha);
+            OverlayStateMirror::Get().SetOverlayAlpha(UIManager::Get()->GetOverlayHandleAuxUI(), m_Alpha);
         }
     }
     else if (m_Alpha != 0.0f)
@@ -64,7 +65,7 @@ bool AuxUIWindow::WindowUpdateBase()
         //Set overlay alpha when not in desktop mode
         if ( (!UIManager::Get()->IsInDesktopMode()) && (alpha_prev != m_Alpha) )
         {
-            vr::VROverlay()->SetOverlayAlpha(UIManager::Get()->GetOverlayHandleAuxUI(), m_Alpha);
+            OverlayStateMirror::Get().SetOverlayAlpha(UIManager::Get()->GetOverlayHandleAuxUI(), m_Alpha);
         }
 
         if (m_Alpha == 0.0f)
@@ -81,7 +82,7 @@ bool AuxUIWindow::WindowUpdateBase()
             }
 
             if (!UIManager::Get()->IsInDesktopMode())
-                vr::VROverlay()->HideOverlay(UIManager::Get()->GetOverlayHandleAuxUI());
+                OverlayStateMirror::Get().HideOverlay(UIManager::Get()->GetOverlayHandleAuxUI());
         }
     }
     else
@@ -126,7 +127,7 @@ void AuxUIWindow::SetUpTextureBounds()
     bounds.uMax = clamp(int(m_Pos.x + m_Size.x + 2), rect_aux_ui.GetTL().x, rect_aux_ui.GetBR().x) / tex_width;
     bounds.vMax = clamp(int(m_Pos.y + m_Size.y + 2), rect_aux_ui.GetTL().y, rect_aux_ui.GetBR().y) / tex_height;
 
-    vr::VROverlay()->SetOverlayTextureBounds(UIManager::Get()->GetOverlayHandleAuxUI(), &bounds);
+    OverlayStateMirror::Get().SetOverlayTextureBounds(UIManager::Get()->GetOverlayHandleAuxUI(), &bounds);
 }
 
 void AuxUIWindow::StartTransitionFade()
@@ -195,14 +196,14 @@ void WindowDragHint::SetUpOverlay()
 
     const float overlay_width = OVERLAY_WIDTH_METERS_AUXUI_DRAG_HINT * (m_Size.x / 200.0f);   //Scale width based on window width for consistent sizing
 
-    vr::VROverlay()->SetOverlayWidthInMeters(overlay_handle, overlay_width);
-    vr::VROverlay()->SetOverlaySortOrder(overlay_handle, 100);
-    vr::VROverlay()->SetOverlayAlpha(overlay_handle, 0.0f);
-    vr::VROverlay()->SetOverlayInputMethod(overlay_handle, vr::VROverlayInputMethod_None);
+    OverlayStateMirror::Get().SetOverlayWidthInMeters(overlay_handle, overlay_width);
+    OverlayStateMirror::Get().SetOverlaySortOrder(overlay_handle, 100);
+    OverlayStateMirror::Get().SetOverlayAlpha(overlay_handle, 0.0f);
+    OverlayStateMirror::Get().SetOverlayInputMethod(overlay_handle, vr::VROverlayInputMethod_None);
 
     SetUpTextureBounds();
 
-    vr::VROverlay()->ShowOverlay(overlay_handle);
+    OverlayStateMirror::Get().ShowOverlay(overlay_handle);
 }
 
 void WindowDragHint::UpdateOverlayPos()
@@ -226,7 +227,7 @@ void WindowDragHint::UpdateOverlayPos()
 
         //Get poses
         vr::TrackedDevicePose_t poses[vr::k_unMaxTrackedDeviceCount];
-        vr::VRSystem()->GetDeviceToAbsoluteTrackingPose(vr::TrackingUniverseStanding, vr::IVRSystemEx::GetTimeNowToPhotons(), poses, vr::k_unMaxTrackedDeviceCount);
+        TrackedPoseSnapshot::Get().GetPoses(poses);
 
         if ( (poses[vr::k_unTrackedDeviceIndex_Hmd].bPoseIsValid) && (device_index < vr::k_unMaxTrackedDeviceCount)  && (poses[device_index].bPoseIsValid) )
         {
@@ -256,7 +257,7 @@ void WindowDragHint::UpdateOverlayPos()
 
     //Set transform
     vr::HmdMatrix34_t mat_ovr = mat.toOpenVR34();
-    vr::VROverlay()->SetOverlayTransformTrackedDeviceRelative(UIManager::Get()->GetOverlayHandleAuxUI(), device_index, &mat_ovr);
+    OverlayStateMirror::Get().SetOverlayTransformTrackedDeviceRelative(UIManager::Get()->GetOverlayHandleAuxUI(), device_index, &mat_ovr);
 }
 
 void WindowDragHint::ApplyPendingValues()
@@ -350,14 +351,14 @@ void WindowGazeFadeAutoHint::SetUpOverlay()
 {
     vr::VROverlayHandle_t overlay_handle = UIManager::Get()->GetOverlayHandleAuxUI();
 
-    vr::VROverlay()->SetOverlayWidthInMeters(overlay_handle, OVERLAY_WIDTH_METERS_AUXUI_GAZEFADE_AUTO_HINT);
-    vr::VROverlay()->SetOverlaySortOrder(overlay_handle, 100);
-    vr::VROverlay()->SetOverlayAlpha(overlay_handle, 0.0f);
-    vr::VROverlay()->SetOverlayInputMethod(overlay_handle, vr::VROverlayInputMethod_None);
+    OverlayStateMirror::Get().SetOverlayWidthInMeters(overlay_handle, OVERLAY_WIDTH_METERS_AUXUI_GAZEFADE_AUTO_HINT);
+    OverlayStateMirror::Get().SetOverlaySortOrder(overlay_handle, 100);
+    OverlayStateMirror::Get().SetOverlayAlpha(overlay_handle, 0.0f);
+    OverlayStateMirror::Get().SetOverlayInputMethod(overlay_handle, vr::VROverlayInputMethod_None);
 
     SetUpTextureBounds();
 
-    vr::VROverlay()->ShowOverlay(overlay_handle);
+    OverlayStateMirror::Get().ShowOverlay(overlay_handle);
 }
 
 void WindowGazeFadeAutoHint::UpdateOverlayPos()
@@ -368,7 +369,7 @@ void WindowGazeFadeAutoHint::UpdateOverlayPos()
 
     //Set transform
     vr::HmdMatrix34_t mat_ovr = mat.toOpenVR34();
-    vr::VROverlay()->SetOverlayTransformTrackedDeviceRelative(UIManager::Get()->GetOverlayHandleAuxUI(), vr::k_unTrackedDeviceIndex_Hmd, &mat_ovr);
+    OverlayStateMirror::Get().SetOverlayTransformTrackedDeviceRelative(UIManager::Get()->GetOverlayHandleAuxUI(), vr::k_unTrackedDeviceIndex_Hmd, &mat_ovr);
 }
 
 bool WindowGazeFadeAutoHint::Show()
@@ -492,15 +493,15 @@ void WindowQuickStart::SetUpOverlay()
 {
     vr::VROverlayHandle_t overlay_handle = UIManager::Get()->GetOverlayHandleAuxUI();
 
-    vr::VROverlay()->SetOverlayWidthInMeters(overlay_handle, OVERLAY_WIDTH_METERS_AUXUI_WINDOW_QUICKSTART);
-    vr::VROverlay()->SetOverlaySortOrder(overlay_handle, 2);
-    vr::VROverlay()->SetOverlayAlpha(overlay_handle, 0.0f);
-    vr::VROverlay()->SetOverlayInputMethod(overlay_handle, vr::VROverlayInputMethod_Mouse);
+    OverlayStateMirror::Get().SetOverlayWidthInMeters(overlay_handle, OVERLAY_WIDTH_METERS_AUXUI_WINDOW_QUICKSTART);
+    OverlayStateMirror::Get().SetOverlaySortOrder(overlay_handle, 2);
+    OverlayStateMirror::Get().SetOverlayAlpha(overlay_handle, 0.0f);
+    OverlayStateMirror::Get().SetOverlayInputMethod(overlay_handle, vr::VROverlayInputMethod_Mouse);
 
     SetUpTextureBounds();
     UpdateOverlayPos();
 
-    vr::VROverlay()->ShowOverlay(overlay_handle);
+    OverlayStateMirror::Get().ShowOverlay(overlay_handle);
 }
 
 void WindowQuickStart::UpdateOverlayPos()
@@ -665,7 +666,7 @@ void WindowQuickStart::UpdateOverlayPos()
 
     //Set transform
     vr::HmdMatrix34_t mat_ovr = m_Transform.toOpenVR34();
-    vr::VROverlay()->SetOverlayTransformAbsolute(UIManager::Get()->GetOverlayHandleAuxUI(), vr::TrackingUniverseStanding, &mat_ovr);
+    OverlayStateMirror::Get().SetOverlayTransformAbsolute(UIManager::Get()->GetOverlayHandleAuxUI(), vr::TrackingUniverseStanding, &mat_ovr);
 }
 
 void WindowQuickStart::OnPageChange(int page_id)
@@ -1083,21 +1084,21 @@ void WindowCaptureWindowSelect::SetUpOverlay()
 {
     vr::VROverlayHandle_t overlay_handle = UIManager::Get()->GetOverlayHandleAuxUI();
 
-    vr::VROverlay()->SetOverlayWidthInMeters(overlay_handle, OVERLAY_WIDTH_METERS_AUXUI_WINDOW_SELECT);
-    vr::VROverlay()->SetOverlaySortOrder(overlay_handle, 2);
-    vr::VROverlay()->SetOverlayAlpha(overlay_handle, 0.0f);
-    vr::VROverlay()->SetOverlayInputMethod(overlay_handle, vr::VROverlayInputMethod_Mouse);
+    OverlayStateMirror::Get().SetOverlayWidthInMeters(overlay_handle, OVERLAY_WIDTH_METERS_AUXUI_WINDOW_SELECT);
+    OverlayStateMirror::Get().SetOverlaySortOrder(overlay_handle, 2);
+    OverlayStateMirror::Get().SetOverlayAlpha(overlay_handle, 0.0f);
+    OverlayStateMirror::Get().SetOverlayInputMethod(overlay_handle, vr::VROverlayInputMethod_Mouse);
 
     //Take transform set by Overlay Bar and offset it a bit forward
     Matrix4 mat = m_Transform;
     mat.translate_relative(0.0f, 0.0f, 0.1f);
 
     vr::HmdMatrix34_t mat_ovr = mat.toOpenVR34();
-    vr::VROverlay()->SetOverlayTransformAbsolute(overlay_handle, vr::TrackingUniverseStanding, &mat_ovr);
+    OverlayStateMirror::Get().SetOverlayTransformAbsolute(overlay_handle, vr::TrackingUniverseStanding, &mat_ovr);
 
     SetUpTextureBounds();
 
-    vr::VROverlay()->ShowOverlay(overlay_handle);
+    OverlayStateMirror::Get().ShowOverlay(overlay_handle);
 }
 
 void WindowCaptureWindowSelect::ApplyPendingValues()
@@ -1201,7 +1202,7 @@ void WindowCaptureWindowSelect::Update()
         ImGui::SameLine(0.0f, 0.0f);
 
         //Window icon and title
-        int icon_id = TextureManager::Get().GetWindowIconCacheID(window_info.GetIcon());
+        int icon_id = TextureManager::Get().GetWindowIconCacheID(window_info);
 
         if (icon_id != -1)
         {
@@ -23,10 +23,12 @@
 #include "WindowSettings.h"
 #include "Util.h"
 #include "OpenVRExt.h"
+#include "OverlayStateMirror.h"
 #include "ImGuiExt.h"
 
 #include "DesktopPlusWinRT.h"
 #include "DPBrowserAPIClient.h"
+#include "StartupTimer.h"
 
 #include "WindowDesktopMode.h"
 
@@ -84,12 +86,17 @@ int WINAPI WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance, _
     //Init UITextureSpaces
     UITextureSpaces::Get().Init(desktop_mode, open_keyboard_editor);
 
+    StartupTimer startup_timer;
+
     //Init WinRT DLL
+    startup_timer.BeginStage("winrt_init");
     DPWinRT_Init();
     LOG_F(INFO, "Loaded WinRT library");
 
     //Init BrowserClientAPI (this doesn't start the browser process, only checks for presence)
+    startup_timer.BeginStage("browser_api_init");
     DPBrowserAPIClient::Get().Init();
+    startup_timer.EndStage();
 
     //Allow IPC messages even when elevated (though in normal operation, this process should not be elevated)
     IPCManager::Get().DisableUIPForRegisteredMessages(hwnd);
@@ -98,7 +105,10 @@ int WINAPI WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance, _
     UIManager ui_manager(desktop_mode, open_keyboard_editor);
     UIManager::IdleState& idle_state = ui_manager.GetIdleState();
 
+    //Loading the config also loads translation and keyboard layout
+    startup_timer.BeginStage("config_load");
     ConfigManager::Get().LoadConfigFromFile();
+    startup_timer.EndStage();
     IPCManager::Get().PostMessageToDashboardApp(ipcmsg_action, ipcact_sync_config_state);
     ui_manager.SetWindowHandle(hwnd);
 
@@ -106,6 +116,8 @@ int WINAPI WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance, _
     //Don't try to init OpenVR without the dashboard app running since checking for active VR means launching SteamVR
     if ( (!desktop_mode) || (IPCManager::IsDashboardAppRunning()) )
     {
+        startup_timer.BeginStage("openvr_init");
+
         if (ui_manager.InitOverlay() != vr::VRInitError_None)
         {
             ::UnregisterClass(wc.lpszClassName, wc.hInstance);
@@ -126,6 +138,8 @@ int WINAPI WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance, _
     DPLog_SteamVR_SystemInfo();
 
     // Initialize Direct3D
+    startup_timer.BeginStage("d3d_init");
+
     if (!CreateDeviceD3D(hwnd, desktop_mode))
     {
         CleanupDeviceD3D();
@@ -143,10 +157,12 @@ int WINAPI WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance, _
         CenterWindowToMonitor(hwnd, true);
     }
 
+    startup_timer.BeginStage("imgui_init");
     InitImGui(hwnd, desktop_mode);
     ImGuiIO& io = ImGui::GetIO();
 
     LOG_F(INFO, "Loaded Dear ImGui");
+    startup_timer.EndStage();
 
     if (desktop_mode)
     {
@@ -178,12 +194,17 @@ int WINAPI WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance, _
 
     ui_manager.OnInitDone();
     LOG_F(INFO, "Finished startup");
+    LOG_F(INFO, "Startup report: %s", startup_timer.GetReportJSON().c_str());
 
     //Main loop
     MSG msg;
     ZeroMemory(&msg, sizeof(msg));
     while (msg.message != WM_QUIT)
     {
+        //Tracking state is sampled again on first use in this iteration, same for state of overlays not owned by this process
+        TrackedPoseSnapshot::Get().Invalidate();
+        OverlayStateMirror::Get().BeginFrame();
+
         //Poll and handle messages (inputs, window resize, etc.)
         if (::PeekMessage(&msg, NULL, 0U, 0U, PM_REMOVE))
         {
@@ -209,7 +230,7 @@ int WINAPI WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance, _
             //Handle OpenVR events for the dashboard UI
             ImVec4 rect_v4 = UITextureSpaces::Get().GetRectAsVec4(ui_texspace_overlay_bar);
 
-            while (vr::VROverlay()->PollNextOverlayEvent(ui_manager.GetOverlayHandleOverlayBar(), &vr_event, sizeof(vr_event)))
+            while (OverlayStateMirror::Get().PollNextOverlayEvent(ui_manager.GetOverlayHandleOverlayBar(), &vr_event, sizeof(vr_event)))
             {
                 idle_state.OnOpenVREvent(vr_event.eventType);
                 ImGui_ImplOpenVR_InputEventHandler(vr_event, &rect_v4);
@@ -219,7 +240,7 @@ int WINAPI WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance, _
                     case vr::VREvent_FocusEnter:
                     {
                         //Adjust sort order so mainbar tooltips are displayed right
-                        vr::VROverlay()->SetOverlaySortOrder(ui_manager.GetOverlayHandleOverlayBar(), 1);
+                        OverlayStateMirror::Get().SetOverlaySortOrder(ui_manager.GetOverlayHandleOverlayBar(), 1);
                         break;
                     }
                     case vr::VREvent_FocusLeave:
@@ -228,7 +249,7 @@ int WINAPI WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance, _
                         //Reset adjustment so other overlays are not always behind the UI unless really needed
                         if (!ui_manager.GetOverlayBarWindow().IsAnyMenuVisible())
                         {
-                            vr::VROverlay()->SetOverlaySortOrder(ui_manager.GetOverlayHandleOverlayBar(), 0);
+                            OverlayStateMirror::Get().SetOverlaySortOrder(ui_manager.GetOverlayHandleOverlayBar(), 0);
                         }
                         break;
                     }
@@ -271,7 +292,7 @@ int WINAPI WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance, _
             //Handle OpenVR events for the floating UI
             rect_v4 = UITextureSpaces::Get().GetRectAsVec4(ui_texspace_floating_ui);
 
-            while (vr::VROverlay()->PollNextOverlayEvent(ui_manager.GetOverlayHandleFloatingUI(), &vr_event, sizeof(vr_event)))
+            while (OverlayStateMirror::Get().PollNextOverlayEvent(ui_manager.GetOverlayHandleFloatingUI(), &vr_event, sizeof(vr_event)))
             {
                 idle_state.OnOpenVREvent(vr_event.eventType);
                 ImGui_ImplOpenVR_InputEventHandler(vr_event, &rect_v4);
@@ -281,13 +302,13 @@ int WINAPI WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance, _
                     case vr::VREvent_FocusEnter:
                     {
                         //Adjust sort order so tooltips are displayed right
-                        vr::VROverlay()->SetOverlaySortOrder(ui_manager.GetOverlayHandleFloatingUI(), 1);
+                        OverlayStateMirror::Get().SetOverlaySortOrder(ui_manager.GetOverlayHandleFloatingUI(), 1);
                         break;
                     }
                     case vr::VREvent_FocusLeave:
                     {
                         //Reset adjustment so other overlays are not always behind the UI unless really needed
-                        vr::VROverlay()->SetOverlaySortOrder(ui_manager.GetOverlayHandleFloatingUI(), 0);
+                        OverlayStateMirror::Get().SetOverlaySortOrder(ui_manager.GetOverlayHandleFloatingUI(), 0);
                         break;
                     }
                 }
@@ -297,7 +318,7 @@ int WINAPI WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance, _
             //Handle OpenVR events for the floating settings
             rect_v4 = UITextureSpaces::Get().GetRectAsVec4(ui_texspace_settings);
 
-            while (vr::VROverlay()->PollNextOverlayEvent(ui_manager.GetOverlayHandleSettings(), &vr_event, sizeof(vr_event)))
+            while (OverlayStateMirror::Get().PollNextOverlayEvent(ui_manager.GetOverlayHandleSettings(), &vr_event, sizeof(vr_event)))
             {
                 idle_state.OnOpenVREvent(vr_event.eventType);
                 ImGui_ImplOpenVR_InputEventHandler(vr_event, &rect_v4);
@@ -306,7 +327,7 @@ int WINAPI WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance, _
             //Handle OpenVR events for the overlay properties
             rect_v4 = UITextureSpaces::Get().GetRectAsVec4(ui_texspace_overlay_properties);
 
-            while (vr::VROverlay()->PollNextOverlayEvent(ui_manager.GetOverlayHandleOverlayProperties(), &vr_event, sizeof(vr_event)))
+            while (OverlayStateMirror::Get().PollNextOverlayEvent(ui_manager.GetOverlayHandleOverlayProperties(), &vr_event, sizeof(vr_event)))
             {
                 idle_state.OnOpenVREvent(vr_event.eventType);
                 ImGui_ImplOpenVR_InputEventHandler(vr_event);
@@ -315,7 +336,7 @@ int WINAPI WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance, _
             //Handle OpenVR events for the VR keyboard
             rect_v4 = UITextureSpaces::Get().GetRectAsVec4(ui_texspace_keyboard);
 
-            while (vr::VROverlay()->PollNextOverlayEvent(ui_manager.GetOverlayHandleKeyboard(), &vr_event, sizeof(vr_event)))
+            while (OverlayStateMirror::Get().PollNextOverlayEvent(ui_manager.GetOverlayHandleKeyboard(), &vr_event, sizeof(vr_event)))
             {
                 idle_state.OnOpenVREvent(vr_event.eventType);
 
@@ -329,7 +350,7 @@ int WINAPI WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance, _
             //Handle OpenVR events for the Aux UI
             rect_v4 = UITextureSpaces::Get().GetRectAsVec4(ui_texspace_aux_ui);
 
-            while (vr::VROverlay()->PollNextOverlayEvent(ui_manager.GetOverlayHandleAuxUI(), &vr_event, sizeof(vr_event)))
+            while (OverlayStateMirror::Get().PollNextOverlayEvent(ui_manager.GetOverlayHandleAuxUI(), &vr_event, sizeof(vr_event)))
             {
                 idle_state.OnOpenVREvent(vr_event.eventType);
                 ImGui_ImplOpenVR_InputEventHandler(vr_event, &rect_v4);
@@ -485,6 +506,9 @@ int WINAPI WinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance, _
             }
         }
 
+        //Check browser launch state and send browser commands queued during this frame
+        DPBrowserAPIClient::Get().Update();
+
         // Rendering
         if (ui_manager.GetRepeatFrame()) //If frame repeat is enabled, don't actually render and skip vsync
         {
@@ -5,6 +5,7 @@
 #include "InterprocessMessaging.h"
 #include "Util.h"
 #include "OpenVRExt.h"
+#include "OverlayStateMirror.h"
 
 FloatingUI::FloatingUI() : m_OvrlHandleCurrentUITarget(vr::k_ulOverlayHandleInvalid),
                            m_OvrlIDCurrentUITarget(0),
@@ -27,7 +28,7 @@ void FloatingUI::Update()
 
         if ( (m_Alpha == 0.0f) && (m_AutoFitFrames == 0) ) //Overlay was hidden before
         {
-            vr::VROverlay()->ShowOverlay(ovrl_handle_floating_ui);
+            OverlayStateMirror::Get().ShowOverlay(ovrl_handle_floating_ui);
 
             OverlayConfigData& overlay_data = OverlayManager::Get().GetConfigData(m_OvrlIDCurrentUITarget);
 
@@ -58,11 +59,11 @@ void FloatingUI::Update()
         else if (m_Alpha < 0.0f)
             m_Alpha = 0.0f;
 
-        vr::VROverlay()->SetOverlayAlpha(ovrl_handle_floating_ui, m_Alpha);
+        OverlayStateMirror::Get().SetOverlayAlpha(ovrl_handle_floating_ui, m_Alpha);
 
         if ( (m_Alpha == 0.0f) && (m_AutoFitFrames == 0) ) //Overlay was visible before
         {
-            vr::VROverlay()->HideOverlay(ovrl_handle_floating_ui);
+            OverlayStateMirror::Get().HideOverlay(ovrl_handle_floating_ui);
             m_WindowActionBar.Hide(true);
             //In case we were switching targets, reset switching state and target overlay
             m_IsSwitchingTarget = false;
@@ -79,7 +80,7 @@ void FloatingUI::Update()
         {
             if (!ConfigManager::GetValue(configid_bool_state_overlay_dragmode_temp))
             {
-                vr::VROverlay()->SetOverlayInputMethod(ovrl_handle_floating_ui, vr::VROverlayInputMethod_Mouse);
+                OverlayStateMirror::Get().SetOverlayInputMethod(ovrl_handle_floating_ui, vr::VROverlayInputMethod_Mouse);
             }
         }
     }
@@ -131,12 +132,12 @@ void FloatingUI::UpdateUITargetState()
     const bool has_pointer_device = (ConfigManager::Get().GetPrimaryLaserPointerDevice() != vr::k_unTrackedDeviceIndexInvalid);
 
     //If previous target overlay is no longer visible
-    if ( (m_OvrlHandleCurrentUITarget != vr::k_ulOverlayHandleInvalid) && (!vr::VROverlay()->IsOverlayVisible(m_OvrlHandleCurrentUITarget)) )
+    if ( (m_OvrlHandleCurrentUITarget != vr::k_ulOverlayHandleInvalid) && (!OverlayStateMirror::Get().IsOverlayVisible(m_OvrlHandleCurrentUITarget)) )
     {
         m_FadeOutDelayCount = 100.0f;
 
         //Disable input so the pointer will no longer hit the UI window
-        vr::VROverlay()->SetOverlayInputMethod(ovrl_handle_floating_ui, vr::VROverlayInputMethod_None);
+        OverlayStateMirror::Get().SetOverlayInputMethod(ovrl_handle_floating_ui, vr::VROverlayInputMethod_None);
     }
     else if ( (has_pointer_device) && (ConfigManager::Get().IsLaserPointerTargetOverlay(ovrl_handle_floating_ui)) )  //Use as target Floating UI if it's hovered
     {
@@ -162,7 +163,7 @@ void FloatingUI::UpdateUITargetState()
                     {
                         //First dashboard origin with non-scene display mode is considered to be the primary dashboard overlay, but only really use it if enabled with FloatingUI on and in dashboard
                         if ( (data.ConfigBool[configid_bool_overlay_enabled]) && (data.ConfigBool[configid_bool_overlay_floatingui_enabled]) && (UIManager::Get()->IsOverlayBarOverlayVisible()) && 
-                            (vr::VROverlay()->IsOverlayVisible(ovrl_handle)) )
+                            (OverlayStateMirror::Get().IsOverlayVisible(ovrl_handle)) )
                         {
                             ovrl_handle_primary_dashboard = ovrl_handle;
                             ovrl_id_primary_dashboard = i;
@@ -238,17 +239,17 @@ void FloatingUI::UpdateUITargetState()
                 use_fixed_size = (distance < 0.25f);
 
                 m_Width = 1.2f;
-                vr::VROverlay()->SetOverlayWidthInMeters(ovrl_handle_floating_ui, m_Width);
+                OverlayStateMirror::Get().SetOverlayWidthInMeters(ovrl_handle_floating_ui, m_Width);
             }
             else if (overlay_data.ConfigInt[configid_int_overlay_origin] == ovrl_origin_theater_screen) //Fixed size for theater screen too
             {
                 m_Width = 3.0f;
-                vr::VROverlay()->SetOverlayWidthInMeters(ovrl_handle_floating_ui, m_Width);
+                OverlayStateMirror::Get().SetOverlayWidthInMeters(ovrl_handle_floating_ui, m_Width);
             }
             else
             {
-                vr::TrackedDevicePose_t poses[vr::k_unTrackedDeviceIndex_Hmd + 1];
-                vr::VRSystem()->GetDeviceToAbsoluteTrackingPose(vr::TrackingUniverseStanding, vr::IVRSystemEx::GetTimeNowToPhotons(), poses, vr::k_unTrackedDeviceIndex_Hmd + 1);
+                vr::TrackedDevicePose_t poses[vr::k_unMaxTrackedDeviceCount];
+                TrackedPoseSnapshot::Get().GetPoses(poses);
 
                 if (poses[vr::k_unTrackedDeviceIndex_Hmd].bPoseIsValid)
                 {
@@ -256,7 +257,7 @@ void FloatingUI::UpdateUITargetState()
                     float distance = matrix.getTranslation().distance(mat_hmd.getTranslation());
 
                     m_Width = 0.66f + (0.5f * distance);
-                    vr::VROverlay()->SetOverlayWidthInMeters(ovrl_handle_floating_ui, m_Width);
+                    OverlayStateMirror::Get().SetOverlayWidthInMeters(ovrl_handle_floating_ui, m_Width);
                 }
             }
         }
@@ -301,7 +302,7 @@ void FloatingUI::UpdateUITargetState()
             if (matrix != m_TransformLast)
             {
                 vr::HmdMatrix34_t hmd_matrix = matrix.toOpenVR34();
-                vr::VROverlay()->SetOverlayTransformAbsolute(ovrl_handle_floating_ui, vr::TrackingUniverseStanding, &hmd_matrix);
+                OverlayStateMirror::Get().SetOverlayTransformAbsolute(ovrl_handle_floating_ui, vr::TrackingUniverseStanding, &hmd_matrix);
 
                 UIManager::Get()->GetIdleState().AddActiveTime(100);
                 m_TransformLast = matrix;
@@ -333,8 +334,7 @@ void FloatingUI::UpdateUITargetState()
             bool blocked_by_systemui = false;
             if (m_OvrlHandleCurrentUITarget != vr::k_ulOverlayHandleInvalid)
             {
-                vr::VROverlayHandle_t ovrl_handle_systemui;
-                vr::VROverlay()->FindOverlay("system.systemui", &ovrl_handle_systemui);
+                vr::VROverlayHandle_t ovrl_handle_systemui = TrackedPoseSnapshot::Get().GetSystemUIOverlayHandle();
 
                 if (ovrl_handle_systemui != vr::k_ulOverlayHandleInvalid)
                 {
@@ -5,6 +5,7 @@
 #include "InterprocessMessaging.h"
 #include "Util.h"
 #include "OpenVRExt.h"
+#include "OverlayStateMirror.h"
 #include "ImGuiExt.h"
 #include "imgui_internal.h"
 
@@ -55,7 +56,7 @@ void FloatingWindow::WindowUpdateBase()
 
         //Use overlay alpha when not in desktop mode for better blending
         if ( (!UIManager::Get()->IsInDesktopMode()) && (alpha_prev != m_Alpha) )
-            vr::VROverlay()->SetOverlayAlpha(GetOverlayHandle(), m_Alpha);
+            OverlayStateMirror::Get().SetOverlayAlpha(GetOverlayHandle(), m_Alpha);
 
         if (m_Alpha == 0.0f)
         {
@@ -1343,7 +1344,7 @@ void FloatingWindow::UpdateVisibility()
     {
         const bool is_using_dashboard_state = (m_OverlayStateCurrentID == floating_window_ovrl_state_dashboard_tab);
 
-        if (is_using_dashboard_state != vr::VROverlay()->IsOverlayVisible(UIManager::Get()->GetOverlayHandleDPlusDashboard()))
+        if (is_using_dashboard_state != OverlayStateMirror::Get().IsOverlayVisible(UIManager::Get()->GetOverlayHandleDPlusDashboard()))
         {
             OverlayStateSwitchCurrent(!is_using_dashboard_state);
         }
@@ -1364,7 +1365,7 @@ void FloatingWindow::UpdateVisibility()
                 Matrix4 matrix_m4 = UIManager::Get()->GetOverlayDragger().GetBaseOffsetMatrix(ovrl_origin_dplus_tab) * m_OverlayStateCurrent->Transform;
                 vr::HmdMatrix34_t matrix_ovr = matrix_m4.toOpenVR34();
 
-                vr::VROverlay()->SetOverlayTransformAbsolute(overlay_handle, origin, &matrix_ovr);
+                OverlayStateMirror::Get().SetOverlayTransformAbsolute(overlay_handle, origin, &matrix_ovr);
 
                 m_OverlayStateCurrent->TransformAbs = matrix_m4;
             }
@@ -1372,12 +1373,12 @@ void FloatingWindow::UpdateVisibility()
 
         if ((!m_OvrlVisible) && (m_OverlayStateCurrent->IsVisible))
         {
-            vr::VROverlay()->ShowOverlay(overlay_handle);
+            OverlayStateMirror::Get().ShowOverlay(overlay_handle);
             m_OvrlVisible = true;
         }
         else if ((m_OvrlVisible) && (!m_OverlayStateCurrent->IsVisible) && (m_Alpha == 0.0f))
         {
-            vr::VROverlay()->HideOverlay(overlay_handle);
+            OverlayStateMirror::Get().HideOverlay(overlay_handle);
             m_OvrlVisible = false;
         }
     }
@@ -1503,13 +1504,13 @@ void FloatingWindow::SetTransform(const Matrix4& transform)
     vr::HmdMatrix34_t hmd_mat;
     vr::TrackingUniverseOrigin universe_origin = vr::TrackingUniverseStanding;
 
-    vr::VROverlay()->GetOverlayTransformAbsolute(GetOverlayHandle(), &universe_origin, &hmd_mat);
+    OverlayStateMirror::Get().GetOverlayTransformAbsolute(GetOverlayHandle(), &universe_origin, &hmd_mat);
     m_OverlayStateCurrent->TransformAbs = hmd_mat;
 
     //Store size multiplier
     float current_width = m_OvrlWidth;
 
-    if (vr::VROverlay()->GetOverlayWidthInMeters(GetOverlayHandle(), &current_width) == vr::VROverlayError_None)
+    if (OverlayStateMirror::Get().GetOverlayWidthInMeters(GetOverlayHandle(), &current_width) == vr::VROverlayError_None)
     {
         m_OverlayStateCurrent->Size = current_width / m_OvrlWidth;
     }
@@ -1523,10 +1524,10 @@ void FloatingWindow::ApplyCurrentOverlayState()
     if (m_OverlayStateCurrent->IsPinned)
     {
         vr::HmdMatrix34_t matrix_ovr = m_OverlayStateCurrent->TransformAbs.toOpenVR34();
-        vr::VROverlay()->SetOverlayTransformAbsolute(GetOverlayHandle(), vr::TrackingUniverseStanding, &matrix_ovr);
+        OverlayStateMirror::Get().SetOverlayTransformAbsolute(GetOverlayHandle(), vr::TrackingUniverseStanding, &matrix_ovr);
     }
 
-    vr::VROverlay()->SetOverlayWidthInMeters(GetOverlayHandle(), m_OvrlWidth * m_OverlayStateCurrent->Size);
+    OverlayStateMirror::Get().SetOverlayWidthInMeters(GetOverlayHandle(), m_OvrlWidth * m_OverlayStateCurrent->Size);
 }
 
 void FloatingWindow::RebaseTransform()
@@ -1534,7 +1535,7 @@ void FloatingWindow::RebaseTransform()
     vr::HmdMatrix34_t hmd_mat;
     vr::TrackingUniverseOrigin universe_origin = vr::TrackingUniverseStanding;
 
-    vr::VROverlay()->GetOverlayTransformAbsolute(GetOverlayHandle(), &universe_origin, &hmd_mat);
+    OverlayStateMirror::Get().GetOverlayTransformAbsolute(GetOverlayHandle(), &universe_origin, &hmd_mat);
     Matrix4 mat_abs = hmd_mat;
     Matrix4 mat_origin_inverse = UIManager::Get()->GetOverlayDragger().GetBaseOffsetMatrix(ovrl_origin_dplus_tab);
 
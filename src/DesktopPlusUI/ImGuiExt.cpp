@@ -7,6 +7,8 @@
 #endif
 #include "imgui_internal.h"
 #include "UIManager.h"
+#include "TextMetricsCache.h"
+#include "OutlinedGlyphAtlas.h"
 #include "Util.h"
 
 ImVec4 Style_ImGuiCol_TextNotification;
@@ -865,7 +867,18 @@ namespace ImGui
             const ImU32 col = GetColorU32(ImGuiCol_Text);
             const ImU32 col_outline = GetColorU32(Style_ImGuiCol_TextOutline);
 
-            //This does indeed do 9x the AddText() calls of normal text, which is a bit wasteful but not too bad with the short strings this gets used with
+            //Use pre-baked outlined glyphs when possible. They only work with a black outline that has the same alpha as the text
+            const bool outline_baked_compatible = ( ((col_outline & ~IM_COL32_A_MASK) == 0) && ((col_outline & IM_COL32_A_MASK) == (col & IM_COL32_A_MASK)) );
+
+            if ( (outline_baked_compatible) && (OutlinedGlyphAtlas::Get().AddText(window->DrawList, g.Font, g.FontSize, pos, col, text, text_display_end)) )
+            {
+                if (g.LogEnabled)
+                    LogRenderedText(&pos, text, text_display_end);
+
+                return;
+            }
+
+            //Otherwise, this does indeed do 9x the AddText() calls of normal text, which is a bit wasteful but not too bad with the short strings this gets used with
             ImVec2 pos_outline = pos;
             pos_outline.y -= 1;
             window->DrawList->AddText(g.Font, g.FontSize, pos_outline, col_outline, text, text_display_end);
@@ -1472,43 +1485,8 @@ namespace ImGui
 
     std::string StringEllipsis(const char* str, float width_max)
     {
-        //Naive approach, but we're not supposed to use RenderTextEllipsis(), so this will do
-        const char* str_begin = str;
-        const char* str_end   = str + strlen(str);
-
-        //Handle corner case of text fitting without ellipsis, but not with
-        if (ImGui::CalcTextSize(str, str_end).x <= width_max)
-        {
-            return str;
-        }
-
-        float ellipsis_width = ImGui::CalcTextSize("...").x;
-        bool is_full_string = true;
-        ImWchar32 c;
-        int decoded_length = 0;
-
-        while (str < str_end)
-        {
-            if (ImGui::CalcTextSize(str_begin, str).x + ellipsis_width >= width_max)
-            {
-                str -= decoded_length;
-                is_full_string = false;
-                break;
-            }
-
-            decoded_length = ImTextCharFromUtf8(&c, str, str_end);
-
-            str += decoded_length;
-        }
-
-        std::string str_out(str_begin, str - str_begin);
-
-        if (!is_full_string)
-        {
-            str_out.append("...");
-        }
-
-        return str_out;
+        //Strings shortened with this are typically redrawn every frame, so the cache avoids measuring them again
+        return TextMetricsCache::Get().GetStringEllipsis(str, width_max);
     }
 
     bool DraggableRectArea(const char* str_id, const ImVec2& area_size, ImGuiDraggableRectAreaState& state)
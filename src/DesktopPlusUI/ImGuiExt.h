@@ -181,7 +181,7 @@ namespace ImGui
     //Returns true if a character in the string is mapped in the active font
     bool StringContainsUnmappedCharacter(const char* str);
 
-    //Returns string shortened to fit width_max in the active font
+    //Returns string shortened to fit width_max in the active font. Results are cached, see TextMetricsCache
     std::string StringEllipsis(const char* str, float width_max);
 
     //Fairly specific, yet general enough custom widget that contains an draggable & resizable rectangle in a fixed size area
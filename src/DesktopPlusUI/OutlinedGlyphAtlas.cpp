@@ -0,0 +1,312 @@
+#include "OutlinedGlyphAtlas.h"
+
+#include <cmath>
+
+#ifndef IMGUI_DEFINE_MATH_OPERATORS
+    #define IMGUI_DEFINE_MATH_OPERATORS
+#endif
+#include "imgui_internal.h"
+
+static OutlinedGlyphAtlas g_OutlinedGlyphAtlas;
+
+static const int k_OutlinedGlyphRectWidth = 256;   //Needs to stay below the atlas width, which TextureManager typically sets to 512
+static const int k_OutlinedGlyphPadding   = 1;     //Between baked glyphs so filtering doesn't pick up the neighbors
+
+OutlinedGlyphAtlas& OutlinedGlyphAtlas::Get()
+{
+    return g_OutlinedGlyphAtlas;
+}
+
+bool OutlinedGlyphAtlas::IsCodepointBaked(ImWchar32 c)
+{
+    return ( (c >= s_CodepointFirst) && (c <= s_CodepointLast) );
+}
+
+const OutlinedGlyph* OutlinedGlyphAtlas::FindGlyph(const FontData& font_data, ImWchar32 c) const
+{
+    if ( (!IsCodepointBaked(c)) || (font_data.Glyphs.empty()) )
+        return nullptr;
+
+    const OutlinedGlyph& glyph = font_data.Glyphs[c - s_CodepointFirst];
+    return (glyph.IsBaked) ? &glyph : nullptr;
+}
+
+void OutlinedGlyphAtlas::Clear()
+{
+    m_Atlas = nullptr;
+    m_Fonts.clear();
+}
+
+void OutlinedGlyphAtlas::AddFont(ImFontAtlas* atlas, ImFont* font, float size_pixels)
+{
+    if ( (atlas == nullptr) || (font == nullptr) )
+        return;
+
+    if ( (m_Atlas != nullptr) && (m_Atlas != atlas) )
+    {
+        Clear();
+    }
+
+    for (const FontData& font_data : m_Fonts)
+    {
+        if (font_data.Font == font)
+            return;
+    }
+
+    //Glyph sizes aren't known before building, so estimate with a somewhat generous average glyph width. Glyphs that don't fit in the end are just not baked
+    //Small fonts are rasterized with 2x horizontal oversampling by default, which widens the glyphs in the atlas
+    const int oversample_h  = (size_pixels > 36.0f) ? 1 : 2;
+    const int glyph_count   = (0x7E - s_CodepointFirst + 1) + (s_CodepointLast - 0xA0 + 1);   //Control characters in-between have no glyphs
+    const float cell_width  = (size_pixels * 0.35f * oversample_h) + (2 * oversample_h) + k_OutlinedGlyphPadding;
+    const float cell_height = size_pixels + 2 + k_OutlinedGlyphPadding;
+    const int rows = (int)ceilf((glyph_count * cell_width * 1.15f) / k_OutlinedGlyphRectWidth) + 1;
+
+    FontData font_data;
+    font_data.Font = font;
+    font_data.ImGuiRectID = atlas->AddCustomRectRegular(k_OutlinedGlyphRectWidth, (int)(rows * cell_height));
+
+    m_Atlas = atlas;
+    m_Fonts.push_back(font_data);
+}
+
+void OutlinedGlyphAtlas::Bake(unsigned char* tex_pixels_rgba32, int tex_width, int tex_height)
+{
+    if ( (m_Atlas == nullptr) || (tex_pixels_rgba32 == nullptr) )
+        return;
+
+    ImU32* tex_pixels = (ImU32*)tex_pixels_rgba32;
+    std::vector<float> alpha_src;
+
+    for (FontData& font_data : m_Fonts)
+    {
+        font_data.Glyphs.assign(s_CodepointLast - s_CodepointFirst + 1, OutlinedGlyph());
+
+        if (font_data.ImGuiRectID < 0)
+            continue;
+
+        const ImFontAtlasCustomRect* rect = m_Atlas->GetCustomRectByIndex(font_data.ImGuiRectID);
+
+        if ( (rect == nullptr) || (!rect->IsPacked()) )
+            continue;
+
+        //Simple shelf packing within the reserved rect
+        int pack_x = 0;
+        int pack_y = 0;
+        int pack_row_height = 0;
+
+        for (ImWchar32 c = s_CodepointFirst; c <= s_CodepointLast; ++c)
+        {
+            const ImFontGlyph* glyph = font_data.Font->FindGlyphNoFallback((ImWchar)c);
+
+            if ( (glyph == nullptr) || (!glyph->Visible) || (glyph->Colored) || (glyph->X1 <= glyph->X0) || (glyph->Y1 <= glyph->Y0) )
+                continue;
+
+            //Source glyph bitmap in the atlas
+            const int src_x0 = (int)lroundf(glyph->U0 * tex_width);
+            const int src_y0 = (int)lroundf(glyph->V0 * tex_height);
+            const int src_w  = (int)lroundf(glyph->U1 * tex_width)  - src_x0;
+            const int src_h  = (int)lroundf(glyph->V1 * tex_height) - src_y0;
+
+            if ( (src_w <= 0) || (src_h <= 0) )
+                continue;
+
+            //Outline is 1 pixel at font size, which can be more than one texel with oversampling
+            const float texels_per_pixel_x = src_w / (glyph->X1 - glyph->X0);
+            const float texels_per_pixel_y = src_h / (glyph->Y1 - glyph->Y0);
+            const int offset_x = ImMax(1, (int)lroundf(texels_per_pixel_x));
+            const int offset_y = ImMax(1, (int)lroundf(texels_per_pixel_y));
+            const int dst_w = src_w + offset_x * 2;
+            const int dst_h = src_h + offset_y * 2;
+
+            if (pack_x + dst_w > rect->Width)
+            {
+                pack_x = 0;
+                pack_y += pack_row_height + k_OutlinedGlyphPadding;
+                pack_row_height = 0;
+            }
+
+            if ( (dst_w > rect->Width) || (pack_y + dst_h > rect->Height) )
+                continue;
+
+            alpha_src.resize((size_t)src_w * src_h);
+            for (int y = 0; y < src_h; ++y)
+            {
+                const ImU32* p = tex_pixels + (src_y0 + y) * tex_width + src_x0;
+
+                for (int x = 0; x < src_w; ++x)
+                {
+                    alpha_src[y * src_w + x] = ((p[x] >> IM_COL32_A_SHIFT) & 0xFF) / 255.0f;
+                }
+            }
+
+            auto get_alpha = [&](int x, int y)
+            {
+                return ( (x >= 0) && (y >= 0) && (x < src_w) && (y < src_h) ) ? alpha_src[y * src_w + x] : 0.0f;
+            };
+
+            //Same result as drawing the glyph 8 times offset in black and then once more in white on top, unpremultiplied
+            const int dst_x0 = rect->X + pack_x;
+            const int dst_y0 = rect->Y + pack_y;
+
+            for (int y = 0; y < dst_h; ++y)
+            {
+                ImU32* p = tex_pixels + (dst_y0 + y) * tex_width + dst_x0;
+
+                for (int x = 0; x < dst_w; ++x)
+                {
+                    const int src_x = x - offset_x;
+                    const int src_y = y - offset_y;
+
+                    float outline_transparency = 1.0f;
+                    for (int dy = -1; dy <= 1; ++dy)
+                    {
+                        for (int dx = -1; dx <= 1; ++dx)
+                        {
+                            if ( (dx != 0) || (dy != 0) )
+                            {
+                                outline_transparency *= 1.0f - get_alpha(src_x - dx * offset_x, src_y - dy * offset_y);
+                            }
+                        }
+                    }
+
+                    const float alpha_fill    = get_alpha(src_x, src_y);
+                    const float alpha_outline = 1.0f - outline_transparency;
+                    const float alpha_total   = alpha_fill + alpha_outline * (1.0f - alpha_fill);
+                    const float brightness    = (alpha_total > 0.0f) ? alpha_fill / alpha_total : 0.0f;
+
+                    const ImU32 b = (ImU32)(brightness  * 255.0f + 0.5f);
+                    p[x] = IM_COL32(b, b, b, (ImU32)(alpha_total * 255.0f + 0.5f));
+                }
+            }
+
+            OutlinedGlyph& outlined_glyph = font_data.Glyphs[c - s_CodepointFirst];
+            outlined_glyph.IsBaked = true;
+            outlined_glyph.X0 = glyph->X0 - (offset_x / texels_per_pixel_x);
+            outlined_glyph.Y0 = glyph->Y0 - (offset_y / texels_per_pixel_y);
+            outlined_glyph.X1 = glyph->X1 + (offset_x / texels_per_pixel_x);
+            outlined_glyph.Y1 = glyph->Y1 + (offset_y / texels_per_pixel_y);
+            outlined_glyph.U0 = (float)(dst_x0)         * m_Atlas->TexUvScale.x;
+            outlined_glyph.V0 = (float)(dst_y0)         * m_Atlas->TexUvScale.y;
+            outlined_glyph.U1 = (float)(dst_x0 + dst_w) * m_Atlas->TexUvScale.x;
+            outlined_glyph.V1 = (float)(dst_y0 + dst_h) * m_Atlas->TexUvScale.y;
+
+            pack_x += dst_w + k_OutlinedGlyphPadding;
+            pack_row_height = ImMax(pack_row_height, dst_h);
+        }
+    }
+}
+
+bool OutlinedGlyphAtlas::AddText(ImDrawList* draw_list, ImFont* font, float font_size, const ImVec2& pos, ImU32 col, const char* text_begin, const char* text_end) const
+{
+    if ( (font == nullptr) || (font->ContainerAtlas != m_Atlas) || (font_size != font->FontSize) )
+        return false;
+
+    const FontData* font_data = nullptr;
+    for (const FontData& font_data_it : m_Fonts)
+    {
+        if (font_data_it.Font == font)
+        {
+            font_data = &font_data_it;
+            break;
+        }
+    }
+
+    if (font_data == nullptr)
+        return false;
+
+    if (text_end == nullptr)
+        text_end = text_begin + strlen(text_begin);
+
+    //Check first so nothing is drawn if it has to fall back, and count the quads while at it
+    int quad_count = 0;
+    for (const char* s = text_begin; s < text_end;)
+    {
+        unsigned int c = (unsigned int)*s;
+        if (c < 0x80)
+            s += 1;
+        else
+            s += ImTextCharFromUtf8(&c, s, text_end);
+
+        if ( (c == '\n') || (c == '\r') )
+            continue;
+
+        const ImFontGlyph* glyph = font->FindGlyph((ImWchar)c);
+
+        if ( (glyph == nullptr) || (!glyph->Visible) )
+            continue;
+
+        //Fallback glyph needs an outline too, so look up the codepoint of the glyph that's actually drawn
+        if (FindGlyph(*font_data, glyph->Codepoint) == nullptr)
+            return false;
+
+        quad_count++;
+    }
+
+    if (quad_count == 0)
+        return true;
+
+    //Same layout as ImFont::RenderText(), without wrapping
+    const ImVec4& clip_rect = draw_list->_CmdHeader.ClipRect;
+    const float x_origin = IM_TRUNC(pos.x);
+    float x = x_origin;
+    float y = IM_TRUNC(pos.y);
+
+    const bool push_texture_id = (font->ContainerAtlas->TexID != draw_list->_CmdHeader.TextureId);
+    if (push_texture_id)
+    {
+        draw_list->PushTextureID(font->ContainerAtlas->TexID);
+    }
+
+    draw_list->PrimReserve(quad_count * 6, quad_count * 4);
+    int quad_count_drawn = 0;
+
+    for (const char* s = text_begin; s < text_end;)
+    {
+        unsigned int c = (unsigned int)*s;
+        if (c < 0x80)
+            s += 1;
+        else
+            s += ImTextCharFromUtf8(&c, s, text_end);
+
+        if (c == '\n')
+        {
+            x = x_origin;
+            y += font_size;
+            continue;
+        }
+        else if (c == '\r')
+        {
+            continue;
+        }
+
+        const ImFontGlyph* glyph = font->FindGlyph((ImWchar)c);
+
+        if (glyph == nullptr)
+            continue;
+
+        if (glyph->Visible)
+        {
+            const OutlinedGlyph* outlined_glyph = FindGlyph(*font_data, glyph->Codepoint);
+            const ImVec2 p_min(x + outlined_glyph->X0, y + outlined_glyph->Y0);
+            const ImVec2 p_max(x + outlined_glyph->X1, y + outlined_glyph->Y1);
+
+            if ( (p_min.x <= clip_rect.z) && (p_max.x >= clip_rect.x) && (p_min.y <= clip_rect.w) && (p_max.y >= clip_rect.y) )
+            {
+                draw_list->PrimRectUV(p_min, p_max, ImVec2(outlined_glyph->U0, outlined_glyph->V0), ImVec2(outlined_glyph->U1, outlined_glyph->V1), col);
+                quad_count_drawn++;
+            }
+        }
+
+        x += glyph->AdvanceX;
+    }
+
+    //Give back what was reserved for clipped glyphs
+    draw_list->PrimUnreserve((quad_count - quad_count_drawn) * 6, (quad_count - quad_count_drawn) * 4);
+
+    if (push_texture_id)
+    {
+        draw_list->PopTextureID();
+    }
+
+    return true;
+}
@@ -0,0 +1,50 @@
+//Pre-baked outlined glyphs in the font atlas for drawing outlined text with a single quad per glyph
+//Outlined text used to be drawn as 8 offset copies in the outline color with the text on top. The baked glyphs contain that result instead:
+//fill is white and the outline black, so the vertex color tints the fill the same way as with regular text. The outline takes the alpha of the text color.
+//Only a small set of characters is baked. Text containing anything else has to be drawn the old way, AddText() returns false then.
+//This only depends on Dear ImGui and works in a headless context as well.
+
+#pragma once
+
+#include "imgui.h"
+
+#include <vector>
+
+struct OutlinedGlyph
+{
+    bool IsBaked = false;
+    float X0 = 0.0f, Y0 = 0.0f, X1 = 0.0f, Y1 = 0.0f;   //Quad corners relative to the text position, at font size
+    float U0 = 0.0f, V0 = 0.0f, U1 = 0.0f, V1 = 0.0f;
+};
+
+class OutlinedGlyphAtlas
+{
+    private:
+        struct FontData
+        {
+            ImFont* Font = nullptr;
+            int ImGuiRectID = -1;
+            std::vector<OutlinedGlyph> Glyphs;          //Indexed by codepoint - s_CodepointFirst
+        };
+
+        static const ImWchar s_CodepointFirst = 0x21;
+        static const ImWchar s_CodepointLast  = 0xB0;   //Printable ASCII and a few Latin-1 symbols, like the degree sign used for temperatures
+
+        ImFontAtlas* m_Atlas = nullptr;
+        std::vector<FontData> m_Fonts;
+
+        static bool IsCodepointBaked(ImWchar32 c);
+        const OutlinedGlyph* FindGlyph(const FontData& font_data, ImWchar32 c) const;
+
+    public:
+        static OutlinedGlyphAtlas& Get();
+
+        void Clear();
+        //Reserves space for the font's outlined glyphs. Needs to be called after adding the font and before building the atlas
+        void AddFont(ImFontAtlas* atlas, ImFont* font, float size_pixels);
+        //Renders the outlined glyphs into the reserved space. Needs to be called after building the atlas, with the pixels from GetTexDataAsRGBA32()
+        void Bake(unsigned char* tex_pixels_rgba32, int tex_width, int tex_height);
+
+        //Returns false without drawing anything if the text contains glyphs that aren't baked or the font isn't drawn at its native size
+        bool AddText(ImDrawList* draw_list, ImFont* font, float font_size, const ImVec2& pos, ImU32 col, const char* text_begin, const char* text_end) const;
+};
@@ -0,0 +1,201 @@
+#include "TextMetricsCache.h"
+
+#include <cstring>
+
+#ifndef IMGUI_DEFINE_MATH_OPERATORS
+    #define IMGUI_DEFINE_MATH_OPERATORS
+#endif
+#include "imgui_internal.h"
+
+static TextMetricsCache g_TextMetricsCache;
+
+TextMetricsCache& TextMetricsCache::Get()
+{
+    return g_TextMetricsCache;
+}
+
+uint64_t TextMetricsCache::ComputeKey(const char* str, size_t length, const ImFont* font, float font_size)
+{
+    //FNV-1a over the string, with font and size mixed in at the end
+    uint64_t hash = 14695981039346656037ULL;
+
+    for (size_t i = 0; i < length; ++i)
+    {
+        hash ^= (unsigned char)str[i];
+        hash *= 1099511628211ULL;
+    }
+
+    uint32_t font_size_bits;
+    memcpy(&font_size_bits, &font_size, sizeof(font_size_bits));
+
+    hash ^= (uint64_t)(uintptr_t)font;
+    hash *= 1099511628211ULL;
+    hash ^= font_size_bits;
+    hash *= 1099511628211ULL;
+
+    return hash;
+}
+
+TextMetricsCache::Entry& TextMetricsCache::GetEntry(const char* str)
+{
+    ImFont* font = ImGui::GetFont();
+    const float font_size = ImGui::GetFontSize();
+    const size_t length = strlen(str);
+    const uint64_t key = ComputeKey(str, length, font, font_size);
+
+    auto it = m_Entries.find(key);
+
+    if ( (it != m_Entries.end()) && (it->second.Font == font) && (it->second.FontSize == font_size) && (it->second.Text.size() == length) &&
+         (memcmp(it->second.Text.data(), str, length) == 0) )
+    {
+        it->second.LastUseFrame = ImGui::GetFrameCount();
+        return it->second;
+    }
+
+    if (it == m_Entries.end())
+    {
+        PruneEntries();
+    }
+
+    //New entry or hash collision, which just replaces the old one
+    Entry& entry = m_Entries[key];
+    entry = Entry();
+    entry.Text.assign(str, length);
+    entry.Font         = font;
+    entry.FontSize     = font_size;
+    entry.LastUseFrame = ImGui::GetFrameCount();
+
+    entry.CharOffsets.reserve(length + 1);
+    entry.PrefixWidths.reserve(length + 1);
+    entry.CharOffsets.push_back(0);
+    entry.PrefixWidths.push_back(0.0f);
+
+    //Same steps as ImFont::CalcTextSizeA() without wrapping, so the sums come out exactly the same
+    const float scale = font_size / font->FontSize;
+    const char* s     = str;
+    const char* s_end = str + length;
+    float text_width  = 0.0f;
+    float line_width  = 0.0f;
+
+    while (s < s_end)
+    {
+        unsigned int c = (unsigned int)*s;
+        if (c < 0x80)
+            s += 1;
+        else
+            s += ImTextCharFromUtf8(&c, s, s_end);
+
+        if ( (c == '\n') || (c == '\r') )
+        {
+            if (c == '\n')
+            {
+                text_width = ImMax(text_width, line_width);
+                line_width = 0.0f;
+            }
+        }
+        else
+        {
+            line_width += (((int)c < font->IndexAdvanceX.Size) ? font->IndexAdvanceX.Data[c] : font->FallbackAdvanceX) * scale;
+        }
+
+        entry.CharOffsets.push_back((int)(s - str));
+        entry.PrefixWidths.push_back(ImMax(text_width, line_width));
+    }
+
+    return entry;
+}
+
+float TextMetricsCache::GetPrefixWidth(const Entry& entry, size_t char_boundary) const
+{
+    if (char_boundary == 0)
+        return 0.0f;
+
+    //Same rounding as CalcTextSize()
+    return IM_TRUNC(entry.PrefixWidths[char_boundary] + 0.99999f);
+}
+
+void TextMetricsCache::PruneEntries()
+{
+    if (m_Entries.size() < s_MaxEntryCount)
+        return;
+
+    //Drop everything that wasn't used in the last few frames, or everything if that's not enough
+    const int frame_min = ImGui::GetFrameCount() - 60;
+
+    for (auto it = m_Entries.begin(); it != m_Entries.end();)
+    {
+        it = (it->second.LastUseFrame < frame_min) ? m_Entries.erase(it) : std::next(it);
+    }
+
+    if (m_Entries.size() >= s_MaxEntryCount)
+    {
+        m_Entries.clear();
+    }
+}
+
+void TextMetricsCache::Clear()
+{
+    m_Entries.clear();
+}
+
+size_t TextMetricsCache::GetEntryCount() const
+{
+    return m_Entries.size();
+}
+
+float TextMetricsCache::GetTextWidth(const char* str)
+{
+    const Entry& entry = GetEntry(str);
+    return GetPrefixWidth(entry, entry.CharOffsets.size() - 1);
+}
+
+const std::string& TextMetricsCache::GetStringEllipsis(const char* str, float width_max)
+{
+    Entry& entry = GetEntry(str);
+
+    if (entry.EllipsisWidthMax == width_max)
+        return entry.EllipsisResult;
+
+    const size_t char_count = entry.CharOffsets.size() - 1;
+
+    entry.EllipsisWidthMax = width_max;
+
+    if (GetPrefixWidth(entry, char_count) <= width_max)
+    {
+        entry.EllipsisResult = entry.Text;
+        return entry.EllipsisResult;
+    }
+
+    //Find first prefix that doesn't fit with the ellipsis appended. Widths never shrink with more characters, so a binary search works
+    const float ellipsis_width = ImGui::CalcTextSize("...").x;
+    size_t boundary_low  = 0;
+    size_t boundary_high = char_count;
+
+    while (boundary_low < boundary_high)
+    {
+        const size_t boundary_mid = (boundary_low + boundary_high) / 2;
+
+        if (GetPrefixWidth(entry, boundary_mid) + ellipsis_width >= width_max)
+        {
+            boundary_high = boundary_mid;
+        }
+        else
+        {
+            boundary_low = boundary_mid + 1;
+        }
+    }
+
+    //Only the full string is too wide while every shorter prefix still fits with ellipsis. Same as before, the string is left as is then
+    if (boundary_low == char_count)
+    {
+        entry.EllipsisResult = entry.Text;
+        return entry.EllipsisResult;
+    }
+
+    const size_t boundary_cut = (boundary_low == 0) ? 0 : boundary_low - 1;
+
+    entry.EllipsisResult.assign(entry.Text, 0, entry.CharOffsets[boundary_cut]);
+    entry.EllipsisResult.append("...");
+
+    return entry.EllipsisResult;
+}
@@ -0,0 +1,50 @@
+//Caches per-character text widths of strings so the width of any prefix can be looked up without measuring the string again
+//Used for ellipsis truncation of strings drawn every frame, which otherwise needs a CalcTextSize() call per prefix until the string fits.
+//Widths match ImGui::CalcTextSize() exactly as the same advances are summed up in the same order. Entries are per string, font and font size.
+//The cache needs to be cleared when the font atlas is rebuilt, as font pointers and glyph advances can change then.
+//This only depends on Dear ImGui and works in a headless context as well.
+
+#pragma once
+
+#include "imgui.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+class TextMetricsCache
+{
+    private:
+        struct Entry
+        {
+            std::string Text;
+            ImFont* Font   = nullptr;
+            float FontSize = 0.0f;
+            std::vector<int> CharOffsets;               //Byte offset of every character boundary, including the end
+            std::vector<float> PrefixWidths;            //Unrounded width of the text up to each boundary, widest line for multi-line text
+            float EllipsisWidthMax = -1.0f;             //Width the cached ellipsis result is for
+            std::string EllipsisResult;
+            int LastUseFrame = 0;
+        };
+
+        static const size_t s_MaxEntryCount = 1024;     //Unused entries are pruned past this
+
+        std::unordered_map<uint64_t, Entry> m_Entries;
+
+        static uint64_t ComputeKey(const char* str, size_t length, const ImFont* font, float font_size);
+        Entry& GetEntry(const char* str);               //Uses current font and size
+        float GetPrefixWidth(const Entry& entry, size_t char_boundary) const;  //Rounded like CalcTextSize()
+        void PruneEntries();
+
+    public:
+        static TextMetricsCache& Get();
+
+        void Clear();
+        size_t GetEntryCount() const;
+
+        //Same as ImGui::CalcTextSize(str).x with the current font
+        float GetTextWidth(const char* str);
+        //Returns string shortened to fit width_max with the current font, with "..." appended if it was shortened. Result is cached for the last width_max
+        const std::string& GetStringEllipsis(const char* str, float width_max);
+};
@@ -18,6 +18,9 @@ namespace Gdiplus
 #include "ConfigManager.h"
 #include "Util.h"
 #include "UIManager.h"
+#include "TextMetricsCache.h"
+#include "OutlinedGlyphAtlas.h"
+#include "VirtualList.h"
 #include "OverlayManager.h"
 #include "WindowManager.h"
 #include "imgui_impl_dx11_openvr.h"
@@ -103,6 +106,8 @@ bool TextureManager::LoadAllTexturesAndBuildFonts()
     ImGuiIO& io = ImGui::GetIO();
 
     io.Fonts->Clear();
+    TextMetricsCache::Get().Clear();          //Cached text widths are only valid for the fonts they were measured with
+    OutlinedGlyphAtlas::Get().Clear();
     ImGui_ImplDX11_InvalidateDeviceObjects(); //I really feel like I shouldn't have to call a renderer-specific function to make reloading fonts work, but it seems necessary
 
     //Clear arrays
@@ -173,6 +178,7 @@ bool TextureManager::LoadAllTexturesAndBuildFonts()
     ImFont* font_compact = nullptr;
     ImFont* font_large = nullptr;
     float font_base_size = 32.0f;
+    const float font_compact_size = font_base_size * UIManager::Get()->GetUIScale();
     bool load_large_font = ( (ConfigManager::GetValue(configid_bool_interface_large_style)) && (!UIManager::Get()->IsInDesktopMode()) );
 
     //Loop to do the same for the large font if needed
@@ -259,6 +265,14 @@ bool TextureManager::LoadAllTexturesAndBuildFonts()
         }
     }
 
+    //Reserve space for the pre-baked outlined glyphs used by ImGui::TextUnformattedOutlined()
+    OutlinedGlyphAtlas::Get().AddFont(io.Fonts, font_compact, font_compact_size);
+
+    if ( (font_large != nullptr) && (font_large != font_compact) )
+    {
+        OutlinedGlyphAtlas::Get().AddFont(io.Fonts, font_large, font_base_size * UIManager::Get()->GetUIScale());
+    }
+
     //Initialize GDI+.
     Gdiplus::GdiplusStartupInput gdiplusStartupInput;
     ULONG_PTR gdiplusToken;
@@ -275,6 +289,7 @@ bool TextureManager::LoadAllTexturesAndBuildFonts()
             LOG_F(ERROR, "Building font atlas failed (invalid font file?)! Falling back to internal font");
 
             io.Fonts->Clear();
+            OutlinedGlyphAtlas::Get().Clear();
 
             font = io.Fonts->AddFontDefault();
             font_compact = font;
@@ -285,6 +300,9 @@ bool TextureManager::LoadAllTexturesAndBuildFonts()
 
         io.Fonts->ClearInputData(); //We don't need to keep this around, reduces RAM use a lot
 
+        //Atlas pixels aren't retrieved here, so there's nothing to bake into
+        OutlinedGlyphAtlas::Get().Clear();
+
         UIManager::Get()->SetFonts(font_compact, font_large);
 
         m_ReloadLater = false;
@@ -387,6 +405,7 @@ bool TextureManager::LoadAllTexturesAndBuildFonts()
         ImVector<ImFontAtlasCustomRect> custom_rects_back = io.Fonts->CustomRects;
         int desired_width_back = io.Fonts->TexDesiredWidth;
         io.Fonts->Clear();
+        OutlinedGlyphAtlas::Get().Clear();     //Reserved rects are kept below, but the fonts they were for are gone
 
         font = io.Fonts->AddFontDefault();
         font_compact = font;
@@ -403,6 +422,9 @@ bool TextureManager::LoadAllTexturesAndBuildFonts()
     int tex_width, tex_height;
     io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_width, &tex_height);
 
+    //Render outlined glyphs into the space reserved for them
+    OutlinedGlyphAtlas::Get().Bake(tex_pixels, tex_width, tex_height);
+
     //Actually do the copying now
     icon_id = 0;
     auto action_tex_data_it = action_icon_tex_data.begin();
@@ -613,7 +635,7 @@ int TextureManager::GetWindowIconCacheID(HWND window_handle)
 {
     WindowInfo const* info_ptr = WindowManager::Get().WindowListFindWindow(window_handle);
 
-    return (info_ptr != nullptr) ? GetWindowIconCacheID(info_ptr->GetIcon()) : -1;
+    return (info_ptr != nullptr) ? GetWindowIconCacheID(*info_ptr) : -1;
 }
 
 int TextureManager::GetWindowIconCacheID(HWND window_handle, uint64_t& icon_handle_config)
@@ -634,6 +656,19 @@ int TextureManager::GetWindowIconCacheID(HWND window_handle, uint64_t& icon_hand
     return -1;
 }
 
+int TextureManager::GetWindowIconCacheID(const WindowInfo& window_info)
+{
+    HICON icon_handle = window_info.GetIcon();  //Requests the icon if needed
+
+    //Unresolved icons all share the default icon instead of each fallback icon taking its own atlas slot until the real one arrives
+    if (!WindowInfo::IsIconFinal(window_info.GetWindowHandle()))
+    {
+        icon_handle = ::LoadIcon(nullptr, IDI_APPLICATION);
+    }
+
+    return GetWindowIconCacheID(icon_handle);
+}
+
 int TextureManager::GetWindowIconCacheID(HICON icon_handle)
 {
     //Look if the icon is already loaded
@@ -772,6 +807,29 @@ bool TextureManager::GetWindowIconTextureInfo(int icon_cache_id, ImVec2& size, I
     return false;
 }
 
+void TextureManager::UpdateWindowVirtualList(VirtualList& list)
+{
+    //Icons are resolved on a worker thread after windows were added, so those count as a change too. Both only ever count up, so their sum changes whenever either does
+    const unsigned int revision = WindowManager::Get().WindowListGetRevision() + WindowManager::Get().WindowListGetIconGeneration();
+
+    if ( (list.HasSourceRevision()) && (list.GetSourceRevision() == revision) )
+        return;
+
+    list.Clear();
+
+    for (const WindowInfo& window_info : WindowManager::Get().WindowListGet())
+    {
+        list.AddRow((uint64_t)window_info.GetWindowHandle(), window_info.GetListTitle(), GetWindowIconCacheID(window_info));
+    }
+
+    list.SetSourceRevision(revision);
+    list.SetIconLookupFunction([](int icon_cache_id, ImVec2& uv_min, ImVec2& uv_max)
+                               {
+                                   ImVec2 size;
+                                   return TextureManager::Get().GetWindowIconTextureInfo(icon_cache_id, size, uv_min, uv_max);
+                               });
+}
+
 bool TextureManager::GetOverlayIconTextureInfo(OverlayConfigData& data, ImVec2& size, ImVec2& uv_min, ImVec2& uv_max, bool is_xsmall, bool* has_window_icon)
 {
     if ( (is_xsmall) && (data.ConfigInt[configid_int_overlay_capture_source] == ovrl_capsource_winrt_capture) && (data.ConfigHandle[configid_handle_overlay_state_winrt_hwnd] != 0) )
@@ -14,6 +14,8 @@
 #include "imgui.h"
 
 struct Action;
+class VirtualList;
+class WindowInfo;
 
 enum TMNGRTexID
 {
@@ -116,7 +118,10 @@ class TextureManager
         int  GetWindowIconCacheID(HWND window_handle); //Returns -1 on error
         int  GetWindowIconCacheID(HWND window_handle, uint64_t& icon_handle_config); //Updates icon_handle_config when lookup with window_handle succeeds or falls back to icon_handle_config
         int  GetWindowIconCacheID(HICON icon_handle);  //Returns -1 on error
+        int  GetWindowIconCacheID(const WindowInfo& window_info); //Uses a placeholder icon shared by all windows until the window's own icon is resolved. Returns -1 on error
         bool GetWindowIconTextureInfo(int icon_cache_id, ImVec2& size, ImVec2& uv_min, ImVec2& uv_max) const;
+        //Rebuilds list with a row per window from the WindowManager window list if it changed since the last call. Window icons are resolved once per rebuild
+        void UpdateWindowVirtualList(VirtualList& list);
 
         bool GetOverlayIconTextureInfo(OverlayConfigData& data, ImVec2& size, ImVec2& uv_min, ImVec2& uv_max, bool is_xsmall = false, bool* has_window_icon = nullptr);
 
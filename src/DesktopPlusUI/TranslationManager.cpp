@@ -6,6 +6,7 @@
 #include "Logging.h"
 
 #include <clocale>
+#include <algorithm>
 
 const char* TranslationManager::s_StringIDNames[tstr_MAX] =
 {
@@ -709,13 +710,43 @@ const char* TranslationManager::GetString(TRMGRStrID str_id)
     return Get().m_Strings[str_id].c_str();
 }
 
+const std::array<TRMGRStrID, tstr_MAX>& TranslationManager::GetStringIDsSorted()
+{
+    static const std::array<TRMGRStrID, tstr_MAX> ids_sorted = []()
+    {
+        std::array<TRMGRStrID, tstr_MAX> ids;
+
+        for (size_t i = 0; i < tstr_MAX; ++i)
+        {
+            ids[i] = (TRMGRStrID)i;
+        }
+
+        std::sort(ids.begin(), ids.end(), [](TRMGRStrID a, TRMGRStrID b){ return (_stricmp(s_StringIDNames[a], s_StringIDNames[b]) < 0); });
+
+        return ids;
+    }();
+
+    return ids_sorted;
+}
+
+TRMGRStrID TranslationManager::FindStringIDCaseInsensitive(const char* str)
+{
+    const std::array<TRMGRStrID, tstr_MAX>& ids_sorted = GetStringIDsSorted();
+    const auto it = std::lower_bound(ids_sorted.begin(), ids_sorted.end(), str, [](TRMGRStrID str_id, const char* str){ return (_stricmp(s_StringIDNames[str_id], str) < 0); });
+
+    if ( (it != ids_sorted.end()) && (_stricmp(s_StringIDNames[*it], str) == 0) )
+        return *it;
+
+    return tstr_NONE;
+}
+
 TRMGRStrID TranslationManager::GetStringID(const char* str)
 {
-    const auto it_begin = std::begin(s_StringIDNames), it_end = std::end(s_StringIDNames);
-    const auto it = std::find_if(it_begin, it_end, [&](const char* str_id_name){ return (strcmp(str_id_name, str) == 0); });
+    //Lookup is sorted case-insensitively to match ini keys, but string IDs are otherwise case-sensitive
+    const TRMGRStrID str_id = FindStringIDCaseInsensitive(str);
 
-    if (it != it_end)
-        return (TRMGRStrID)std::distance(it_begin, it);
+    if ( (str_id != tstr_NONE) && (strcmp(s_StringIDNames[str_id], str) == 0) )
+        return str_id;
 
     return tstr_NONE;
 }
@@ -813,15 +844,26 @@ void TranslationManager::LoadTranslationFromFile(const std::string& filename)
         m_StringsDesktopID.clear();
         m_StringsFPSLimit.clear();
 
-        //Try loading all possible strings
-        for (size_t i = 0; i < tstr_MAX; ++i)
+        //Load all strings in the file in one pass, looking up keys per string ID is slow with this many strings
+        bool is_string_loaded[tstr_MAX] = {false};
+
+        for (const auto& key_value : lang_file.GetKeyValueList("Strings"))
         {
-            if (lang_file.KeyExists("Strings", s_StringIDNames[i]))
+            const TRMGRStrID str_id = FindStringIDCaseInsensitive(key_value.first.c_str());
+
+            //Only the first occurrence of duplicate keys counts, same as when reading them individually
+            if ( (str_id != tstr_NONE) && (!is_string_loaded[str_id]) )
             {
-                m_Strings[i] = lang_file.ReadString("Strings", s_StringIDNames[i]);
-                StringReplaceAll(m_Strings[i], "\\n", "\n");    //Replace new line placeholder
+                m_Strings[str_id] = key_value.second;
+                StringReplaceAll(m_Strings[str_id], "\\n", "\n");    //Replace new line placeholder
+
+                is_string_loaded[str_id] = true;
             }
-            else
+        }
+
+        for (size_t i = 0; i < tstr_MAX; ++i)
+        {
+            if (!is_string_loaded[i])
             {
                 m_IsCurrentTranslationComplete = false;
 
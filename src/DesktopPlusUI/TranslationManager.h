@@ -2,6 +2,7 @@
 
 #include <string>
 #include <vector>
+#include <array>
 
 #include "imgui.h"
 
@@ -710,6 +711,9 @@ class TranslationManager
         std::string m_CurrentTranslationFontName;
         bool m_IsCurrentTranslationComplete;
 
+        static const std::array<TRMGRStrID, tstr_MAX>& GetStringIDsSorted();   //IDs sorted by name, case-insensitive
+        static TRMGRStrID FindStringIDCaseInsensitive(const char* str);       //Binary search, may return tstr_NONE
+
     public:
         TranslationManager();
         static TranslationManager& Get();
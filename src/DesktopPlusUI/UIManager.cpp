@@ -13,6 +13,7 @@
 #include "Util.h"
 #include "COMWrapper.h"
 #include "OpenVRExt.h"
+#include "OverlayStateMirror.h"
 #include "WindowManager.h"
 
 #include "DesktopPlusWinRT.h"
@@ -285,7 +286,9 @@ UIManager::UIManager(bool desktop_mode, bool keyboard_editor_mode) :
     m_OvrlPixelWidth(1),
     m_OvrlPixelHeight(1),
     m_TransformSyncValueCount(0),
-    m_TransformSyncValues{0}
+    m_TransformSyncValues{0},
+    m_UIIntersectionMaskMapping(nullptr),
+    m_UIIntersectionMaskMemory(nullptr)
 {
     g_UIManagerPtr = this;
 
@@ -313,17 +316,35 @@ UIManager::UIManager(bool desktop_mode, bool keyboard_editor_mode) :
 
     ::CloseHandle(pi.hProcess);
     ::CloseHandle(pi.hThread);
+
+    //The intersection mask is only sent from the VR overlays
+    if (!m_DesktopMode)
+    {
+        InitUIIntersectionMaskChannel();
+    }
 }
 
 UIManager::~UIManager()
 {
     g_UIManagerPtr = nullptr;
+
+    m_UIIntersectionMaskChannel.Detach();
+
+    if (m_UIIntersectionMaskMemory != nullptr)
+    {
+        ::UnmapViewOfFile(m_UIIntersectionMaskMemory);
+    }
+
+    if (m_UIIntersectionMaskMapping != nullptr)
+    {
+        ::CloseHandle(m_UIIntersectionMaskMapping);
+    }
 }
 
 void UIManager::DisplayDashboardAppError(const std::string& str) //Ideally this is never called
 {
     //Hide UI overlay
-    vr::VROverlay()->HideOverlay(m_OvrlHandleOverlayBar);
+    OverlayStateMirror::Get().HideOverlay(m_OvrlHandleOverlayBar);
     m_OvrlVisible = false;
 
     //Hide all dashboard app overlays as well. Usually the dashboard app closes, but it may sometimes get stuck which could put its overlays in the way of the message overlay.
@@ -333,7 +354,7 @@ void UIManager::DisplayDashboardAppError(const std::string& str) //Ideally this
 
         if (ovrl_handle != vr::k_ulOverlayHandleInvalid)
         {
-            vr::VROverlay()->HideOverlay(ovrl_handle);
+            OverlayStateMirror::Get().HideOverlay(ovrl_handle);
         }
     }
 
@@ -357,8 +378,8 @@ void UIManager::DisplayInitialSetupNotification()
     if ((activity_level == vr::k_EDeviceActivityLevel_UserInteraction) || (activity_level == vr::k_EDeviceActivityLevel_UserInteraction_Timeout))
     {
         //Also check if the HMD is tracking properly right now so the notification can actually be seen (fresh SteamVR start is active but not tracking for example)
-        vr::TrackedDevicePose_t poses[vr::k_unTrackedDeviceIndex_Hmd + 1];
-        vr::VRSystem()->GetDeviceToAbsoluteTrackingPose(vr::TrackingUniverseStanding, vr::IVRSystemEx::GetTimeNowToPhotons(), poses, vr::k_unTrackedDeviceIndex_Hmd + 1);
+        vr::TrackedDevicePose_t poses[vr::k_unMaxTrackedDeviceCount];
+        TrackedPoseSnapshot::Get().GetPoses(poses);
 
         use_vr_notification = (poses[vr::k_unTrackedDeviceIndex_Hmd].eTrackingResult == vr::TrackingResult_Running_OK);
     }
@@ -373,7 +394,7 @@ void UIManager::DisplayInitialSetupNotification()
         //Despite being sent after overlay creation, it may not be returned right away, so keep trying a bit
         for (int tries = 0; tries < 20; ++tries)
         {
-            vr::VROverlay()->FindOverlay("elvissteinjr.DesktopPlusDashboard", &m_OvrlHandleDPlusDashboard);
+            OverlayStateMirror::Get().FindOverlay("elvissteinjr.DesktopPlusDashboard", &m_OvrlHandleDPlusDashboard);
 
             if (m_OvrlHandleDPlusDashboard != vr::k_ulOverlayHandleInvalid)
             {
@@ -396,12 +417,12 @@ void UIManager::SetOverlayInputEnabled(bool is_enabled)
 {
     vr::VROverlayInputMethod input_method = (is_enabled) ? vr::VROverlayInputMethod_Mouse : vr::VROverlayInputMethod_None;
 
-    vr::VROverlay()->SetOverlayInputMethod(m_OvrlHandleOverlayBar,        input_method);
-    vr::VROverlay()->SetOverlayInputMethod(m_OvrlHandleFloatingUI,        input_method);
-    vr::VROverlay()->SetOverlayInputMethod(m_OvrlHandleSettings,          input_method);
-    vr::VROverlay()->SetOverlayInputMethod(m_OvrlHandleOverlayProperties, input_method);
-    vr::VROverlay()->SetOverlayInputMethod(m_OvrlHandleKeyboard,          input_method);
-    vr::VROverlay()->SetOverlayInputMethod(m_OvrlHandleAuxUI,             input_method);
+    OverlayStateMirror::Get().SetOverlayInputMethod(m_OvrlHandleOverlayBar,        input_method);
+    OverlayStateMirror::Get().SetOverlayInputMethod(m_OvrlHandleFloatingUI,        input_method);
+    OverlayStateMirror::Get().SetOverlayInputMethod(m_OvrlHandleSettings,          input_method);
+    OverlayStateMirror::Get().SetOverlayInputMethod(m_OvrlHandleOverlayProperties, input_method);
+    OverlayStateMirror::Get().SetOverlayInputMethod(m_OvrlHandleKeyboard,          input_method);
+    OverlayStateMirror::Get().SetOverlayInputMethod(m_OvrlHandleAuxUI,             input_method);
 }
 
 UITexspaceID UIManager::GetTexspaceIDForOverlayHandle(vr::VROverlayHandle_t overlay_handle) const
@@ -473,11 +494,11 @@ vr::EVRInitError UIManager::InitOverlay()
         //This loop gets rid of any other process hogging our overlay key. Though in normal situations another Desktop+UI process would've already be killed before this
         for (int tries = 0; tries < 10; ++tries)
         {
-            ovrl_error = vr::VROverlay()->CreateOverlay("elvissteinjr.DesktopPlusUI", "Desktop+UI", &m_OvrlHandleOverlayBar);
+            ovrl_error = OverlayStateMirror::Get().CreateOverlay("elvissteinjr.DesktopPlusUI", "Desktop+UI", &m_OvrlHandleOverlayBar);
 
             if (ovrl_error == vr::VROverlayError_KeyInUse)  //If the key is already in use, kill the owning process (hopefully another instance of this app)
             {
-                ovrl_error = vr::VROverlay()->FindOverlay("elvissteinjr.DesktopPlusUI", &m_OvrlHandleOverlayBar);
+                ovrl_error = OverlayStateMirror::Get().FindOverlay("elvissteinjr.DesktopPlusUI", &m_OvrlHandleOverlayBar);
 
                 if ((ovrl_error == vr::VROverlayError_None) && (m_OvrlHandleOverlayBar != vr::k_ulOverlayHandleInvalid))
                 {
@@ -514,29 +535,29 @@ vr::EVRInitError UIManager::InitOverlay()
 
         if (m_OvrlHandleOverlayBar != vr::k_ulOverlayHandleInvalid)
         {
-            vr::VROverlay()->SetOverlayWidthInMeters(m_OvrlHandleOverlayBar, OVERLAY_WIDTH_METERS_DASHBOARD_UI);
+            OverlayStateMirror::Get().SetOverlayWidthInMeters(m_OvrlHandleOverlayBar, OVERLAY_WIDTH_METERS_DASHBOARD_UI);
 
             //Init additional overlays
-            vr::VROverlay()->CreateOverlay("elvissteinjr.DesktopPlusUIFloating",          "Desktop+ Floating UI", &m_OvrlHandleFloatingUI);
-            vr::VROverlay()->CreateOverlay("elvissteinjr.DesktopPlusUISettings",          "Desktop+ Settings UI", &m_OvrlHandleSettings);
-            vr::VROverlay()->CreateOverlay("elvissteinjr.DesktopPlusUIOverlayProperties", "Desktop+ Settings UI", &m_OvrlHandleOverlayProperties);
-            vr::VROverlay()->CreateOverlay("elvissteinjr.DesktopPlusUIKeyboard",          "Desktop+ Keyboard",    &m_OvrlHandleKeyboard);
-            vr::VROverlay()->CreateOverlay("elvissteinjr.DesktopPlusUIAux",               "Desktop+ Aux UI",      &m_OvrlHandleAuxUI);
+            OverlayStateMirror::Get().CreateOverlay("elvissteinjr.DesktopPlusUIFloating",          "Desktop+ Floating UI", &m_OvrlHandleFloatingUI);
+            OverlayStateMirror::Get().CreateOverlay("elvissteinjr.DesktopPlusUISettings",          "Desktop+ Settings UI", &m_OvrlHandleSettings);
+            OverlayStateMirror::Get().CreateOverlay("elvissteinjr.DesktopPlusUIOverlayProperties", "Desktop+ Settings UI", &m_OvrlHandleOverlayProperties);
+            OverlayStateMirror::Get().CreateOverlay("elvissteinjr.DesktopPlusUIKeyboard",          "Desktop+ Keyboard",    &m_OvrlHandleKeyboard);
+            OverlayStateMirror::Get().CreateOverlay("elvissteinjr.DesktopPlusUIAux",               "Desktop+ Aux UI",      &m_OvrlHandleAuxUI);
 
-            vr::VROverlay()->SetOverlayWidthInMeters(m_OvrlHandleFloatingUI,        OVERLAY_WIDTH_METERS_DASHBOARD_UI);
-            vr::VROverlay()->SetOverlayWidthInMeters(m_OvrlHandleSettings,          OVERLAY_WIDTH_METERS_SETTINGS);
-            vr::VROverlay()->SetOverlayWidthInMeters(m_OvrlHandleOverlayProperties, OVERLAY_WIDTH_METERS_SETTINGS);
-            vr::VROverlay()->SetOverlayWidthInMeters(m_OvrlHandleKeyboard,          OVERLAY_WIDTH_METERS_KEYBOARD);
+            OverlayStateMirror::Get().SetOverlayWidthInMeters(m_OvrlHandleFloatingUI,        OVERLAY_WIDTH_METERS_DASHBOARD_UI);
+            OverlayStateMirror::Get().SetOverlayWidthInMeters(m_OvrlHandleSettings,          OVERLAY_WIDTH_METERS_SETTINGS);
+            OverlayStateMirror::Get().SetOverlayWidthInMeters(m_OvrlHandleOverlayProperties, OVERLAY_WIDTH_METERS_SETTINGS);
+            OverlayStateMirror::Get().SetOverlayWidthInMeters(m_OvrlHandleKeyboard,          OVERLAY_WIDTH_METERS_KEYBOARD);
 
-            vr::VROverlay()->SetOverlayAlpha(m_OvrlHandleFloatingUI, 0.0f);
+            OverlayStateMirror::Get().SetOverlayAlpha(m_OvrlHandleFloatingUI, 0.0f);
 
             //Set input parameters
-            vr::VROverlay()->SetOverlayFlag(m_OvrlHandleOverlayBar,        vr::VROverlayFlags_SendVRSmoothScrollEvents, true);
-            vr::VROverlay()->SetOverlayFlag(m_OvrlHandleSettings,          vr::VROverlayFlags_SendVRSmoothScrollEvents, true);
-            vr::VROverlay()->SetOverlayFlag(m_OvrlHandleOverlayProperties, vr::VROverlayFlags_SendVRSmoothScrollEvents, true);
-            vr::VROverlay()->SetOverlayFlag(m_OvrlHandleKeyboard,          vr::VROverlayFlags_SendVRSmoothScrollEvents, true);
-            vr::VROverlay()->SetOverlayFlag(m_OvrlHandleKeyboard,          vr::VROverlayFlags_MultiCursor,              true);
-            vr::VROverlay()->SetOverlayFlag(m_OvrlHandleAuxUI,             vr::VROverlayFlags_SendVRSmoothScrollEvents, true);
+            OverlayStateMirror::Get().SetOverlayFlag(m_OvrlHandleOverlayBar,        vr::VROverlayFlags_SendVRSmoothScrollEvents, true);
+            OverlayStateMirror::Get().SetOverlayFlag(m_OvrlHandleSettings,          vr::VROverlayFlags_SendVRSmoothScrollEvents, true);
+            OverlayStateMirror::Get().SetOverlayFlag(m_OvrlHandleOverlayProperties, vr::VROverlayFlags_SendVRSmoothScrollEvents, true);
+            OverlayStateMirror::Get().SetOverlayFlag(m_OvrlHandleKeyboard,          vr::VROverlayFlags_SendVRSmoothScrollEvents, true);
+            OverlayStateMirror::Get().SetOverlayFlag(m_OvrlHandleKeyboard,          vr::VROverlayFlags_MultiCursor,              true);
+            OverlayStateMirror::Get().SetOverlayFlag(m_OvrlHandleAuxUI,             vr::VROverlayFlags_SendVRSmoothScrollEvents, true);
 
             vr::HmdVector2_t mouse_scale;
             mouse_scale.v[0] = (float)UITextureSpaces::Get().GetRect(ui_texspace_total).GetWidth();
@@ -564,35 +585,35 @@ vr::EVRInitError UIManager::InitOverlay()
             bounds.vMin = rect_overlay_bar.GetTL().y / tex_height;
             bounds.uMax = rect_overlay_bar.GetBR().x / tex_width;
             bounds.vMax = rect_overlay_bar.GetBR().y / tex_height;
-            vr::VROverlay()->SetOverlayTextureBounds(m_OvrlHandleOverlayBar, &bounds);
+            OverlayStateMirror::Get().SetOverlayTextureBounds(m_OvrlHandleOverlayBar, &bounds);
 
             const DPRect& rect_floating_ui = UITextureSpaces::Get().GetRect(ui_texspace_floating_ui);
             bounds.uMin = rect_floating_ui.GetTL().x / tex_width;
             bounds.vMin = rect_floating_ui.GetTL().y / tex_height;
             bounds.uMax = rect_floating_ui.GetBR().x / tex_width;
             bounds.vMax = rect_floating_ui.GetBR().y / tex_height;
-            vr::VROverlay()->SetOverlayTextureBounds(m_OvrlHandleFloatingUI, &bounds);
+            OverlayStateMirror::Get().SetOverlayTextureBounds(m_OvrlHandleFloatingUI, &bounds);
 
             const DPRect& rect_settings = UITextureSpaces::Get().GetRect(ui_texspace_settings);
             bounds.uMin = rect_settings.GetTL().x / tex_width;
             bounds.vMin = rect_settings.GetTL().y / tex_height;
             bounds.uMax = rect_settings.GetBR().x / tex_width;
             bounds.vMax = rect_settings.GetBR().y / tex_height;
-            vr::VROverlay()->SetOverlayTextureBounds(m_OvrlHandleSettings, &bounds);
+            OverlayStateMirror::Get().SetOverlayTextureBounds(m_OvrlHandleSettings, &bounds);
 
             const DPRect& rect_ovrlprops = UITextureSpaces::Get().GetRect(ui_texspace_overlay_properties);
             bounds.uMin = rect_ovrlprops.GetTL().x / tex_width;
             bounds.vMin = rect_ovrlprops.GetTL().y / tex_height;
             bounds.uMax = rect_ovrlprops.GetBR().x / tex_width;
             bounds.vMax = rect_ovrlprops.GetBR().y / tex_height;
-            vr::VROverlay()->SetOverlayTextureBounds(m_OvrlHandleOverlayProperties, &bounds);
+            OverlayStateMirror::Get().SetOverlayTextureBounds(m_OvrlHandleOverlayProperties, &bounds);
 
             const DPRect& rect_keyboard = UITextureSpaces::Get().GetRect(ui_texspace_keyboard);
             bounds.uMin = rect_keyboard.GetTL().x / tex_width;
             bounds.vMin = rect_keyboard.GetTL().y / tex_height;
             bounds.uMax = rect_keyboard.GetBR().x / tex_width;
             bounds.vMax = rect_keyboard.GetBR().y / tex_height;
-            vr::VROverlay()->SetOverlayTextureBounds(m_OvrlHandleKeyboard, &bounds);
+            OverlayStateMirror::Get().SetOverlayTextureBounds(m_OvrlHandleKeyboard, &bounds);
 
             //Set curve pitch for overlay bar. This adjusts the pitch to match the SteamVR dashboard
             vr::VROverlay()->SetOverlayPreCurvePitch(m_OvrlHandleOverlayBar, 0.20f);
@@ -601,7 +622,7 @@ vr::EVRInitError UIManager::InitOverlay()
 
     //Cache SystemUI handle as it won't change during the session anyways
     //We do not cache the GamepadUI handle as it may disappear during the session when Steam closes and make SteamVR switch to the previous dashboard
-    vr::VROverlay()->FindOverlay("system.systemui", &m_OvrlHandleSystemUI);
+    OverlayStateMirror::Get().FindOverlay("system.systemui", &m_OvrlHandleSystemUI);
 
     m_OpenVRLoaded = true;
     m_LowCompositorRes = (vr::VRSettings()->GetFloat("GpuSpeed", "gpuSpeedRenderTargetScale") < 1.0f);
@@ -1135,6 +1156,7 @@ void UIManager::OnExit()
     COMWrapper::Get().SetActive(false);
 
     vr::VR_Shutdown();
+    OverlayStateMirror::Get().Reset();
 }
 
 void UIManager::OnProfileLoaded()
@@ -1292,19 +1314,63 @@ bool UIManager::IsDummyOverlayTransformUnstable() const
     return m_IsDummyOverlayTransformUnstable;
 }
 
-void UIManager::SendUIIntersectionMaskToDashboardApp(std::vector<vr::VROverlayIntersectionMaskPrimitive_t>& primitives) const
+void UIManager::InitUIIntersectionMaskChannel()
+{
+    const DWORD mapping_size = (DWORD)UIIntersectionMaskChannel::GetRequiredMemorySize();
+
+    //The dashboard app keeps the mapping open, so it may already exist from a previous UI process
+    m_UIIntersectionMaskMapping = ::CreateFileMapping(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0, mapping_size, g_SharedMemoryNameUIIntersectionMask);
+    const bool mapping_existed = (::GetLastError() == ERROR_ALREADY_EXISTS);
+
+    if (m_UIIntersectionMaskMapping != nullptr)
+    {
+        m_UIIntersectionMaskMemory = ::MapViewOfFile(m_UIIntersectionMaskMapping, FILE_MAP_ALL_ACCESS, 0, 0, mapping_size);
+    }
+
+    if (m_UIIntersectionMaskMemory != nullptr)
+    {
+        if ( (!mapping_existed) || (!m_UIIntersectionMaskChannel.Attach(m_UIIntersectionMaskMemory, mapping_size)) )
+        {
+            m_UIIntersectionMaskChannel.Init(m_UIIntersectionMaskMemory);
+        }
+    }
+    else
+    {
+        LOG_F(WARNING, "Failed to create UI intersection mask shared memory, falling back to IPC messages");
+
+        if (m_UIIntersectionMaskMapping != nullptr)
+        {
+            ::CloseHandle(m_UIIntersectionMaskMapping);
+            m_UIIntersectionMaskMapping = nullptr;
+        }
+    }
+}
+
+void UIManager::SendUIIntersectionMaskToDashboardApp(std::vector<vr::VROverlayIntersectionMaskPrimitive_t>& primitives)
 {
     static ULONGLONG last_tick = 0;
 
+    m_UIIntersectionMaskRects.clear();
+
+    for (const auto& rect : primitives)
+    {
+        m_UIIntersectionMaskRects.emplace_back((int)rect.m_Primitive.m_Rectangle.m_flTopLeftX,  (int)rect.m_Primitive.m_Rectangle.m_flTopLeftY, 
+                                               (int)rect.m_Primitive.m_Rectangle.m_flTopLeftX + (int)rect.m_Primitive.m_Rectangle.m_flWidth, (int)rect.m_Primitive.m_Rectangle.m_flTopLeftY + (int)rect.m_Primitive.m_Rectangle.m_flHeight);
+    }
+
+    //Only writes anything when the mask changed, so this is fine to do every frame
+    if (m_UIIntersectionMaskChannel.IsValid())
+    {
+        m_UIIntersectionMaskChannel.Publish(m_UIIntersectionMaskRects);
+        return;
+    }
+
     //Mask can change at any time, any frame. We don't really want to send too many messages either though, so we limit the rate and don't update at all if the pointer isn't active
     if ( (ConfigManager::GetValue(configid_int_state_dplus_laser_pointer_device) != vr::k_unTrackedDeviceIndexInvalid) && (last_tick + 100 > ::GetTickCount64()) )
         return;
 
-    for (const auto& rect : primitives)
+    for (const auto& dp_rect : m_UIIntersectionMaskRects)
     {
-        DPRect dp_rect((int)rect.m_Primitive.m_Rectangle.m_flTopLeftX,  (int)rect.m_Primitive.m_Rectangle.m_flTopLeftY, 
-                       (int)rect.m_Primitive.m_Rectangle.m_flTopLeftX + (int)rect.m_Primitive.m_Rectangle.m_flWidth, (int)rect.m_Primitive.m_Rectangle.m_flTopLeftY + (int)rect.m_Primitive.m_Rectangle.m_flHeight);
-
         IPCManager::Get().PostMessageToDashboardApp(ipcmsg_action, ipcact_lpointer_ui_mask_rect, (LPARAM)dp_rect.Pack16());
     }
 
@@ -1757,21 +1823,21 @@ void UIManager::OnOverlayNameChanged()
 
 void UIManager::UpdateOverlayDimming()
 {
-    if ( (ConfigManager::GetValue(configid_bool_interface_dim_ui)) && (vr::VROverlay()->IsOverlayVisible(m_OvrlHandleDPlusDashboard)) )
+    if ( (ConfigManager::GetValue(configid_bool_interface_dim_ui)) && (OverlayStateMirror::Get().IsOverlayVisible(m_OvrlHandleDPlusDashboard)) )
     {
         for (const auto& overlay_handle : GetUIOverlayHandles())
         {
-            vr::VROverlay()->SetOverlayColor(overlay_handle, 0.05f, 0.05f, 0.05f);
+            OverlayStateMirror::Get().SetOverlayColor(overlay_handle, 0.05f, 0.05f, 0.05f);
         }
 
-        vr::VROverlay()->SetOverlayColor(m_OvrlHandleOverlayBar, 0.05f, 0.05f, 0.05f);
+        OverlayStateMirror::Get().SetOverlayColor(m_OvrlHandleOverlayBar, 0.05f, 0.05f, 0.05f);
         ImGui::GetStyle().Colors[ImGuiCol_WindowBg].w = 1.0f; //Set window bg alpha to 100% to not have the contrast be even worse on light backgrounds
     }
     else
     {
         for (const auto& overlay_handle : GetUIOverlayHandles())
         {
-            vr::VROverlay()->SetOverlayColor(overlay_handle, 1.0f, 1.0f, 1.0f);
+            OverlayStateMirror::Get().SetOverlayColor(overlay_handle, 1.0f, 1.0f, 1.0f);
         }
 
         ImGui::GetStyle().Colors[ImGuiCol_WindowBg].w = 0.96f;
@@ -2004,7 +2070,7 @@ void UIManager::UpdateDesktopOverlayPixelSize()
     if (m_OpenVRLoaded)
     {
         vr::VROverlayHandle_t ovrl_handle_dplus = vr::k_ulOverlayHandleInvalid;
-        vr::VROverlay()->FindOverlay("elvissteinjr.DesktopPlusDesktopTexture", &ovrl_handle_dplus);
+        OverlayStateMirror::Get().FindOverlay("elvissteinjr.DesktopPlusDesktopTexture", &ovrl_handle_dplus);
 
         if (ovrl_handle_dplus != vr::k_ulOverlayHandleInvalid)
         {
@@ -2044,13 +2110,12 @@ void UIManager::UpdateDesktopOverlayPixelSize()
 
 void UIManager::PositionOverlay()
 {
-    vr::VROverlay()->FindOverlay("elvissteinjr.DesktopPlusDashboard", &m_OvrlHandleDPlusDashboard);
+    OverlayStateMirror::Get().FindOverlay("elvissteinjr.DesktopPlusDashboard", &m_OvrlHandleDPlusDashboard);
 
     if (m_OvrlHandleDPlusDashboard != vr::k_ulOverlayHandleInvalid)
     {
         //Adjust behavior if gamepad ui (SteamVR 2 dashboard) exists
-        vr::VROverlayHandle_t handle_gamepad_ui = vr::k_ulOverlayHandleInvalid;
-        vr::VROverlay()->FindOverlay("valve.steam.gamepadui.bar", &handle_gamepad_ui);
+        vr::VROverlayHandle_t handle_gamepad_ui = TrackedPoseSnapshot::Get().GetGamepadUIOverlayHandle();
 
         const bool is_legacy_dashboard_active = (handle_gamepad_ui == vr::k_ulOverlayHandleInvalid);
 
@@ -2146,12 +2211,12 @@ void UIManager::PositionOverlay()
 
         if (!m_IsDummyOverlayTransformUnstable)
         {
-            vr::VROverlay()->SetOverlayTransformAbsolute(m_OvrlHandleOverlayBar, origin, &matrix_ovr);
+            OverlayStateMirror::Get().SetOverlayTransformAbsolute(m_OvrlHandleOverlayBar, origin, &matrix_ovr);
             vr::VROverlay()->SetOverlayCurvature(m_OvrlHandleOverlayBar, curve);
         }
 
         //Set visibility
-        if (vr::VROverlay()->IsOverlayVisible(m_OvrlHandleDPlusDashboard))
+        if (OverlayStateMirror::Get().IsOverlayVisible(m_OvrlHandleDPlusDashboard))
         {
             bool is_systemui_hovered = ConfigManager::Get().IsLaserPointerTargetOverlay(m_OvrlHandleSystemUI);
 
@@ -2186,7 +2251,7 @@ void UIManager::PositionOverlay()
 
             if (!m_OvrlVisible)
             {
-                vr::VROverlay()->ShowOverlay(m_OvrlHandleOverlayBar);
+                OverlayStateMirror::Get().ShowOverlay(m_OvrlHandleOverlayBar);
                 m_WindowOverlayBar.Show();
                 m_OvrlVisible = true;
                 UpdateOverlayDimming();
@@ -2222,12 +2287,12 @@ void UIManager::PositionOverlay()
                                 if (m_OvrlOverlayBarAlpha < 0.0f)
                                     m_OvrlOverlayBarAlpha = 0.0f;
 
-                                vr::VROverlay()->SetOverlayAlpha(m_OvrlHandleOverlayBar, m_OvrlOverlayBarAlpha);
+                                OverlayStateMirror::Get().SetOverlayAlpha(m_OvrlHandleOverlayBar, m_OvrlOverlayBarAlpha);
                             }
-                            else if (vr::VROverlay()->IsOverlayVisible(m_OvrlHandleOverlayBar))
+                            else if (OverlayStateMirror::Get().IsOverlayVisible(m_OvrlHandleOverlayBar))
                             {
                                 m_WindowOverlayBar.HideMenus();
-                                vr::VROverlay()->HideOverlay(m_OvrlHandleOverlayBar); //Hide to avoid input flicker
+                                OverlayStateMirror::Get().HideOverlay(m_OvrlHandleOverlayBar); //Hide to avoid input flicker
                             }
                         }
                     }
@@ -2252,8 +2317,8 @@ void UIManager::PositionOverlay()
                             if (m_OvrlOverlayBarAlpha > 1.0f)
                                 m_OvrlOverlayBarAlpha = 1.0f;
 
-                            vr::VROverlay()->SetOverlayAlpha(m_OvrlHandleOverlayBar, m_OvrlOverlayBarAlpha);
-                            vr::VROverlay()->ShowOverlay(m_OvrlHandleOverlayBar);
+                            OverlayStateMirror::Get().SetOverlayAlpha(m_OvrlHandleOverlayBar, m_OvrlOverlayBarAlpha);
+                            OverlayStateMirror::Get().ShowOverlay(m_OvrlHandleOverlayBar);
                         }
                         else if (!is_systemui_hovered)
                         {
@@ -2276,7 +2341,7 @@ void UIManager::PositionOverlay()
                 }
                 else if (!m_WindowOverlayBar.IsVisibleOrFading()) //Wait for window fade-out to finish before hiding the overlay
                 {
-                    vr::VROverlay()->HideOverlay(m_OvrlHandleOverlayBar);
+                    OverlayStateMirror::Get().HideOverlay(m_OvrlHandleOverlayBar);
                     m_OvrlVisible = false;
 
                     UpdateOverlayDimming();
@@ -2286,7 +2351,7 @@ void UIManager::PositionOverlay()
     }
     else if (m_OvrlVisible) //Dashboard overlay has gone missing, hide
     {
-        vr::VROverlay()->HideOverlay(m_OvrlHandleOverlayBar);
+        OverlayStateMirror::Get().HideOverlay(m_OvrlHandleOverlayBar);
         m_WindowOverlayBar.Hide();
 
         m_OvrlVisible = false;
@@ -2343,7 +2408,7 @@ void UIManager::UpdateOverlayDrag()
 
             Matrix4 matrix_relative_offset = m_OverlayDragger.DragGestureFinish();
             float new_width = 1.0f;
-            vr::VROverlay()->GetOverlayWidthInMeters(drag_overlay_handle, &new_width);
+            OverlayStateMirror::Get().GetOverlayWidthInMeters(drag_overlay_handle, &new_width);
 
             //Store changed transform to the previously dragged overlay handle and update width/size config value
             if (drag_overlay_handle == m_OvrlHandleSettings)
@@ -2422,7 +2487,7 @@ void UIManager::HighlightOverlay(unsigned int overlay_id)
 
             ImVec4 col = ImGui::GetStyleColorVec4(ImGuiCol_ButtonHovered);
 
-            vr::VROverlay()->SetOverlayColor(ovrl_handle, col.x * brightness, col.y * brightness, col.z * brightness);
+            OverlayStateMirror::Get().SetOverlayColor(ovrl_handle, col.x * brightness, col.y * brightness, col.z * brightness);
 
             colored_handle = ovrl_handle;
         }
@@ -2431,7 +2496,7 @@ void UIManager::HighlightOverlay(unsigned int overlay_id)
             const OverlayConfigData& data = OverlayManager::Get().GetConfigData(OverlayManager::Get().FindOverlayID(colored_handle));
             float brightness = lin2log(data.ConfigFloat[configid_float_overlay_brightness]) * data.ConfigFloat[configid_float_overlay_state_brightness_extra_multiplier];
 
-            vr::VROverlay()->SetOverlayColor(colored_handle, brightness, brightness, brightness);
+            OverlayStateMirror::Get().SetOverlayColor(colored_handle, brightness, brightness, brightness);
 
             colored_handle = vr::k_ulOverlayHandleInvalid;
         }
@@ -2442,7 +2507,7 @@ float UIManager::GetOverlayHeight(vr::VROverlayHandle_t overlay_handle) const
 {
     //This only checks for overlays that are draggable by the UI
     float overlay_width = 1.0f;
-    vr::VROverlay()->GetOverlayWidthInMeters(overlay_handle, &overlay_width);
+    OverlayStateMirror::Get().GetOverlayWidthInMeters(overlay_handle, &overlay_width);
 
     const UITexspaceID overlay_texspace = GetTexspaceIDForOverlayHandle(overlay_handle);
     if (overlay_texspace == ui_texspace_total)
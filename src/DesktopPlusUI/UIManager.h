@@ -14,6 +14,7 @@
 #include "openvr.h"
 #include "Matrices.h"
 #include "DPRect.h"
+#include "UIIntersectionMaskChannel.h"
 
 #include "Logging.h"
 #include "NotificationIcon.h"
@@ -159,6 +160,11 @@ class UIManager
 
         std::vector<MSG> m_DelayedICPMessages;  //Stores ICP messages that need to be delayed for processing within an ImGui frame
 
+        UIIntersectionMaskChannel m_UIIntersectionMaskChannel;  //Not valid if shared memory couldn't be set up, IPC messages are used then
+        HANDLE m_UIIntersectionMaskMapping;
+        void* m_UIIntersectionMaskMemory;
+        std::vector<DPRect> m_UIIntersectionMaskRects;
+
         void DisplayDashboardAppError(const std::string& str);
         void DisplayInitialSetupNotification();
         void SetOverlayInputEnabled(bool is_enabled);
@@ -166,6 +172,7 @@ class UIManager
         UITexspaceID GetTexspaceIDForOverlayHandle(vr::VROverlayHandle_t overlay_handle) const;
 
         void HandleOverlayProfileLoadMessage(LPARAM lparam);
+        void InitUIIntersectionMaskChannel();
 
     public:
         static UIManager* Get();
@@ -208,7 +215,7 @@ class UIManager
         vr::VROverlayHandle_t GetOverlayHandleSystemUI()           const;
         std::array<vr::VROverlayHandle_t, 6> GetUIOverlayHandles() const;
         bool IsDummyOverlayTransformUnstable() const;
-        void SendUIIntersectionMaskToDashboardApp(std::vector<vr::VROverlayIntersectionMaskPrimitive_t>& primitives) const;
+        void SendUIIntersectionMaskToDashboardApp(std::vector<vr::VROverlayIntersectionMaskPrimitive_t>& primitives);
 
         IdleState& GetIdleState();
         DPRect CalcRectForActiveTexspace();
@@ -6,6 +6,7 @@
 #include "Util.h"
 #include "Ini.h"
 #include "DPBrowserAPIClient.h"
+#include "OverlayStateMirror.h"
 
 #include "imgui_internal.h"
 #include "imgui_impl_win32_openvr.h"
@@ -745,7 +746,7 @@ void VRKeyboard::OnImGuiNewFrame()
             else if (assigned_id >= 0)  //else do it if the assigned overlay is invisible
             {
                 vr::VROverlayHandle_t ovrl_handle_assigned = OverlayManager::Get().GetConfigData((unsigned int)assigned_id).ConfigHandle[configid_handle_overlay_state_overlay_handle];
-                do_assign_to_ui = !vr::VROverlay()->IsOverlayVisible(ovrl_handle_assigned);
+                do_assign_to_ui = !OverlayStateMirror::Get().IsOverlayVisible(ovrl_handle_assigned);
             }
 
             if (do_assign_to_ui)
@@ -0,0 +1,217 @@
+#include "VirtualList.h"
+
+void VirtualList::UpdateSelectedIndex()
+{
+    m_SelectedIndex = (m_HasSelection) ? FindRowIndex(m_SelectedID) : -1;
+}
+
+void VirtualList::Clear()
+{
+    m_Rows.clear();
+    m_SelectedIndex = -1;
+}
+
+void VirtualList::AddRow(uint64_t id, const std::string& label, int icon_id)
+{
+    VirtualListRow row;
+    row.ID     = id;
+    row.Label  = label;
+    row.IconID = icon_id;
+
+    if ( (m_HasSelection) && (m_SelectedIndex == -1) && (id == m_SelectedID) )
+    {
+        m_SelectedIndex = (int)m_Rows.size();
+    }
+
+    m_Rows.push_back(std::move(row));
+}
+
+int VirtualList::GetRowCount() const
+{
+    return (int)m_Rows.size();
+}
+
+const VirtualListRow& VirtualList::GetRow(int index) const
+{
+    return m_Rows[index];
+}
+
+int VirtualList::FindRowIndex(uint64_t id) const
+{
+    for (int i = 0; i < (int)m_Rows.size(); ++i)
+    {
+        if (m_Rows[i].ID == id)
+            return i;
+    }
+
+    return -1;
+}
+
+void VirtualList::SetIconLookupFunction(IconLookupFunc func)
+{
+    m_IconLookupFunc = func;
+}
+
+void VirtualList::SetSourceRevision(unsigned int revision)
+{
+    m_SourceRevision = revision;
+    m_HasSourceRevision = true;
+}
+
+unsigned int VirtualList::GetSourceRevision() const
+{
+    return m_SourceRevision;
+}
+
+bool VirtualList::HasSourceRevision() const
+{
+    return m_HasSourceRevision;
+}
+
+void VirtualList::SetSelectedID(uint64_t id)
+{
+    //Only look up the row when something changed, so this is cheap to call every frame
+    if ( (m_HasSelection) && (m_SelectedID == id) )
+        return;
+
+    m_SelectedID   = id;
+    m_HasSelection = true;
+    UpdateSelectedIndex();
+}
+
+void VirtualList::ClearSelection()
+{
+    m_HasSelection  = false;
+    m_SelectedIndex = -1;
+}
+
+bool VirtualList::HasSelection() const
+{
+    return m_HasSelection;
+}
+
+uint64_t VirtualList::GetSelectedID() const
+{
+    return m_SelectedID;
+}
+
+int VirtualList::GetSelectedIndex() const
+{
+    return m_SelectedIndex;
+}
+
+void VirtualList::ScrollToSelection()
+{
+    m_IsScrollToSelectionPending = true;
+}
+
+void VirtualList::FocusSelection()
+{
+    m_IsFocusSelectionPending = true;
+}
+
+int VirtualList::Draw()
+{
+    int clicked_index = -1;
+
+    BeginDraw();
+    while (Step())
+    {
+        for (int i = GetDisplayStart(); i < GetDisplayEnd(); ++i)
+        {
+            if (DrawRow(i))
+            {
+                clicked_index = i;
+            }
+        }
+    }
+
+    return clicked_index;
+}
+
+void VirtualList::BeginDraw()
+{
+    m_DoubleClickedIndex = -1;
+    m_Clipper.Begin((int)m_Rows.size());
+
+    //Selected row needs to be submitted to be able to scroll to or focus it
+    if ( ((m_IsScrollToSelectionPending) || (m_IsFocusSelectionPending)) && (m_SelectedIndex != -1) )
+    {
+        m_Clipper.IncludeItemByIndex(m_SelectedIndex);
+    }
+}
+
+bool VirtualList::Step()
+{
+    return m_Clipper.Step();
+}
+
+int VirtualList::GetDisplayStart() const
+{
+    return m_Clipper.DisplayStart;
+}
+
+int VirtualList::GetDisplayEnd() const
+{
+    return m_Clipper.DisplayEnd;
+}
+
+bool VirtualList::DrawRow(int index)
+{
+    const VirtualListRow& row = m_Rows[index];
+    const bool is_selected = (index == m_SelectedIndex);
+    bool is_clicked = false;
+
+    ImGui::PushID((void*)(uintptr_t)row.ID);
+
+    if ( (is_selected) && (m_IsFocusSelectionPending) )
+    {
+        ImGui::SetKeyboardFocusHere();
+        m_IsFocusSelectionPending = false;
+    }
+
+    //Icon and label are drawn after an empty selectable so the label is never treated as ID and the icon can be placed in front of it
+    if (ImGui::Selectable("", is_selected))
+    {
+        SetSelectedID(row.ID);
+        is_clicked = true;
+    }
+
+    //Selectable returns true on release, but double-clicks are only detectable on the mouse down frame
+    if ( (ImGui::IsItemClicked()) && (ImGui::IsMouseDoubleClicked(ImGuiMouseButton_Left)) )
+    {
+        m_DoubleClickedIndex = index;
+    }
+
+    if ( (is_selected) && (m_IsScrollToSelectionPending) )
+    {
+        ImGui::SetScrollHereY();
+
+        if (ImGui::IsItemVisible())
+        {
+            m_IsScrollToSelectionPending = false;
+        }
+    }
+
+    ImGui::SameLine(0.0f, 0.0f);
+
+    ImVec2 icon_uv_min, icon_uv_max;
+    if ( (row.IconID != -1) && (m_IconLookupFunc != nullptr) && (m_IconLookupFunc(row.IconID, icon_uv_min, icon_uv_max)) )
+    {
+        const float line_height = ImGui::GetTextLineHeight();
+
+        ImGui::Image(ImGui::GetIO().Fonts->TexID, {line_height, line_height}, icon_uv_min, icon_uv_max);
+        ImGui::SameLine(0.0f, ImGui::GetStyle().ItemInnerSpacing.x);
+    }
+
+    ImGui::TextUnformatted(row.Label.c_str());
+
+    ImGui::PopID();
+
+    return is_clicked;
+}
+
+int VirtualList::GetDoubleClickedIndex() const
+{
+    return m_DoubleClickedIndex;
+}
@@ -0,0 +1,79 @@
+//List of selectable rows with optional icons for pickers that can get long, like the window list
+//Only the visible rows are submitted to ImGui via ImGuiListClipper, so the per-frame cost doesn't depend on the amount of rows.
+//Rows are identified by a caller-provided ID which stays the same when the list is rebuilt, so selection, hover and navigation state survive that.
+//Anything that is expensive to get per row (labels, icon cache IDs) is meant to be resolved once when the rows are added and not every frame.
+//This only depends on Dear ImGui and works in a headless context as well.
+
+#pragma once
+
+#include "imgui.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct VirtualListRow
+{
+    uint64_t ID = 0;                                //Stable identity, also used as ImGui ID
+    std::string Label;
+    int IconID = -1;                                //Passed to the icon lookup function, -1 for no icon
+};
+
+class VirtualList
+{
+    public:
+        //Returns false if there's no icon to draw. Icons are expected to be in the font atlas texture
+        typedef bool (*IconLookupFunc)(int icon_id, ImVec2& uv_min, ImVec2& uv_max);
+
+    private:
+        std::vector<VirtualListRow> m_Rows;
+        IconLookupFunc m_IconLookupFunc = nullptr;
+        unsigned int m_SourceRevision = 0;
+        bool m_HasSourceRevision = false;           //False until the rows were built once, as an empty list can be up to date too
+
+        uint64_t m_SelectedID = 0;
+        int m_SelectedIndex = -1;                   //Cached index of the row with m_SelectedID
+        bool m_HasSelection = false;
+        bool m_IsScrollToSelectionPending = false;
+        bool m_IsFocusSelectionPending = false;
+        int m_DoubleClickedIndex = -1;              //Row double-clicked during the last draw
+
+        ImGuiListClipper m_Clipper;
+
+        void UpdateSelectedIndex();
+
+    public:
+        void Clear();
+        void AddRow(uint64_t id, const std::string& label, int icon_id = -1);
+        int GetRowCount() const;
+        const VirtualListRow& GetRow(int index) const;
+        int FindRowIndex(uint64_t id) const;        //Returns -1 if not found
+
+        void SetIconLookupFunction(IconLookupFunc func);
+        //Revision of the data the rows were built from, for callers to check if a rebuild is needed. Not used by the list itself
+        void SetSourceRevision(unsigned int revision);
+        unsigned int GetSourceRevision() const;
+        bool HasSourceRevision() const;
+
+        //Selection is kept by ID and stays even when no row with that ID exists (yet)
+        void SetSelectedID(uint64_t id);
+        void ClearSelection();
+        bool HasSelection() const;
+        uint64_t GetSelectedID() const;
+        int GetSelectedIndex() const;               //Returns -1 if there's no selection or the selected ID isn't in the list
+        //Applied during the next draw of the selected row, which is never clipped while either is pending
+        void ScrollToSelection();
+        void FocusSelection();
+
+        //Draws all rows in the current window, ideally a scrolling child window. Returns index of the row clicked this frame or -1. Clicked rows get selected
+        int Draw();
+
+        //Same as Draw() but for per-row customization. Use like this: BeginDraw(); while (Step()) { for (i = GetDisplayStart(); i < GetDisplayEnd(); ++i) { DrawRow(i); } }
+        void BeginDraw();
+        bool Step();
+        int GetDisplayStart() const;
+        int GetDisplayEnd() const;
+        bool DrawRow(int index);                    //Returns true if clicked
+        //Returns index of the row double-clicked during the last draw or -1. Rows report clicks on release, so this is usually set on a frame Draw() returns -1
+        int GetDoubleClickedIndex() const;
+};
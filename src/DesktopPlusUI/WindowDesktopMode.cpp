@@ -553,7 +553,7 @@ void WindowDesktopMode::UpdatePageAddWindowOverlay()
 
         ImGui::SameLine(0.0f, 0.0f);
 
-        int icon_id = TextureManager::Get().GetWindowIconCacheID(window_info.GetIcon());
+        int icon_id = TextureManager::Get().GetWindowIconCacheID(window_info);
 
         if (icon_id != -1)
         {
@@ -5,6 +5,7 @@
 #include "InterprocessMessaging.h"
 #include "Util.h"
 #include "OpenVRExt.h"
+#include "OverlayStateMirror.h"
 #include "UIManager.h"
 #include "OverlayManager.h"
 #include "WindowManager.h"
@@ -659,7 +660,7 @@ void WindowFloatingUIActionBar::ButtonActionKeyboard(const Action& action, const
         if (io.MouseDownDuration[ImGuiMouseButton_Left] > 3.0f)
         {
             //Unpin if dashboard overlay is available
-            if ( (UIManager::Get()->IsOpenVRLoaded()) && (vr::VROverlay()->IsOverlayVisible(UIManager::Get()->GetOverlayHandleDPlusDashboard())) )
+            if ( (UIManager::Get()->IsOpenVRLoaded()) && (OverlayStateMirror::Get().IsOverlayVisible(UIManager::Get()->GetOverlayHandleDPlusDashboard())) )
             {
                 keyboard_window.SetPinned(false);
             }
@@ -6,6 +6,7 @@
 #include "InterprocessMessaging.h"
 #include "Util.h"
 #include "OpenVRExt.h"
+#include "OverlayStateMirror.h"
 #include "UIManager.h"
 #include "OverlayManager.h"
 
@@ -54,7 +55,7 @@ void WindowKeyboard::UpdateVisibility()
     {
         const bool is_using_dashboard_state = (m_OverlayStateCurrentID == floating_window_ovrl_state_dashboard_tab);
 
-        if (is_using_dashboard_state != vr::VROverlay()->IsOverlayVisible(UIManager::Get()->GetOverlayHandleDPlusDashboard()))
+        if (is_using_dashboard_state != OverlayStateMirror::Get().IsOverlayVisible(UIManager::Get()->GetOverlayHandleDPlusDashboard()))
         {
             //Auto-visible keyboards don't persist between overlay state switches
             if (m_IsAutoVisible)
@@ -84,7 +85,7 @@ void WindowKeyboard::UpdateVisibility()
 
             if (ovrl_handle_assigned != vr::k_ulOverlayHandleInvalid)
             {
-                if (m_OverlayStateCurrent->IsVisible != vr::VROverlay()->IsOverlayVisible(ovrl_handle_assigned))
+                if (m_OverlayStateCurrent->IsVisible != OverlayStateMirror::Get().IsOverlayVisible(ovrl_handle_assigned))
                 {
                     (m_OverlayStateCurrent->IsVisible) ? Hide() : Show();
                 }
@@ -97,7 +98,7 @@ void WindowKeyboard::UpdateVisibility()
 
         if ((!m_OvrlVisible) && (m_OverlayStateCurrent->IsVisible))
         {
-            vr::VROverlay()->ShowOverlay(overlay_handle);
+            OverlayStateMirror::Get().ShowOverlay(overlay_handle);
             m_OvrlVisible = true;
 
             ConfigManager::SetValue(configid_bool_state_keyboard_visible, true);
@@ -106,7 +107,7 @@ void WindowKeyboard::UpdateVisibility()
 
         if ((m_OvrlVisible) && (!m_OverlayStateCurrent->IsVisible) && (m_Alpha == 0.0f))
         {
-            vr::VROverlay()->HideOverlay(overlay_handle);
+            OverlayStateMirror::Get().HideOverlay(overlay_handle);
             m_OvrlVisible = false;
 
             ConfigManager::SetValue(configid_bool_state_keyboard_visible, false);
@@ -125,7 +126,7 @@ void WindowKeyboard::UpdateVisibility()
                     matrix_m4 *= m_OverlayStateCurrent->Transform;
 
                     vr::HmdMatrix34_t matrix_ovr = matrix_m4.toOpenVR34();
-                    vr::VROverlay()->SetOverlayTransformAbsolute(GetOverlayHandle(), vr::TrackingUniverseStanding, &matrix_ovr);
+                    OverlayStateMirror::Get().SetOverlayTransformAbsolute(GetOverlayHandle(), vr::TrackingUniverseStanding, &matrix_ovr);
                     m_OverlayStateCurrent->TransformAbs = matrix_m4;
                 }
             }
@@ -137,19 +138,19 @@ void WindowKeyboard::UpdateVisibility()
                     Matrix4 matrix_m4 = UIManager::Get()->GetOverlayDragger().GetBaseOffsetMatrix(ovrl_origin_dplus_tab) * m_OverlayStateCurrent->Transform;
 
                     vr::HmdMatrix34_t matrix_ovr = matrix_m4.toOpenVR34();
-                    vr::VROverlay()->SetOverlayTransformAbsolute(overlay_handle, origin, &matrix_ovr);
+                    OverlayStateMirror::Get().SetOverlayTransformAbsolute(overlay_handle, origin, &matrix_ovr);
                     m_OverlayStateCurrent->TransformAbs = matrix_m4;
                 }
             }
             else if (!m_OverlayStateCurrent->IsPinned)                                      //Based on m_TransformUIOrigin (fallback when above not available and unpinned)
             {
-                if (!vr::VROverlay()->IsOverlayVisible(UIManager::Get()->GetOverlayHandleDPlusDashboard()))
+                if (!OverlayStateMirror::Get().IsOverlayVisible(UIManager::Get()->GetOverlayHandleDPlusDashboard()))
                 {
                     Matrix4 matrix_m4 = m_TransformUIOrigin;
                     matrix_m4 *= m_OverlayStateCurrent->Transform;
 
                     vr::HmdMatrix34_t matrix_ovr = matrix_m4.toOpenVR34();
-                    vr::VROverlay()->SetOverlayTransformAbsolute(GetOverlayHandle(), vr::TrackingUniverseStanding, &matrix_ovr);
+                    OverlayStateMirror::Get().SetOverlayTransformAbsolute(GetOverlayHandle(), vr::TrackingUniverseStanding, &matrix_ovr);
                     m_OverlayStateCurrent->TransformAbs = matrix_m4;
                 }
             }
@@ -1303,7 +1304,7 @@ void WindowKeyboard::RebaseTransform()
         vr::HmdMatrix34_t hmd_mat = {0};
         vr::TrackingUniverseOrigin universe_origin = vr::TrackingUniverseStanding;
 
-        vr::VROverlay()->GetOverlayTransformAbsolute(GetOverlayHandle(), &universe_origin, &hmd_mat);
+        OverlayStateMirror::Get().GetOverlayTransformAbsolute(GetOverlayHandle(), &universe_origin, &hmd_mat);
         Matrix4 mat_abs = hmd_mat;
         Matrix4 mat_origin_inverse;
 
@@ -1350,7 +1351,7 @@ void WindowKeyboard::ResetTransform(FloatingWindowOverlayStateID state_id)
 
     //If visible, pinned and dplus dashboard overlay not available, reset to transform useful outside of the dashboard
     if ( (state_id == m_OverlayStateCurrentID) && (overlay_state.IsVisible) && (overlay_state.IsPinned) && (UIManager::Get()->IsOpenVRLoaded()) && 
-         (!vr::VROverlay()->IsOverlayVisible(UIManager::Get()->GetOverlayHandleDPlusDashboard())) )
+         (!OverlayStateMirror::Get().IsOverlayVisible(UIManager::Get()->GetOverlayHandleDPlusDashboard())) )
     {
         //Get dashboard-similar transform and adjust it down a bit
         Matrix4 matrix_facing = vr::IVRSystemEx::ComputeHMDFacingTransform(1.15f);
@@ -1370,7 +1371,7 @@ void WindowKeyboard::ResetTransform(FloatingWindowOverlayStateID state_id)
 
         //Set transform directly as it may not be updated automatically
         vr::HmdMatrix34_t matrix_ovr = overlay_state.Transform.toOpenVR34();
-        vr::VROverlay()->SetOverlayTransformAbsolute(GetOverlayHandle(), vr::TrackingUniverseStanding, &matrix_ovr);
+        OverlayStateMirror::Get().SetOverlayTransformAbsolute(GetOverlayHandle(), vr::TrackingUniverseStanding, &matrix_ovr);
     }
 }
 
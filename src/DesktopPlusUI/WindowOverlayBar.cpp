@@ -5,6 +5,7 @@
 #include "InterprocessMessaging.h"
 #include "Util.h"
 #include "OpenVRExt.h"
+#include "OverlayStateMirror.h"
 #include "UIManager.h"
 #include "OverlayManager.h"
 #include "DesktopPlusWinRT.h"
@@ -671,14 +672,14 @@ void WindowOverlayBar::MenuAddOverlayButton(ImVec2 pos, bool is_item_active)
                 else //Shouldn't happen, but have some fallback
                 {
                     vr::HmdMatrix34_t transform;
-                    vr::VROverlay()->GetOverlayTransformAbsolute(UIManager::Get()->GetOverlayHandleOverlayBar(), &universe_origin, &transform);
+                    OverlayStateMirror::Get().GetOverlayTransformAbsolute(UIManager::Get()->GetOverlayHandleOverlayBar(), &universe_origin, &transform);
 
                     overlay_transform = transform;
                 }
 
                 //Get devices poses
                 vr::TrackedDevicePose_t poses[vr::k_unMaxTrackedDeviceCount];
-                vr::VRSystem()->GetDeviceToAbsoluteTrackingPose(universe_origin, vr::IVRSystemEx::GetTimeNowToPhotons(), poses, vr::k_unMaxTrackedDeviceCount);
+                TrackedPoseSnapshot::Get().GetPoses(poses, universe_origin);
 
                 if (poses[vr::k_unTrackedDeviceIndex_Hmd].bPoseIsValid)
                 {
@@ -820,7 +821,7 @@ void WindowOverlayBar::HideMenus()
     //Reset sort order if the overlay already isn't hovered anymore
     if ( (UIManager::Get()->IsOpenVRLoaded()) && (!ConfigManager::Get().IsLaserPointerTargetOverlay(UIManager::Get()->GetOverlayHandleOverlayBar())) )
     {
-        vr::VROverlay()->SetOverlaySortOrder(UIManager::Get()->GetOverlayHandleOverlayBar(), 0);
+        OverlayStateMirror::Get().SetOverlaySortOrder(UIManager::Get()->GetOverlayHandleOverlayBar(), 0);
     }
 }
 
@@ -3213,11 +3213,16 @@ void WindowOverlayProperties::UpdatePageGraphicsCaptureSource(bool only_restore_
     ImGui::Separator();
 
     //List windows
-    for (const auto& window_info : WindowManager::Get().WindowListGet())
+    TextureManager::Get().UpdateWindowVirtualList(m_CaptureSourceWindowList);
+    m_CaptureSourceWindowList.SetSelectedID((uint64_t)winrt_selected_window);
+
+    if (m_CaptureSourceWindowList.Draw() != -1)
     {
-        ImGui::PushID(window_info.GetWindowHandle());
-        if (ImGui::Selectable("", (winrt_selected_window == window_info.GetWindowHandle())))
+        const WindowInfo* window_info_ptr = WindowManager::Get().WindowListFindWindow((HWND)m_CaptureSourceWindowList.GetSelectedID());
+
+        if (window_info_ptr != nullptr)
         {
+            const WindowInfo& window_info = *window_info_ptr;
             has_selection_changed = (winrt_selected_window != window_info.GetWindowHandle());
 
             winrt_selected_desktop = -2;
@@ -3236,27 +3241,11 @@ void WindowOverlayProperties::UpdatePageGraphicsCaptureSource(bool only_restore_
 
             UIManager::Get()->RepeatFrame();
         }
+    }
 
-        if ((!has_selection_changed) && (ImGui::IsItemClicked()) && (ImGui::IsMouseDoubleClicked(ImGuiMouseButton_Left)))
-        {
-            is_entry_double_clicked = true;
-        }
-
-        ImGui::SameLine(0.0f, 0.0f);
-
-        int icon_id = TextureManager::Get().GetWindowIconCacheID(window_info.GetIcon());
-
-        if (icon_id != -1)
-        {
-            TextureManager::Get().GetWindowIconTextureInfo(icon_id, img_size, img_uv_min, img_uv_max);
-            ImGui::Image(ImGui::GetIO().Fonts->TexID, img_size_line_height, img_uv_min, img_uv_max);
-
-            ImGui::SameLine(0.0f, style.ItemInnerSpacing.x);
-        }
-
-        ImGui::TextUnformatted(window_info.GetListTitle().c_str());
-
-        ImGui::PopID();
+    if ((!has_selection_changed) && (m_CaptureSourceWindowList.GetDoubleClickedIndex() != -1))
+    {
+        is_entry_double_clicked = true;
     }
 
     ImGui::EndChild();
@@ -2,6 +2,7 @@
 
 #include "FloatingWindow.h"
 #include "WindowDesktopMode.h"
+#include "VirtualList.h"
 
 enum WindowOverlayPropertiesPage
 {
@@ -49,6 +50,7 @@ class WindowOverlayProperties : public FloatingWindow, public FloatingWindowDesk
         char m_BufferOverlayName[1024];
         char m_BufferOverlayTags[1024];
         bool m_IsBrowserURLChanged;
+        VirtualList m_CaptureSourceWindowList;
 
         //Struct of cached sizes which may change at any time on translation or DPI switching (only the ones that aren't updated unconditionally)
         struct
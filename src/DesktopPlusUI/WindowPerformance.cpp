@@ -9,6 +9,7 @@
 #include "InterprocessMessaging.h"
 #include "Util.h"
 #include "OpenVRExt.h"
+#include "OverlayStateMirror.h"
 #include "UIManager.h"
 #include "OverlayManager.h"
 
@@ -1754,7 +1755,7 @@ void WindowPerformance::OnWindowBoundsChanged()
             if (ovrl_handle != vr::k_ulOverlayHandleInvalid)
             {
                 vr::VROverlay()->SetOverlayIntersectionMask(ovrl_handle, &intersection_mask, 1);
-                vr::VROverlay()->SetOverlayTextureBounds(ovrl_handle, &bounds);
+                OverlayStateMirror::Get().SetOverlayTextureBounds(ovrl_handle, &bounds);
             }
         }
     }
@@ -1872,7 +1873,7 @@ bool WindowPerformance::IsAnyOverlayUsingPerformanceMonitor()
         {
             vr::VROverlayHandle_t ovrl_handle = data.ConfigHandle[configid_handle_overlay_state_overlay_handle];
 
-            if ( (ovrl_handle != vr::k_ulOverlayHandleInvalid) && (vr::VROverlay()->IsOverlayVisible(ovrl_handle)) )
+            if ( (ovrl_handle != vr::k_ulOverlayHandleInvalid) && (OverlayStateMirror::Get().IsOverlayVisible(ovrl_handle)) )
             {
                 return true;
             }
@@ -3517,12 +3517,20 @@ void WindowSettings::UpdatePageAppProfiles()
     const bool is_any_app_profile_active = !app_profiles.GetActiveProfileAppKey().empty();
     const AppProfile& app_profile_active = app_profiles.GetProfile(app_profiles.GetActiveProfileAppKey());
 
-    //Use list clipper to minimize GetProfile() lookups
-    ImGuiListClipper list_clipper;
-    list_clipper.Begin((int)m_AppList.size());
-    while (list_clipper.Step())
+    if (list_id != -1)
+    {
+        m_AppListView.SetSelectedID(m_AppListView.GetRow(list_id).ID);
+    }
+    else
+    {
+        m_AppListView.ClearSelection();
+    }
+
+    //Only visible rows are drawn to minimize GetProfile() lookups
+    m_AppListView.BeginDraw();
+    while (m_AppListView.Step())
     {
-        for (int i = list_clipper.DisplayStart; i < list_clipper.DisplayEnd; ++i)
+        for (int i = m_AppListView.GetDisplayStart(); i < m_AppListView.GetDisplayEnd(); ++i)
         {
             const AppProfile& app_profile = app_profiles.GetProfile(m_AppList[i].first);
             const bool is_active_profile = ((is_any_app_profile_active) && (&app_profile == &app_profile_active));
@@ -3533,8 +3541,7 @@ void WindowSettings::UpdatePageAppProfiles()
             if (is_active_profile)
                 ImGui::PushStyleColor(ImGuiCol_Text, Style_ImGuiCol_TextNotification);
 
-            ImGui::PushID(i);
-            if (ImGui::Selectable(m_AppList[i].second.c_str(), (i == list_id)))
+            if (m_AppListView.DrawRow(i))
             {
                 list_id = i;
                 app_profile_selected_edit = app_profile;
@@ -3543,7 +3550,6 @@ void WindowSettings::UpdatePageAppProfiles()
                 delete_disabled = !app_profiles.ProfileExists(m_AppList[i].first);
                 focus_app_section = ImGui::GetIO().NavVisible;
             }
-            ImGui::PopID();
 
             if (is_active_profile)
                 ImGui::PopStyleColor();
@@ -5343,24 +5349,27 @@ void WindowSettings::UpdatePageActionPicker()
 {
     ImGuiStyle& style = ImGui::GetStyle();
 
-    static ActionUID list_uid = k_ActionUID_Invalid;
     static bool is_nav_focus_entry_pending = false;    //Focus has to be delayed until after the page animation is done
-    static bool scroll_to_selection = false;
 
     if (m_PageAppearing == wndsettings_page_action_picker)
     {
-        //Load action list
+        //Load action list, with the no action entry first
         m_ActionList = ConfigManager::Get().GetActionManager().GetActionNameList();
 
-        list_uid = m_ActionPickerUID;
-        scroll_to_selection = true;
-        is_nav_focus_entry_pending = ImGui::GetIO().NavVisible;
+        m_ActionPickerList.Clear();
+        m_ActionPickerList.AddRow(k_ActionUID_Invalid, TranslationManager::GetString(tstr_ActionNone));
 
-        //Set to invalid if selection doesn't exist
-        if (!ConfigManager::Get().GetActionManager().ActionExists(list_uid))
+        for (const auto& entry : m_ActionList)
         {
-            list_uid = k_ActionUID_Invalid;
+            m_ActionPickerList.AddRow(entry.UID, entry.Name);
         }
+
+        //Select no action entry if selection doesn't exist
+        const bool selection_exists = ConfigManager::Get().GetActionManager().ActionExists(m_ActionPickerUID);
+        m_ActionPickerList.SetSelectedID((selection_exists) ? m_ActionPickerUID : k_ActionUID_Invalid);
+        m_ActionPickerList.ScrollToSelection();
+
+        is_nav_focus_entry_pending = ImGui::GetIO().NavVisible;
     }
 
     ImGui::TextColoredUnformatted(ImGui::GetStyleColorVec4(ImGuiCol_ButtonHovered), TranslationManager::GetString(tstr_DialogActionPickerHeader)); 
@@ -5372,67 +5381,18 @@ void WindowSettings::UpdatePageActionPicker()
     const float item_count = (UIManager::Get()->IsInDesktopMode()) ? 22.0f : 15.0f;
     ImGui::BeginChild("ActionPickerList", ImVec2(0.0f, (item_height * item_count) + inner_padding - m_WarningHeight), true);
 
-    //No Action entry
+    if ( (is_nav_focus_entry_pending) && (m_PageAnimationDir == 0) )
     {
-        ImGui::PushID(0);
-
-        if ( (is_nav_focus_entry_pending) && (m_PageAnimationDir == 0) && (list_uid == k_ActionUID_Invalid) )
-        {
-            ImGui::SetKeyboardFocusHere();
-            is_nav_focus_entry_pending = false;
-        }
-
-        if (ImGui::Selectable(TranslationManager::GetString(tstr_ActionNone), (list_uid == k_ActionUID_Invalid) ))
-        {
-            list_uid = k_ActionUID_Invalid;
-            m_ActionPickerUID = k_ActionUID_Invalid;
-
-            PageGoBack();
-        }
-
-        if ( (scroll_to_selection) && (list_uid == k_ActionUID_Invalid) )
-        {
-            ImGui::SetScrollHereY();
-
-            if (ImGui::IsItemVisible())
-            {
-                scroll_to_selection = false;
-            }
-        }
-
-        ImGui::PopID();
+        m_ActionPickerList.FocusSelection();
+        is_nav_focus_entry_pending = false;
     }
 
     //List actions
-    for (const auto& entry : m_ActionList)
+    if (m_ActionPickerList.Draw() != -1)
     {
-        ImGui::PushID((void*)entry.UID);
-
-        if ( (is_nav_focus_entry_pending) && (m_PageAnimationDir == 0) && (entry.UID == list_uid) )
-        {
-            ImGui::SetKeyboardFocusHere();
-            is_nav_focus_entry_pending = false;
-        }
-
-        if (ImGui::Selectable(entry.Name.c_str(), (entry.UID == list_uid) ))
-        {
-            list_uid = entry.UID;
-            m_ActionPickerUID = entry.UID;
-
-            PageGoBack();
-        }
-
-        if ( (scroll_to_selection) && (entry.UID == list_uid) )
-        {
-            ImGui::SetScrollHereY();
-
-            if (ImGui::IsItemVisible())
-            {
-                scroll_to_selection = false;
-            }
-        }
+        m_ActionPickerUID = m_ActionPickerList.GetSelectedID();
 
-        ImGui::PopID();
+        PageGoBack();
     }
 
     ImGui::EndChild();
@@ -5886,16 +5846,10 @@ void WindowSettings::UpdatePageWindowPicker()
 {
     ImGuiStyle& style = ImGui::GetStyle();
 
-    static HWND list_hwnd = nullptr;
-    static bool is_nav_focus_entry_pending = false;    //Focus has to be delayed until after the page animation is done
-    static bool scroll_to_selection = false;
-    static ImVec2 no_actions_text_size;
-
-    if (m_PageAppearing == wndsettings_page_action_picker)
+    if (m_PageAppearing == wndsettings_page_window_picker)
     {
-        is_nav_focus_entry_pending = m_WindowPickerHWND;
-        scroll_to_selection = true;
-        is_nav_focus_entry_pending = ImGui::GetIO().NavVisible;
+        m_WindowPickerList.SetSelectedID((uint64_t)m_WindowPickerHWND);
+        m_WindowPickerList.ScrollToSelection();
     }
 
     ImGui::TextColoredUnformatted(ImGui::GetStyleColorVec4(ImGuiCol_ButtonHovered), TranslationManager::GetString(tstr_DialogWindowPickerHeader)); 
@@ -5908,46 +5862,13 @@ void WindowSettings::UpdatePageWindowPicker()
     ImGui::BeginChild("WindowPickerList", ImVec2(0.0f, (item_height * item_count) + inner_padding - m_WarningHeight), true);
 
     //List windows
-    ImVec2 img_size_line_height = {ImGui::GetTextLineHeight(), ImGui::GetTextLineHeight()};
-    ImVec2 img_size, img_uv_min, img_uv_max;
-    const ImVec2 combo_pos = ImGui::GetCursorScreenPos();
+    TextureManager::Get().UpdateWindowVirtualList(m_WindowPickerList);
 
-    for (const auto& window_info : WindowManager::Get().WindowListGet())
+    if (m_WindowPickerList.Draw() != -1)
     {
-        ImGui::PushID(window_info.GetWindowHandle());
-        if (ImGui::Selectable("", (list_hwnd == window_info.GetWindowHandle()) ))
-        {
-            list_hwnd = window_info.GetWindowHandle();
-            m_WindowPickerHWND = list_hwnd;
-
-            PageGoBack();
-        }
+        m_WindowPickerHWND = (HWND)m_WindowPickerList.GetSelectedID();
 
-        if ( (scroll_to_selection) && (list_hwnd == window_info.GetWindowHandle()) )
-        {
-            ImGui::SetScrollHereY();
-
-            if (ImGui::IsItemVisible())
-            {
-                scroll_to_selection = false;
-            }
-        }
-
-        ImGui::SameLine(0.0f, 0.0f);
-
-        int icon_id = TextureManager::Get().GetWindowIconCacheID(window_info.GetIcon());
-
-        if (icon_id != -1)
-        {
-            TextureManager::Get().GetWindowIconTextureInfo(icon_id, img_size, img_uv_min, img_uv_max);
-            ImGui::Image(ImGui::GetIO().Fonts->TexID, img_size_line_height, img_uv_min, img_uv_max);
-
-            ImGui::SameLine(0.0f, style.ItemInnerSpacing.x);
-        }
-
-        ImGui::TextUnformatted(window_info.GetListTitle().c_str());
-
-        ImGui::PopID();
+        PageGoBack();
     }
 
     ImGui::EndChild();
@@ -6294,15 +6215,16 @@ void WindowSettings::RefreshAppList()
 {
     m_AppList.clear();
 
-    //Each section is sorted alphabetically before being appended to the app list (via Win32, so UTF-16 needed)
+    //Each section is sorted alphabetically before being appended to the app list
+    //Sort keys are created once per entry (via Win32, so UTF-16 needed) so the comparisons themselves are cheap
     struct app_sublist_entry
     {
         std::string app_key;
         std::string app_name_utf8;
-        std::wstring app_name_utf16;
+        std::string app_name_sort_key;
     };
     std::vector<app_sublist_entry> app_sublist;
-    auto app_sublist_compare = [](app_sublist_entry& a, app_sublist_entry& b) { return WStringCompareNatural(a.app_name_utf16, b.app_name_utf16); };
+    auto app_sublist_compare = [](const app_sublist_entry& a, const app_sublist_entry& b) { return (a.app_name_sort_key < b.app_name_sort_key); };
 
     std::unordered_set<std::string> unique_app_keys;
     char app_key_buffer[vr::k_unMaxApplicationKeyLength] = "";
@@ -6368,7 +6290,7 @@ void WindowSettings::RefreshAppList()
             }
 
             unique_app_keys.insert(app_key);
-            app_sublist.push_back( {app_key, app_name, WStringConvertFromUTF8(app_name.c_str())} );
+            app_sublist.push_back( {app_key, app_name, WStringGetSortKeyNatural(WStringConvertFromUTF8(app_name.c_str()))} );
         }
     }
 
@@ -6416,7 +6338,7 @@ void WindowSettings::RefreshAppList()
                         }
 
                         unique_app_keys.insert(app_key);
-                        app_sublist.push_back( {app_key, app_name, WStringConvertFromUTF8(app_name.c_str())} );
+                        app_sublist.push_back( {app_key, app_name, WStringGetSortKeyNatural(WStringConvertFromUTF8(app_name.c_str()))} );
                     }
                 }
             }
@@ -6430,4 +6352,12 @@ void WindowSettings::RefreshAppList()
             m_AppList.emplace_back(app.app_key, app.app_name_utf8);
         }
     }
+
+    //Rows are identified by app key so selection doesn't depend on the list order
+    m_AppListView.Clear();
+
+    for (const auto& app : m_AppList)
+    {
+        m_AppListView.AddRow(std::hash<std::string>()(app.first), app.second);
+    }
 }
@@ -2,6 +2,7 @@
 
 #include "FloatingWindow.h"
 #include "WindowDesktopMode.h"
+#include "VirtualList.h"
 
 enum WindowSettingsPage
 {
@@ -72,6 +73,9 @@ class WindowSettings : public FloatingWindow, public FloatingWindowDesktopModeIn
         HWND m_WindowPickerHWND;
 
         std::vector< std::pair<std::string, std::string> > m_AppList;   //app key, app name
+        VirtualList m_AppListView;                                      //Rows for m_AppList, in the same order
+        VirtualList m_ActionPickerList;
+        VirtualList m_WindowPickerList;
 
         //Struct of cached sizes which may change at any time on translation or DPI switching (only the ones that aren't updated unconditionally)
         struct
@@ -0,0 +1,127 @@
+#ifndef DPLUSWINRT_STUB
+
+#include "CommonHeaders.h"
+#include "CaptureDevicePool.h"
+
+#include "openvr.h"
+
+namespace winrt
+{
+    using namespace Windows::Graphics::DirectX::Direct3D11;
+}
+
+CaptureDevicePool& CaptureDevicePool::Get()
+{
+    static CaptureDevicePool instance;
+    return instance;
+}
+
+winrt::IDirect3DDevice CaptureDevicePool::Acquire()
+{
+    //Get the adapter recommended by OpenVR
+    winrt::com_ptr<IDXGIFactory1> factory_ptr;
+    winrt::com_ptr<IDXGIAdapter> adapter_ptr_vr;
+    LUID adapter_luid = {0, 0};
+    int32_t vr_gpu_id;
+    vr::VRSystem()->GetDXGIOutputInfo(&vr_gpu_id);
+
+    HRESULT hr = CreateDXGIFactory1(__uuidof(IDXGIFactory1), factory_ptr.put_void());
+    if (!FAILED(hr))
+    {
+        winrt::com_ptr<IDXGIAdapter> adapter_ptr;
+        UINT i = 0;
+
+        while (factory_ptr->EnumAdapters(i, adapter_ptr.put()) != DXGI_ERROR_NOT_FOUND)
+        {
+            if (i == vr_gpu_id)
+            {
+                adapter_ptr_vr = adapter_ptr;
+
+                DXGI_ADAPTER_DESC adapter_desc;
+                if (SUCCEEDED(adapter_ptr_vr->GetDesc(&adapter_desc)))
+                {
+                    adapter_luid = adapter_desc.AdapterLuid;
+                }
+                break;
+            }
+
+            adapter_ptr = nullptr;
+            ++i;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    auto it = std::find_if(m_Devices.begin(), m_Devices.end(),
+                           [&](const auto& entry){ return ( (entry.AdapterLUID.LowPart == adapter_luid.LowPart) && (entry.AdapterLUID.HighPart == adapter_luid.HighPart) ); });
+
+    if (it != m_Devices.end())
+    {
+        it->RefCount++;
+        return it->Device;
+    }
+
+    DeviceEntry entry;
+    entry.AdapterLUID = adapter_luid;
+    entry.Device      = CreateDevice(adapter_ptr_vr.get());
+    entry.RefCount    = 1;
+
+    m_Devices.push_back(entry);
+
+    return entry.Device;
+}
+
+void CaptureDevicePool::Release(winrt::IDirect3DDevice const& device)
+{
+    if (device == nullptr)
+        return;
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    auto it = std::find_if(m_Devices.begin(), m_Devices.end(), [&](const auto& entry){ return (entry.Device == device); });
+
+    if (it != m_Devices.end())
+    {
+        it->RefCount--;
+
+        //Drop the pool's reference once no session uses the device anymore. It's destroyed when the last caller reference is gone as well
+        if (it->RefCount == 0)
+        {
+            m_Devices.erase(it);
+        }
+    }
+}
+
+winrt::IDirect3DDevice CaptureDevicePool::CreateDevice(IDXGIAdapter* adapter_ptr)
+{
+    winrt::com_ptr<ID3D11Device> d3d_device;
+
+    if (adapter_ptr != nullptr)
+    {
+        D3D11CreateDevice(adapter_ptr, D3D_DRIVER_TYPE_UNKNOWN, nullptr, D3D11_CREATE_DEVICE_BGRA_SUPPORT, nullptr, 0, D3D11_SDK_VERSION, d3d_device.put(), nullptr, nullptr);
+    }
+
+    if (d3d_device == nullptr)   //Try something else, but it probably won't work either
+    {
+        HRESULT hr = D3D11CreateDevice(nullptr, D3D_DRIVER_TYPE_HARDWARE, nullptr, D3D11_CREATE_DEVICE_BGRA_SUPPORT, nullptr, 0, D3D11_SDK_VERSION, d3d_device.put(), nullptr, nullptr);
+        if (FAILED(hr))
+        {
+            hr = D3D11CreateDevice(nullptr, D3D_DRIVER_TYPE_WARP, nullptr, D3D11_CREATE_DEVICE_BGRA_SUPPORT, nullptr, 0, D3D11_SDK_VERSION, d3d_device.put(), nullptr, nullptr);
+        }
+    }
+
+    //Sessions on different capture threads use the immediate context of the same device
+    if (d3d_device != nullptr)
+    {
+        if (auto multithread = d3d_device.try_as<ID3D11Multithread>())
+        {
+            multithread->SetMultithreadProtected(TRUE);
+        }
+    }
+
+    //Get it as WinRT D3D11 device
+    auto dxgi_device = d3d_device.try_as<IDXGIDevice>();
+    return CreateDirect3DDevice(dxgi_device.get());
+}
+
+#endif //DPLUSWINRT_STUB
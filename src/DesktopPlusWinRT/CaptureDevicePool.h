@@ -0,0 +1,29 @@
+#pragma once
+
+#include <mutex>
+
+//Shares one D3D11 device per adapter between all capture sessions instead of creating one per capture
+//Devices are created with multithread protection enabled, as sessions on different capture threads use the same immediate context
+class CaptureDevicePool
+{
+    public:
+        static CaptureDevicePool& Get();
+
+        //Returns device for the adapter used by the VR system, creating it if needed. Each call needs to be paired with a call to Release()
+        winrt::Windows::Graphics::DirectX::Direct3D11::IDirect3DDevice Acquire();
+        void Release(winrt::Windows::Graphics::DirectX::Direct3D11::IDirect3DDevice const& device);
+
+    private:
+        struct DeviceEntry
+        {
+            LUID AdapterLUID = {0, 0};      //Zero for fallback devices not created on the VR system's adapter
+            winrt::Windows::Graphics::DirectX::Direct3D11::IDirect3DDevice Device { nullptr };
+            unsigned int RefCount = 0;
+        };
+
+        //- Protected by m_Mutex
+        std::mutex m_Mutex;
+        std::vector<DeviceEntry> m_Devices;
+
+        static winrt::Windows::Graphics::DirectX::Direct3D11::IDirect3DDevice CreateDevice(IDXGIAdapter* adapter_ptr);
+};
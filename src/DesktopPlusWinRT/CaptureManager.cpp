@@ -2,6 +2,7 @@
 
 #include "CommonHeaders.h"
 #include "CaptureManager.h"
+#include "CaptureDevicePool.h"
 
 #include "DesktopPlusWinRT.h"
 
@@ -22,55 +23,19 @@ namespace util
     using namespace desktop;
 }
 
-CaptureManager::CaptureManager(DPWinRTThreadData& thread_data, DWORD global_main_thread_id) : m_ThreadData(thread_data)
+CaptureManager::CaptureManager(DPWinRTSessionData& session_data, DWORD global_main_thread_id) : m_SessionData(session_data)
 {
     m_CaptureMainThread = winrt::DispatcherQueue::GetForCurrentThread();
     m_GlobalMainThreadID = global_main_thread_id;
     WINRT_VERIFY(m_CaptureMainThread != nullptr);
 
-    //Get the adapter recommended by OpenVR
-    winrt::com_ptr<ID3D11Device> d3d_device;
-    winrt::com_ptr<IDXGIFactory1> factory_ptr;
-    winrt::com_ptr<IDXGIAdapter> adapter_ptr_vr;
-    int32_t vr_gpu_id;
-    vr::VRSystem()->GetDXGIOutputInfo(&vr_gpu_id);  
-
-    HRESULT hr = CreateDXGIFactory1(__uuidof(IDXGIFactory1), factory_ptr.put_void());
-    if (!FAILED(hr))
-    {
-        winrt::com_ptr<IDXGIAdapter> adapter_ptr;
-        UINT i = 0;
-
-        while (factory_ptr->EnumAdapters(i, adapter_ptr.put()) != DXGI_ERROR_NOT_FOUND)
-        {
-            if (i == vr_gpu_id)
-            {
-                adapter_ptr_vr = adapter_ptr;
-                break;
-            }
-
-            adapter_ptr = nullptr;
-            ++i;
-        }
-    }
-
-    if (adapter_ptr_vr != nullptr)
-    {
-        hr = D3D11CreateDevice(adapter_ptr_vr.get(), D3D_DRIVER_TYPE_UNKNOWN, nullptr, D3D11_CREATE_DEVICE_BGRA_SUPPORT, nullptr, 0, D3D11_SDK_VERSION, d3d_device.put(), nullptr, nullptr);
-    }
-
-    if (d3d_device == nullptr)   //Try something else, but it probably won't work either
-    {
-        HRESULT hr = D3D11CreateDevice(nullptr, D3D_DRIVER_TYPE_HARDWARE, nullptr, D3D11_CREATE_DEVICE_BGRA_SUPPORT, nullptr, 0, D3D11_SDK_VERSION, d3d_device.put(), nullptr, nullptr);
-        if (FAILED(hr))
-        {
-            hr = D3D11CreateDevice(nullptr, D3D_DRIVER_TYPE_WARP, nullptr, D3D11_CREATE_DEVICE_BGRA_SUPPORT, nullptr, 0, D3D11_SDK_VERSION, d3d_device.put(), nullptr, nullptr);
-        }
-    }
+    m_Device = CaptureDevicePool::Get().Acquire();
+}
 
-    //Get it as WinRT D3D11 device
-    auto dxgi_device = d3d_device.try_as<IDXGIDevice>();
-    m_Device = CreateDirect3DDevice(dxgi_device.get());
+CaptureManager::~CaptureManager()
+{
+    StopCapture();
+    CaptureDevicePool::Get().Release(m_Device);
 }
 
 winrt::GraphicsCaptureItem CaptureManager::StartCaptureFromWindowHandle(HWND hwnd)
@@ -89,14 +54,14 @@ winrt::GraphicsCaptureItem CaptureManager::StartCaptureFromMonitorHandle(HMONITO
 
 void CaptureManager::StartCaptureFromItem(winrt::GraphicsCaptureItem item)
 {
-    m_Capture = std::make_unique<OverlayCapture>(m_Device, item, m_PixelFormat, m_GlobalMainThreadID, m_ThreadData.Overlays, m_ThreadData.SourceWindow);
+    m_Capture = std::make_unique<OverlayCapture>(m_Device, item, m_PixelFormat, m_GlobalMainThreadID, m_SessionData.Overlays, m_SessionData.SourceWindow);
 
     m_Capture->StartCapture();
     m_ItemClosedRevoker = item.Closed(winrt::auto_revoke, { this, &CaptureManager::OnCaptureItemClosed });
 
     //Check if all overlays of this capture are already paused and pause the capture as well then
     bool all_paused = true;
-    for (DPWinRTOverlayData& overlay_data : m_ThreadData.Overlays)
+    for (DPWinRTOverlayData& overlay_data : m_SessionData.Overlays)
     {
         if (!overlay_data.IsPaused)
         {
@@ -116,7 +81,7 @@ void CaptureManager::OnCaptureItemClosed(winrt::GraphicsCaptureItem const&, winr
     StopCapture();
 
     //Send overlay status updates
-    for (const auto& overlay : m_ThreadData.Overlays)
+    for (const auto& overlay : m_SessionData.Overlays)
     {
         ::PostThreadMessage(m_GlobalMainThreadID, WM_DPLUSWINRT_CAPTURE_LOST, overlay.Handle, 0);
     }
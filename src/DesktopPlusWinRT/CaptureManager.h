@@ -4,8 +4,8 @@
 class CaptureManager
 {
     public:
-        CaptureManager(DPWinRTThreadData& thread_data, DWORD global_main_thread_id);
-        ~CaptureManager() {}
+        CaptureManager(DPWinRTSessionData& session_data, DWORD global_main_thread_id);
+        ~CaptureManager();
 
         winrt::Windows::Graphics::Capture::GraphicsCaptureItem StartCaptureFromWindowHandle(HWND hwnd);
         winrt::Windows::Graphics::Capture::GraphicsCaptureItem StartCaptureFromMonitorHandle(HMONITOR hmon);
@@ -33,6 +33,6 @@ class CaptureManager
         winrt::Windows::Graphics::Capture::GraphicsCaptureItem::Closed_revoker m_ItemClosedRevoker;
         winrt::Windows::Graphics::DirectX::DirectXPixelFormat m_PixelFormat = winrt::Windows::Graphics::DirectX::DirectXPixelFormat::B8G8R8A8UIntNormalized;
 
-        DPWinRTThreadData& m_ThreadData;
+        DPWinRTSessionData& m_SessionData;
         DWORD m_GlobalMainThreadID;
 };
\ No newline at end of file
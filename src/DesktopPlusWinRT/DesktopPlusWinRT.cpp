@@ -5,6 +5,7 @@
 #pragma comment (lib, "windowsapp.lib")
 
 #include <mutex>
+#include <thread>
 #include <utility>
 #include <limits.h>
 
@@ -23,10 +24,14 @@
 static DWORD g_MainThreadID;
 static bool g_IsCaptureSupported;
 static int  g_APIContractPresent;
+static size_t g_ThreadPoolSizeMax;
 
 //- Protected by g_ThreadsMutex
 static std::mutex g_ThreadsMutex;
-static std::vector<DPWinRTThreadData> g_Threads;
+static std::vector<DPWinRTThreadData> g_Threads;        //Capture thread pool
+static std::vector<DPWinRTSessionData> g_Sessions;      //Capture sessions, each assigned to one of the pool's threads
+static unsigned int g_SessionIDNext = 1;
+static LPARAM g_AckIDNext = 1;                          //Passed with messages StopCapture() waits on, so their acknowledgement can be told apart from earlier ones
 
 //- Only accessed by main thread
 static bool g_IsCursorEnabled;
@@ -67,13 +72,39 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD  ul_reason_for_call, LPVOID lpReser
 
 DWORD WINAPI WinRTCaptureThreadEntry(_In_ void* Param);
 
-bool DPWinRT_Internal_StartCapture(vr::VROverlayHandle_t overlay_handle, const DPWinRTThreadData& data)
+//Returns index of the pool thread a new session should be assigned to, or g_Threads.size() if a new thread should be created for it
+//Sessions go to the least busy thread, with new threads only being created while all existing ones are busy and the pool isn't full yet
+//Should only be called when g_ThreadsMutex is locked
+size_t DPWinRT_Internal_PickThreadForNewSession()
 {
-    //Make sure this overlay handle is not already used by a thread
+    size_t thread_index = g_Threads.size();
+
+    for (size_t i = 0; i < g_Threads.size(); ++i)
+    {
+        //Skip threads that exited after an error. They're only removed once all their sessions were stopped
+        if (::WaitForSingleObject(g_Threads[i].ThreadHandle, 0) == WAIT_OBJECT_0)
+            continue;
+
+        if ( (thread_index == g_Threads.size()) || (g_Threads[i].SessionCount < g_Threads[thread_index].SessionCount) )
+        {
+            thread_index = i;
+        }
+    }
+
+    if ( (thread_index != g_Threads.size()) && (g_Threads[thread_index].SessionCount > 0) && (g_Threads.size() < g_ThreadPoolSizeMax) )
+    {
+        return g_Threads.size();
+    }
+
+    return thread_index;
+}
+
+bool DPWinRT_Internal_StartCapture(vr::VROverlayHandle_t overlay_handle, const DPWinRTSessionData& data)
+{
+    //Make sure this overlay handle is not already used by a session
     DPWinRT_StopCapture(overlay_handle);
 
-    HANDLE thread_handle = nullptr;
-    DWORD thread_id = 0;
+    bool post_failed = false;
 
     {
         std::lock_guard<std::mutex> lock(g_ThreadsMutex);
@@ -81,45 +112,57 @@ bool DPWinRT_Internal_StartCapture(vr::VROverlayHandle_t overlay_handle, const D
         DPWinRTOverlayData overlay_data;
         overlay_data.Handle = overlay_handle;
 
-        //Try to find a thread already capturing this item
-        for (auto& thread : g_Threads)
+        //Try to find a session already capturing this item
+        for (auto& session : g_Sessions)
         {
-            if ((thread.DesktopID == data.DesktopID) && (thread.SourceWindow == data.SourceWindow))
+            if ((session.DesktopID == data.DesktopID) && (session.SourceWindow == data.SourceWindow))
             {
-                thread.Overlays.push_back(overlay_data);
+                session.Overlays.push_back(overlay_data);
 
-                ::PostThreadMessage(thread.ThreadID, WM_DPLUSWINRT_UPDATE_DATA, 0, 0);
+                ::PostThreadMessage(session.ThreadID, WM_DPLUSWINRT_UPDATE_DATA, session.SessionID, 0);
                 return true;
             }
         }
 
-        //Create new thread if no existing one was found
-        g_Threads.push_back(data);
-        g_Threads.back().Overlays.push_back(overlay_data);
-        g_Threads.back().IsCursorEnabledInitial = g_IsCursorEnabled;
+        //Create new session on a pool thread, starting a new thread if needed
+        size_t thread_index = DPWinRT_Internal_PickThreadForNewSession();
 
-        //Thread may run before CreateThread() returns, but the thread will have to wait on the mutex so it's fine
-        thread_handle = ::CreateThread(nullptr, 0, WinRTCaptureThreadEntry, &g_Threads.back(), 0, &thread_id);
+        if (thread_index == g_Threads.size())
+        {
+            //The thread can't look at g_Threads before the mutex is unlocked, so adding its data after creating it is fine
+            DPWinRTThreadData thread_data;
+            thread_data.ThreadHandle = ::CreateThread(nullptr, 0, WinRTCaptureThreadEntry, nullptr, 0, &thread_data.ThreadID);
 
-        g_Threads.back().ThreadHandle = thread_handle;
-        g_Threads.back().ThreadID     = thread_id;
-    }
+            if (thread_data.ThreadHandle == nullptr)
+                return false;
 
-    if (thread_handle == nullptr)
-    {
-        return false;
-    }
+            g_Threads.push_back(thread_data);
+        }
 
-    //Wait for the thread's message queue to be ready to not risk any messages getting lost
-    BOOL is_ready = false;
+        DPWinRTThreadData& thread = g_Threads[thread_index];
+        thread.SessionCount++;
 
-    do
+        g_Sessions.push_back(data);
+        DPWinRTSessionData& session = g_Sessions.back();
+        session.SessionID = g_SessionIDNext++;
+        session.ThreadID  = thread.ThreadID;
+        session.Overlays.push_back(overlay_data);
+        session.IsCursorEnabledInitial = g_IsCursorEnabled;
+
+        //Threads that don't have a message queue yet start all their sessions once it exists, so there's no need to wait for them here
+        if (thread.IsReady)
+        {
+            post_failed = (::PostThreadMessage(thread.ThreadID, WM_DPLUSWINRT_SESSION_START, session.SessionID, 0) == 0);
+        }
+    }
+
+    if (post_failed)
     {
-        is_ready = ::PostThreadMessage(thread_id, WM_NULL, 0, 0);
-        ::Sleep(10);
+        DPWinRT_StopCapture(overlay_handle);
+        return false;
     }
-    while (is_ready == 0);
 
+    //Session start is asynchronous from here on, failures are reported via WM_DPLUSWINRT_CAPTURE_LOST
     return true;
 }
 
@@ -130,9 +173,8 @@ void DPWinRT_Init()
     #ifndef DPLUSWINRT_STUB
 
     g_MainThreadID = ::GetCurrentThreadId();
-    //Reserve thread data vector size to avoid potential race condition between resize and thread creation when many overlays are created back-to-back (while also avoiding explicit syncing there).
-    //100 should be pretty safe as a limit, considering k_unMaxOverlayCount (128) with system overlays and Desktop+ UI overlays... also 100 captures are insane either way
-    g_Threads.reserve(100);
+    //Captures mostly wait on the compositor and are cheap to process, so a few threads are enough for any number of them
+    g_ThreadPoolSizeMax = clamp(std::thread::hardware_concurrency() / 2, 1u, 4u);
 
     //Init results of capability query functions so we don't need an apartment on the main thread
     winrt::init_apartment(winrt::apartment_type::multi_threaded);
@@ -254,7 +296,7 @@ bool DPWinRT_IsMinUpdateIntervalPropertySupported()
 bool DPWinRT_StartCaptureFromHWND(vr::VROverlayHandle_t overlay_handle, HWND handle)
 {
     #ifndef DPLUSWINRT_STUB
-        DPWinRTThreadData data;
+        DPWinRTSessionData data;
         data.SourceWindow = handle;
 
         return DPWinRT_Internal_StartCapture(overlay_handle, data);
@@ -266,7 +308,7 @@ bool DPWinRT_StartCaptureFromHWND(vr::VROverlayHandle_t overlay_handle, HWND han
 bool DPWinRT_StartCaptureFromDesktop(vr::VROverlayHandle_t overlay_handle, int desktop_id)
 {
     #ifndef DPLUSWINRT_STUB
-        DPWinRTThreadData data;
+        DPWinRTSessionData data;
         data.DesktopID = desktop_id;
 
         return DPWinRT_Internal_StartCapture(overlay_handle, data);
@@ -279,26 +321,26 @@ bool DPWinRT_StartCaptureFromOverlay(vr::VROverlayHandle_t overlay_handle, vr::V
 {
     #ifndef DPLUSWINRT_STUB
 
-    //Make sure this overlay handle is not already used by a thread
+    //Make sure this overlay handle is not already used by a session
     DPWinRT_StopCapture(overlay_handle);
 
     {
         std::lock_guard<std::mutex> lock(g_ThreadsMutex);
 
-        //Find thread with the source overlay assigned and add the other overlay to it with duplicated state
+        //Find session with the source overlay assigned and add the other overlay to it with duplicated state
         //This means this function is only good for adding capture after an overlay was duplicated, otherwise some state needs to be adjusted right after
-        for (auto& thread : g_Threads)
+        for (auto& session : g_Sessions)
         {
-            auto it = std::find_if(thread.Overlays.begin(), thread.Overlays.end(), [&](const auto& data){ return (data.Handle == overlay_handle_source); });
+            auto it = std::find_if(session.Overlays.begin(), session.Overlays.end(), [&](const auto& data){ return (data.Handle == overlay_handle_source); });
 
-            if (it != thread.Overlays.end())
+            if (it != session.Overlays.end())
             {
                 DPWinRTOverlayData overlay_data = *it;
                 overlay_data.Handle = overlay_handle;
 
-                thread.Overlays.push_back(overlay_data);
+                session.Overlays.push_back(overlay_data);
 
-                ::PostThreadMessage(thread.ThreadID, WM_DPLUSWINRT_UPDATE_DATA, 0, 0);
+                ::PostThreadMessage(session.ThreadID, WM_DPLUSWINRT_UPDATE_DATA, session.SessionID, 0);
                 return true;
             }
         }
@@ -315,15 +357,15 @@ bool DPWinRT_PauseCapture(vr::VROverlayHandle_t overlay_handle, bool pause)
 
     std::lock_guard<std::mutex> lock(g_ThreadsMutex);
 
-    //Find thread with the overlay assigned and tell it to set pause state
-    for (auto& thread : g_Threads)
+    //Find session with the overlay assigned and tell its thread to set pause state
+    for (auto& session : g_Sessions)
     {
-        auto it = std::find_if(thread.Overlays.begin(), thread.Overlays.end(), [&](const auto& data){ return (data.Handle == overlay_handle); });
+        auto it = std::find_if(session.Overlays.begin(), session.Overlays.end(), [&](const auto& data){ return (data.Handle == overlay_handle); });
 
-        if (it != thread.Overlays.end())
+        if (it != session.Overlays.end())
         {
             it->IsPaused = pause;
-            ::PostThreadMessage(thread.ThreadID, WM_DPLUSWINRT_CAPTURE_PAUSE, overlay_handle, pause);
+            ::PostThreadMessage(session.ThreadID, WM_DPLUSWINRT_CAPTURE_PAUSE, overlay_handle, pause);
             return true;
         }
     }
@@ -337,54 +379,80 @@ bool DPWinRT_StopCapture(vr::VROverlayHandle_t overlay_handle)
 {
     #ifndef DPLUSWINRT_STUB
 
+    bool was_captured = false;
     bool wait_for_ack = false;
-    //Clear out existing WM_DPLUSWINRT_THREAD_ACK messages first just in case
-    MSG msg;
-    while (PeekMessage(&msg, nullptr, WM_DPLUSWINRT_THREAD_ACK, WM_DPLUSWINRT_THREAD_ACK, PM_REMOVE));
+    unsigned int ack_session_id = 0;
+    LPARAM ack_id = 0;
 
-    //Find thread with overlay and remove overlay from it
+    //Find session with overlay and remove overlay from it
     {
         std::lock_guard<std::mutex> lock(g_ThreadsMutex);
 
-        for (auto thread_it = g_Threads.begin(); thread_it != g_Threads.end(); ++thread_it)
+        for (auto session_it = g_Sessions.begin(); session_it != g_Sessions.end(); ++session_it)
         {
-            auto& thread = *thread_it;
-            auto it = std::find_if(thread.Overlays.begin(), thread.Overlays.end(), [&](const auto& data) { return (data.Handle == overlay_handle); });
+            auto& session = *session_it;
+            auto it = std::find_if(session.Overlays.begin(), session.Overlays.end(), [&](const auto& data) { return (data.Handle == overlay_handle); });
 
-            if (it != thread.Overlays.end())
+            if (it != session.Overlays.end())
             {
-                thread.Overlays.erase(it);
+                session.Overlays.erase(it);
+
+                auto thread_it = std::find_if(g_Threads.begin(), g_Threads.end(), [&](const auto& thread){ return (thread.ThreadID == session.ThreadID); });
+
+                //Threads without message queue haven't started any session yet, so there are no overlay updates to wait for
+                was_captured   = true;
+                wait_for_ack   = ( (thread_it != g_Threads.end()) && (thread_it->IsReady) );
+                ack_session_id = session.SessionID;
+                ack_id         = g_AckIDNext++;
 
-                if (thread.Overlays.empty()) //Quit and remove thread when no overlays left
+                if (session.Overlays.empty()) //Stop and remove session when no overlays left
                 {
-                    ::PostThreadMessage(thread.ThreadID, WM_DPLUSWINRT_THREAD_QUIT, 0, 0);
+                    ::PostThreadMessage(session.ThreadID, WM_DPLUSWINRT_SESSION_STOP, session.SessionID, ack_id);
 
-                    ::CloseHandle(thread.ThreadHandle);
-                    g_Threads.erase(thread_it);
+                    //Quit and remove thread if this was its last session
+                    if ( (thread_it != g_Threads.end()) && (--thread_it->SessionCount == 0) )
+                    {
+                        ::PostThreadMessage(thread_it->ThreadID, WM_DPLUSWINRT_THREAD_QUIT, 0, 0);
+
+                        ::CloseHandle(thread_it->ThreadHandle);
+                        g_Threads.erase(thread_it);
+                    }
+
+                    g_Sessions.erase(session_it);
                 }
                 else //otherwise, update data
                 {
-                    ::PostThreadMessage(thread.ThreadID, WM_DPLUSWINRT_UPDATE_DATA, 0, 0);
+                    ::PostThreadMessage(session.ThreadID, WM_DPLUSWINRT_UPDATE_DATA, session.SessionID, ack_id);
                 }
 
-                wait_for_ack = true;
                 break;
             }
         }
     }
 
-    //Wait for WM_DPLUSWINRT_THREAD_ACK so we can be sure there won't be any additional overlay updates after this function returns
+    //Wait for WM_DPLUSWINRT_THREAD_ACK of the session so we can be sure there won't be any additional overlay updates after this function returns
+    //Acknowledgements for other sessions or earlier messages are left over from calls that didn't wait for them and are dropped
     ULONGLONG start_tick = ::GetTickCount64();
+    MSG msg;
     while (wait_for_ack)
     {
-        if ( (PeekMessage(&msg, nullptr, WM_DPLUSWINRT_THREAD_ACK, WM_DPLUSWINRT_THREAD_ACK, PM_REMOVE)) || (::GetTickCount64() >= start_tick + 500) ) //On message or 500ms timeout
+        if (PeekMessage(&msg, nullptr, WM_DPLUSWINRT_THREAD_ACK, WM_DPLUSWINRT_THREAD_ACK, PM_REMOVE))
         {
-            return true;
+            if ( ((unsigned int)msg.wParam == ack_session_id) && (msg.lParam == ack_id) )
+                break;
+
+            continue;
         }
 
+        if (::GetTickCount64() >= start_tick + 500) //500ms timeout
+            break;
+
         ::Sleep(0);
     }
 
+    if (was_captured)
+        return true;
+
     //Release shared overlay texture if there is any and remove cached data
     vr::VROverlayEx()->ReleaseSharedOverlayTexture(overlay_handle);
 
@@ -399,12 +467,12 @@ bool DPWinRT_SetOverlayUpdateLimitDelay(vr::VROverlayHandle_t overlay_handle, LO
 
     std::lock_guard<std::mutex> lock(g_ThreadsMutex);
 
-    //Find thread with the overlay assigned and update the thread data
-    for (auto& thread : g_Threads)
+    //Find session with the overlay assigned and update the session data
+    for (auto& session : g_Sessions)
     {
-        auto it = std::find_if(thread.Overlays.begin(), thread.Overlays.end(), [&](const auto& data){ return (data.Handle == overlay_handle); });
+        auto it = std::find_if(session.Overlays.begin(), session.Overlays.end(), [&](const auto& data){ return (data.Handle == overlay_handle); });
 
-        if (it != thread.Overlays.end())
+        if (it != session.Overlays.end())
         {
             //If no change, back out
             if (it->UpdateLimiterDelay.QuadPart == delay_quadpart)
@@ -412,7 +480,7 @@ bool DPWinRT_SetOverlayUpdateLimitDelay(vr::VROverlayHandle_t overlay_handle, LO
 
             it->UpdateLimiterDelay.QuadPart = delay_quadpart;
 
-            ::PostThreadMessage(thread.ThreadID, WM_DPLUSWINRT_UPDATE_DATA, 0, 0);
+            ::PostThreadMessage(session.ThreadID, WM_DPLUSWINRT_UPDATE_DATA, session.SessionID, 0);
             return true;
         }
     }
@@ -428,12 +496,12 @@ bool DPWinRT_SetOverlayOverUnder3D(vr::VROverlayHandle_t overlay_handle, bool is
 
     std::lock_guard<std::mutex> lock(g_ThreadsMutex);
 
-    //Find thread with the overlay assigned and update the thread data
-    for (auto& thread : g_Threads)
+    //Find session with the overlay assigned and update the session data
+    for (auto& session : g_Sessions)
     {
-        auto it = std::find_if(thread.Overlays.begin(), thread.Overlays.end(), [&](const auto& data){ return (data.Handle == overlay_handle); });
+        auto it = std::find_if(session.Overlays.begin(), session.Overlays.end(), [&](const auto& data){ return (data.Handle == overlay_handle); });
 
-        if (it != thread.Overlays.end())
+        if (it != session.Overlays.end())
         {
             //If no change, back out
             if (it->IsOverUnder3D == is_over_under_3D)
@@ -451,7 +519,7 @@ bool DPWinRT_SetOverlayOverUnder3D(vr::VROverlayHandle_t overlay_handle, bool is
             it->OU3D_crop_width  = crop_width;
             it->OU3D_crop_height = crop_height;
 
-            ::PostThreadMessage(thread.ThreadID, WM_DPLUSWINRT_UPDATE_DATA, 0, 0);
+            ::PostThreadMessage(session.ThreadID, WM_DPLUSWINRT_UPDATE_DATA, session.SessionID, 0);
             return true;
         }
     }
@@ -475,6 +543,12 @@ void DPWinRT_SetCaptureCursorEnabled(bool is_cursor_enabled)
             ::PostThreadMessage(thread.ThreadID, WM_DPLUSWINRT_ENABLE_CURSOR, is_cursor_enabled, 0);
         }
 
+        //Sessions on threads that aren't ready yet miss the message, but pick up the initial state when they start
+        for (auto& session : g_Sessions)
+        {
+            session.IsCursorEnabledInitial = is_cursor_enabled;
+        }
+
         g_IsCursorEnabled = is_cursor_enabled;
     }
     #endif //DPLUSWINRT_STUB
@@ -511,6 +585,59 @@ void DPWinRT_SetDesktopEnumerationFlags(bool ignore_wmr_screens)
 
 #ifndef DPLUSWINRT_STUB
 
+//Capture session as held by its capture thread. CaptureManager and OverlayCapture reference the data, so it needs to stay at a stable address
+struct DPWinRTThreadLocalSession
+{
+    DPWinRTSessionData Data;
+    std::unique_ptr<CaptureManager> Manager;
+};
+
+void DPWinRT_Internal_StartSession(DPWinRTThreadLocalSession& session)
+{
+    const DPWinRTSessionData& data = session.Data;
+
+    session.Manager = std::make_unique<CaptureManager>(session.Data, g_MainThreadID);
+    session.Manager->PixelFormat( (g_IsHDREnabled) ? winrt::DirectXPixelFormat::R16G16B16A16Float : winrt::DirectXPixelFormat::B8G8R8A8UIntNormalized );
+
+    if (!DPWinRT_IsCaptureFromHandleSupported())
+        return;
+
+    //Start capture
+    if (data.SourceWindow != nullptr)
+    {
+        session.Manager->StartCaptureFromWindowHandle(data.SourceWindow);
+    }
+    else if (data.DesktopID != -2)
+    {
+        if (data.DesktopID != -1)
+        {
+            HMONITOR monitor_handle = nullptr;
+            GetDevmodeForDisplayID(data.DesktopID, g_DesktopEnumFlagIgnoreWMRScreens, &monitor_handle);
+
+            if (monitor_handle != nullptr)
+            {
+                session.Manager->StartCaptureFromMonitorHandle(monitor_handle);
+            }
+            else
+            {
+                //Failed to get monitor handle, drop the capture
+                for (const auto& overlay : data.Overlays)
+                {
+                    ::PostThreadMessage(g_MainThreadID, WM_DPLUSWINRT_CAPTURE_LOST, overlay.Handle, 0);
+                    //Session will be stopped by the response to the capture lost message
+                }
+            }
+        }
+        else if (DPWinRT_IsCaptureFromCombinedDesktopSupported())
+        {
+            session.Manager->StartCaptureFromMonitorHandle(nullptr);
+        }
+    }
+
+    //Set initial cursor enabled state
+    session.Manager->IsCursorEnabled(data.IsCursorEnabledInitial);
+}
+
 DWORD WINAPI WinRTCaptureThreadEntry(_In_ void* Param)
 {
     //The thread shouldn't have been created in the first place then, but exit if it really happens
@@ -519,14 +646,82 @@ DWORD WINAPI WinRTCaptureThreadEntry(_In_ void* Param)
         return 0;
     }
 
-    //Keep own copy of thread data
-    DPWinRTThreadData data;
+    const DWORD thread_id = ::GetCurrentThreadId();
+    std::vector< std::unique_ptr<DPWinRTThreadLocalSession> > sessions;
 
+    //Create the message queue, then mark the thread as ready and pick up the sessions assigned to it so far
+    //Messages posted before this point were lost, but the sessions' current data covers everything they would have changed
     {
+        MSG msg;
+        ::PeekMessage(&msg, nullptr, WM_USER, WM_USER, PM_NOREMOVE);
+
         std::lock_guard<std::mutex> lock(g_ThreadsMutex);
-        data = *(DPWinRTThreadData*)Param;
+
+        auto thread_it = std::find_if(g_Threads.begin(), g_Threads.end(), [&](const auto& thread){ return (thread.ThreadID == thread_id); });
+
+        //All sessions were already stopped again and the thread removed
+        if (thread_it == g_Threads.end())
+            return 0;
+
+        thread_it->IsReady = true;
+
+        for (const auto& session_data : g_Sessions)
+        {
+            if (session_data.ThreadID == thread_id)
+            {
+                sessions.push_back(std::make_unique<DPWinRTThreadLocalSession>());
+                sessions.back()->Data = session_data;
+            }
+        }
     }
 
+    auto find_session = [&](unsigned int session_id)
+    {
+        return std::find_if(sessions.begin(), sessions.end(), [&](const auto& session){ return (session->Data.SessionID == session_id); });
+    };
+
+    //Copies session data from the global list, returns false if it doesn't exist anymore
+    auto copy_session_data = [&](unsigned int session_id, DPWinRTSessionData& data)
+    {
+        std::lock_guard<std::mutex> lock(g_ThreadsMutex);
+
+        auto it = std::find_if(g_Sessions.begin(), g_Sessions.end(), [&](const auto& session){ return (session.SessionID == session_id); });
+
+        if (it != g_Sessions.end())
+        {
+            data = *it;
+            return true;
+        }
+
+        return false;
+    };
+
+    //Runs func for a single session. Unhandled WinRT exceptions from it only take down that session instead of all sessions on the thread (in release builds)
+    //Failed sessions are left as nullptr and removed after the current message was handled
+    auto run_session = [&](std::unique_ptr<DPWinRTThreadLocalSession>& session, auto&& func)
+    {
+        #ifndef _DEBUG
+        try
+        #endif
+        {
+            func(*session);
+        }
+        #ifndef _DEBUG
+        catch (const winrt::hresult_error& e)
+        {
+            //Send capture lost messages for the session's overlays. Resulting StopCapture() calls will clean up the session book-keeping
+            for (const auto& overlay : session->Data.Overlays)
+            {
+                ::PostThreadMessage(g_MainThreadID, WM_DPLUSWINRT_CAPTURE_LOST, overlay.Handle, 0);
+            }
+
+            ::PostThreadMessage(g_MainThreadID, WM_DPLUSWINRT_THREAD_ERROR, thread_id, e.code());
+
+            session.reset();
+        }
+        #endif
+    };
+
     // Initialize WinRT and scope the rest of the code so it's cleaned up before unloading WinRT again
     winrt::init_apartment(winrt::apartment_type::multi_threaded);
 
@@ -539,49 +734,15 @@ DWORD WINAPI WinRTCaptureThreadEntry(_In_ void* Param)
         // Create the DispatcherQueue that the compositor needs to run
         auto controller = util::CreateDispatcherQueueControllerForCurrentThread();
 
-        // Create the capture manager
-        auto capture_manager = std::make_unique<CaptureManager>(data, g_MainThreadID);
-        capture_manager->PixelFormat( (g_IsHDREnabled) ? winrt::DirectXPixelFormat::R16G16B16A16Float : winrt::DirectXPixelFormat::B8G8R8A8UIntNormalized );
+        //Ideally, capabilities are checked by before starting a session, but if not and no capture starts, there will just be an idle session until StopCapture is called
 
-        //Start capture
-        if (DPWinRT_IsCaptureFromHandleSupported())
+        //Start sessions picked up on thread creation
+        for (auto& session : sessions)
         {
-            if (data.SourceWindow != nullptr)
-            {
-                capture_manager->StartCaptureFromWindowHandle(data.SourceWindow);
-            }
-            else if (data.DesktopID != -2)
-            {
-                if (data.DesktopID != -1)
-                {
-                    HMONITOR monitor_handle = nullptr;
-                    GetDevmodeForDisplayID(data.DesktopID, g_DesktopEnumFlagIgnoreWMRScreens, &monitor_handle);
-
-                    if (monitor_handle != nullptr)
-                    {
-                        capture_manager->StartCaptureFromMonitorHandle(monitor_handle);
-                    }
-                    else
-                    {
-                        //Failed to get monitor handle, drop the capture
-                        for (const auto& overlay : data.Overlays)
-                        {
-                            ::PostThreadMessage(g_MainThreadID, WM_DPLUSWINRT_CAPTURE_LOST, overlay.Handle, 0);
-                            //Thread will be quit by the response to the capture lost message
-                        }
-                    }
-                }
-                else if (DPWinRT_IsCaptureFromCombinedDesktopSupported())
-                {
-                    capture_manager->StartCaptureFromMonitorHandle(nullptr);
-                }
-            }
-
-            //Set initial cursor enabled state
-            capture_manager->IsCursorEnabled(data.IsCursorEnabledInitial);
+            run_session(session, [](DPWinRTThreadLocalSession& session){ DPWinRT_Internal_StartSession(session); });
         }
 
-        //Ideally, capabilities are checked by before creating the thread, but if not and no capture starts, there will just be an idling thread until StopCapture is called
+        sessions.erase(std::remove(sessions.begin(), sessions.end(), nullptr), sessions.end());
 
         // Message pump
         MSG msg;
@@ -591,22 +752,42 @@ DWORD WINAPI WinRTCaptureThreadEntry(_In_ void* Param)
             {
                 switch (msg.message)
                 {
+                    case WM_DPLUSWINRT_SESSION_START:
+                    {
+                        auto session = std::make_unique<DPWinRTThreadLocalSession>();
+
+                        //Session may have been stopped again before getting here
+                        if (!copy_session_data((unsigned int)msg.wParam, session->Data))
+                            break;
+
+                        sessions.push_back(std::move(session));
+                        run_session(sessions.back(), [](DPWinRTThreadLocalSession& session){ DPWinRT_Internal_StartSession(session); });
+                        break;
+                    }
+                    case WM_DPLUSWINRT_SESSION_STOP:
+                    {
+                        auto it = find_session((unsigned int)msg.wParam);
+
+                        //Destroying the session stops its capture, so its overlays won't receive any more updates
+                        if (it != sessions.end())
+                        {
+                            sessions.erase(it);
+                        }
+
+                        ::PostThreadMessage(g_MainThreadID, WM_DPLUSWINRT_THREAD_ACK, msg.wParam, msg.lParam);
+                        break;
+                    }
                     case WM_DPLUSWINRT_UPDATE_DATA:
                     {
-                        //Look for thread data and update local copy
-                        std::lock_guard<std::mutex> lock(g_ThreadsMutex);
+                        //Look for session data and update local copy
+                        auto it = find_session((unsigned int)msg.wParam);
 
-                        for (const auto& thread : g_Threads)
+                        if ( (it != sessions.end()) && (copy_session_data((unsigned int)msg.wParam, (*it)->Data)) )
                         {
-                            if (thread.ThreadID == data.ThreadID)
-                            {
-                                data = thread;
-                                capture_manager->OnOverlayDataRefresh();
-                                break;
-                            }
+                            run_session(*it, [](DPWinRTThreadLocalSession& session){ session.Manager->OnOverlayDataRefresh(); });
                         }
 
-                        ::PostThreadMessage(g_MainThreadID, WM_DPLUSWINRT_THREAD_ACK, 0, 0);
+                        ::PostThreadMessage(g_MainThreadID, WM_DPLUSWINRT_THREAD_ACK, msg.wParam, msg.lParam);
 
                         break;
                     }
@@ -614,55 +795,53 @@ DWORD WINAPI WinRTCaptureThreadEntry(_In_ void* Param)
                     {
                         const bool do_pause = msg.lParam;
 
-                        bool is_unchanged = false;
-                        bool all_paused = true;
-                        for (DPWinRTOverlayData& overlay_data : data.Overlays)
+                        for (auto& session : sessions)
                         {
-                            if (overlay_data.Handle == msg.wParam)
-                            {
-                                //No change, back out
-                                if (overlay_data.IsPaused == do_pause)
-                                {
-                                    is_unchanged = true;
-                                    break;
-                                }
-
-                                overlay_data.IsPaused = do_pause;
-                            }
-
-                            if (!overlay_data.IsPaused)
-                            {
-                                all_paused = false;
-                            }
-                        }
+                            auto it = std::find_if(session->Data.Overlays.begin(), session->Data.Overlays.end(), [&](const auto& data){ return (data.Handle == msg.wParam); });
 
-                        if (!is_unchanged)
-                        {
-                            capture_manager->PauseCapture(all_paused);
+                            if (it == session->Data.Overlays.end())
+                                continue;
+
+                            //No change, back out
+                            if (it->IsPaused == do_pause)
+                                break;
+
+                            it->IsPaused = do_pause;
+
+                            const bool all_paused = std::all_of(session->Data.Overlays.begin(), session->Data.Overlays.end(), [](const auto& data){ return data.IsPaused; });
+                            run_session(session, [&](DPWinRTThreadLocalSession& session){ session.Manager->PauseCapture(all_paused); });
+                            break;
                         }
                         break;
                     }
                     case WM_DPLUSWINRT_ENABLE_CURSOR:
                     {
-                        capture_manager->IsCursorEnabled(msg.wParam);
+                        for (auto& session : sessions)
+                        {
+                            run_session(session, [&](DPWinRTThreadLocalSession& session){ session.Manager->IsCursorEnabled(msg.wParam); });
+                        }
                         break;
                     }
                     case WM_DPLUSWINRT_ENABLE_HDR:
                     {
-                        capture_manager->PixelFormat( (msg.wParam) ? winrt::DirectXPixelFormat::R16G16B16A16Float : winrt::DirectXPixelFormat::B8G8R8A8UIntNormalized );
+                        const winrt::DirectXPixelFormat pixel_format = (msg.wParam) ? winrt::DirectXPixelFormat::R16G16B16A16Float : winrt::DirectXPixelFormat::B8G8R8A8UIntNormalized;
+
+                        for (auto& session : sessions)
+                        {
+                            run_session(session, [&](DPWinRTThreadLocalSession& session){ session.Manager->PixelFormat(pixel_format); });
+                        }
                         break;
                     }
                     case WM_DPLUSWINRT_THREAD_QUIT:
                     {
-                        //Clear overlays here so they won't receive any more updates before the actually thread exits
-                        data.Overlays.clear();
-                        ::PostThreadMessage(g_MainThreadID, WM_DPLUSWINRT_THREAD_ACK, 0, 0);
-
                         ::PostQuitMessage(0);
                         break;
                     }
 
                 }
+
+                //Remove sessions that failed while handling the message
+                sessions.erase(std::remove(sessions.begin(), sessions.end(), nullptr), sessions.end());
             }
             else
             {
@@ -671,7 +850,7 @@ DWORD WINAPI WinRTCaptureThreadEntry(_In_ void* Param)
             }
         }
 
-        capture_manager = nullptr;
+        sessions.clear();
         controller = nullptr;
     }
     #ifndef _DEBUG
@@ -682,15 +861,20 @@ DWORD WINAPI WinRTCaptureThreadEntry(_In_ void* Param)
         //But we know things will go wrong when they can, let's be honest. What can go wrong isn't really well documented either, so if something
         //comes up, handle it somewhat gracefully
 
-        //Send capture lost messages for all overlays
-        //Resulting StopCapture() calls will cause cleanup of the thread book-keeping, even if this target thread is already gone
-        for (const auto& overlay : data.Overlays)
+        //Send capture lost messages for all overlays of all sessions on this thread
+        //Resulting StopCapture() calls will cause cleanup of the session and thread book-keeping, even if this target thread is already gone
+        for (const auto& session : sessions)
         {
-            ::PostThreadMessage(g_MainThreadID, WM_DPLUSWINRT_CAPTURE_LOST, overlay.Handle, 0);
+            for (const auto& overlay : session->Data.Overlays)
+            {
+                ::PostThreadMessage(g_MainThreadID, WM_DPLUSWINRT_CAPTURE_LOST, overlay.Handle, 0);
+            }
         }
 
+        sessions.clear();
+
         //Send thread error message
-        ::PostThreadMessage(g_MainThreadID, WM_DPLUSWINRT_THREAD_ERROR, data.ThreadID, e.code());
+        ::PostThreadMessage(g_MainThreadID, WM_DPLUSWINRT_THREAD_ERROR, thread_id, e.code());
 
         //...and then get out of this thread
     }
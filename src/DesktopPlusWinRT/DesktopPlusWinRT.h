@@ -12,6 +12,7 @@
 //For Graphics Capture, all overlay texture handling is handed off to this library. Everything else is still handled by OutputManager as usual, however.
 
 //As a general rule, the callee of the library functions is responsible to check for support first, otherwise it may throw or crash
+//Captures are run as sessions on a small pool of capture threads, sharing one D3D11 device per adapter.
 //In release builds, capture thread exceptions are caught and handled as unexpected errors, trying to just stop the thread. Ideally it never comes to that, of course.
 //The library relies on delay loading CoreMessaging and D3D11 in order to support running on Windows 8, so keep that in mind if ever using a different compiler.
 
@@ -30,15 +31,17 @@
 //Thread message IDs
 #define WM_DPLUSWINRT               WM_APP           //Base ID, to allow changing it easily later
 #define WM_DPLUSWINRT_SIZE          WM_DPLUSWINRT    //Sent to main thread on size change. wParam = overlay handle, lParam = width & height (in low/high word order, signed)
-#define WM_DPLUSWINRT_UPDATE_DATA   WM_DPLUSWINRT+1  //Sent to capture thread to update its local data
+#define WM_DPLUSWINRT_UPDATE_DATA   WM_DPLUSWINRT+1  //Sent to capture thread to update its local data of a session. wParam = session ID, lParam = ID passed back with the acknowledgement
 #define WM_DPLUSWINRT_CAPTURE_PAUSE WM_DPLUSWINRT+2  //Sent to capture thread to pause/resume capture. wParam = overlay handle, lParam = pause bool
 #define WM_DPLUSWINRT_CAPTURE_LOST  WM_DPLUSWINRT+3  //Sent to main thread when capture item was closed, should call StopCapture() in response. wParam = overlay handle
 #define WM_DPLUSWINRT_ENABLE_CURSOR WM_DPLUSWINRT+4  //Sent to capture thread to change cursor enabled state, wParam = cursor enabled bool
 #define WM_DPLUSWINRT_ENABLE_HDR    WM_DPLUSWINRT+5  //Sent to capture thread to change HDR enabled state, wParam = HDR enabled bool
-#define WM_DPLUSWINRT_THREAD_QUIT   WM_DPLUSWINRT+6  //Sent to capture thread to quit when no overlays are left to capture
+#define WM_DPLUSWINRT_THREAD_QUIT   WM_DPLUSWINRT+6  //Sent to capture thread to quit when no sessions are left on it
 #define WM_DPLUSWINRT_THREAD_ERROR  WM_DPLUSWINRT+7  //Sent to main thread when an unexpected error occured in the capture thread. wParam = thread ID, lParam = hresult
-#define WM_DPLUSWINRT_THREAD_ACK    WM_DPLUSWINRT+8  //Sent to main thread to acknowledge thread messages from StopCapture() (main thread is blocked until this is received)
+#define WM_DPLUSWINRT_THREAD_ACK    WM_DPLUSWINRT+8  //Sent to main thread to acknowledge session stop and update data messages (StopCapture() blocks until it's received). wParam = session ID, lParam = ID of the acknowledged message
 #define WM_DPLUSWINRT_FPS           WM_DPLUSWINRT+9  //Sent to main thread when fps count has changed. wParam = overlay handle, lParam = frames per second
+#define WM_DPLUSWINRT_SESSION_START WM_DPLUSWINRT+10 //Sent to capture thread to start capture of a session assigned to it. wParam = session ID
+#define WM_DPLUSWINRT_SESSION_STOP  WM_DPLUSWINRT+11 //Sent to capture thread to stop capture of a session when no overlays are left on it. wParam = session ID, lParam = ID passed back with the acknowledgement
 
 #ifdef __cplusplus
 extern "C" {
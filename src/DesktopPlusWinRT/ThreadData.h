@@ -19,12 +19,22 @@ struct DPWinRTOverlayData
     int OU3D_crop_height = 1;
 };
 
-struct DPWinRTThreadData
+//A single capture item and the overlays displaying it. Multiple sessions share one capture thread
+struct DPWinRTSessionData
 {
-    HANDLE ThreadHandle = nullptr;
-    DWORD ThreadID = 0;
+    unsigned int SessionID = 0;
+    DWORD ThreadID = 0;             //ID of the capture thread hosting the session
     std::vector<DPWinRTOverlayData> Overlays;
     HWND SourceWindow = nullptr;
     int DesktopID = -2;
     bool IsCursorEnabledInitial = true;
+};
+
+//Capture thread from the pool. Threads are created on demand and quit once they have no sessions left
+struct DPWinRTThreadData
+{
+    HANDLE ThreadHandle = nullptr;
+    DWORD ThreadID = 0;
+    unsigned int SessionCount = 0;
+    bool IsReady = false;           //Set once the thread's message queue exists. Messages posted before are lost, the thread picks up its sessions' current data instead
 };
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include <sstream>
 #include <random>
 #include <ctime>
+#include <cstring>
 
 #ifndef NOMINMAX
     #define NOMINMAX
@@ -58,152 +59,170 @@ const char* ActionCommand::s_CommandTypeNames[ActionCommand::command_MAX] =
     "Unknown"
 };
 
-std::string ActionCommand::Serialize() const
-{
-    std::stringstream ss(std::ios::out | std::ios::binary);
-    size_t str_size = 0;
+//Binary format used for synching actions between processes. Plain values are stored as-is, strings with a uint32_t length prefix.
+//Both processes are always the same version, the version byte only exists to reject data from mismatched builds instead of reading garbage.
+static const unsigned char k_ActionBinaryFormatVersion = 1;
 
-    ss.write((const char*)&Type,     sizeof(Type));
-    ss.write((const char*)&UIntID,   sizeof(UIntID));
-    ss.write((const char*)&UIntArg,  sizeof(UIntArg));
+class ActionBinaryWriter
+{
+    private:
+        std::string& m_Buffer;
 
-    str_size = StrMain.size();
-    ss.write((const char*)&str_size, sizeof(str_size));
-    ss.write(StrMain.data(),         str_size);
+    public:
+        explicit ActionBinaryWriter(std::string& buffer) : m_Buffer(buffer) {}
 
-    str_size = StrArg.size();
-    ss.write((const char*)&str_size, sizeof(str_size));
-    ss.write(StrArg.data(),          str_size);
+        template<typename T>
+        void Write(T value)
+        {
+            m_Buffer.append((const char*)&value, sizeof(T));
+        }
 
-    return ss.str();
-}
+        void WriteString(const std::string& str)
+        {
+            Write((uint32_t)str.size());
+            m_Buffer.append(str.data(), str.size());
+        }
+};
 
-void ActionCommand::Deserialize(const std::string& str)
+class ActionBinaryReader
 {
-    std::stringstream ss(str, std::ios::in | std::ios::binary);
+    private:
+        const char* m_Data;
+        size_t m_Size;
+        size_t m_Pos;
+        bool m_IsValid;
+
+    public:
+        ActionBinaryReader(const char* data, size_t size) : m_Data(data), m_Size(size), m_Pos(0), m_IsValid(data != nullptr) {}
+
+        //Returns default value and sets the reader invalid if there's not enough data left
+        template<typename T>
+        T Read()
+        {
+            T value = T();
+
+            if ( (!m_IsValid) || (m_Size - m_Pos < sizeof(T)) )
+            {
+                m_IsValid = false;
+                return value;
+            }
 
-    ActionCommand new_command;
-    size_t str_length = 0;
+            memcpy(&value, m_Data + m_Pos, sizeof(T));
+            m_Pos += sizeof(T);
 
-    ss.read((char*)&new_command.Type,    sizeof(Type));
-    ss.read((char*)&new_command.UIntID,  sizeof(UIntID));
-    ss.read((char*)&new_command.UIntArg, sizeof(UIntArg));
+            return value;
+        }
 
-    ss.read((char*)&str_length, sizeof(str_length));
-    str_length = std::min(str_length, (size_t)4096);    //Arbitrary size limit to avoid large allocations on garbage data
-    new_command.StrMain.resize(str_length);
-    ss.read(&new_command.StrMain[0], str_length);
+        void ReadString(std::string& str)
+        {
+            const uint32_t str_length = Read<uint32_t>();
 
-    ss.read((char*)&str_length, sizeof(str_length));
-    str_length = std::min(str_length, (size_t)4096);
-    new_command.StrArg.resize(str_length);
-    ss.read(&new_command.StrArg[0], str_length);
+            //Lengths can't be larger than the remaining data, which also avoids large allocations on garbage data
+            if ( (!m_IsValid) || (m_Size - m_Pos < str_length) )
+            {
+                m_IsValid = false;
+                return;
+            }
 
-    //Replace all data with the read command if there were no stream errors
-    if (ss.good())
-        *this = new_command;
-}
+            str.assign(m_Data + m_Pos, str_length);
+            m_Pos += str_length;
+        }
 
+        size_t GetRemainingSize() const { return m_Size - m_Pos; }
+        bool IsValid()            const { return m_IsValid; }
+};
 
-std::string Action::Serialize() const
+static void ActionCommandWriteBinary(ActionBinaryWriter& writer, const ActionCommand& command)
 {
-    std::stringstream ss(std::ios::out | std::ios::binary);
-    size_t str_size = 0;
+    writer.Write((uint32_t)command.Type);
+    writer.Write((uint32_t)command.UIntID);
+    writer.Write((uint32_t)command.UIntArg);
+    writer.WriteString(command.StrMain);
+    writer.WriteString(command.StrArg);
+}
 
-    ss.write((const char*)&UID, sizeof(UID));
+static void ActionCommandReadBinary(ActionBinaryReader& reader, ActionCommand& command)
+{
+    const uint32_t type = reader.Read<uint32_t>();
+    command.Type    = (type < ActionCommand::command_MAX) ? (ActionCommand::CommandType)type : ActionCommand::command_unknown;
+    command.UIntID  = reader.Read<uint32_t>();
+    command.UIntArg = reader.Read<uint32_t>();
+    reader.ReadString(command.StrMain);
+    reader.ReadString(command.StrArg);
+}
 
-    str_size = Name.size();
-    ss.write((const char*)&str_size, sizeof(str_size));
-    ss.write(Name.data(),            str_size);
+std::string Action::Serialize() const
+{
+    std::string buffer;
+    ActionBinaryWriter writer(buffer);
 
-    str_size = Label.size();
-    ss.write((const char*)&str_size, sizeof(str_size));
-    ss.write(Label.data(),           str_size);
+    writer.Write(k_ActionBinaryFormatVersion);
+    writer.Write(UID);
+    writer.WriteString(Name);
+    writer.WriteString(Label);
 
-    size_t command_count = Commands.size();
-    ss.write((const char*)&command_count, sizeof(command_count));
+    writer.Write((uint32_t)Commands.size());
 
     for (const auto& command : Commands)
     {
-        std::string command_serialized = command.Serialize();
-
-        str_size = command_serialized.size();
-        ss.write((const char*)&str_size,    sizeof(str_size));
-        ss.write(command_serialized.data(), str_size);
+        ActionCommandWriteBinary(writer, command);
     }
 
-    ss.write((const char*)&TargetUseTags, sizeof(TargetUseTags));
+    writer.Write((unsigned char)TargetUseTags);
+    writer.WriteString(TargetTags);     //Tags are still preserved even when not used
+    writer.WriteString(IconFilename);
 
-    //Tags are still preserved even when not used
-    str_size = TargetTags.size();
-    ss.write((const char*)&str_size, sizeof(str_size));
-    ss.write(TargetTags.data(),      str_size);
-
-    str_size = IconFilename.size();
-    ss.write((const char*)&str_size, sizeof(str_size));
-    ss.write(IconFilename.data(),    str_size);
-
-    return ss.str();
+    return buffer;
 }
 
-void Action::Deserialize(const std::string& str)
+bool Action::Deserialize(const char* data, size_t size)
 {
-    std::stringstream ss(str, std::ios::in | std::ios::binary);
+    ActionBinaryReader reader(data, size);
+
+    if (reader.Read<unsigned char>() != k_ActionBinaryFormatVersion)
+        return false;
 
     Action new_action;
-    size_t str_length = 0;
 
-    ss.read((char*)&new_action.UID,    sizeof(UID));
+    new_action.UID = reader.Read<ActionUID>();
+    reader.ReadString(new_action.Name);
+    reader.ReadString(new_action.Label);
 
-    ss.read((char*)&str_length, sizeof(str_length));
-    str_length = std::min(str_length, str.length());
-    new_action.Name.resize(str_length);
-    ss.read(&new_action.Name[0], str_length);
+    //Every command takes at least 20 bytes, don't trust counts that can't possibly fit
+    const uint32_t command_count = reader.Read<uint32_t>();
 
-    ss.read((char*)&str_length, sizeof(str_length));
-    str_length = std::min(str_length, str.length());
-    new_action.Label.resize(str_length);
-    ss.read(&new_action.Label[0], str_length);
+    if (command_count > reader.GetRemainingSize() / 20)
+        return false;
 
-    size_t command_count = 0;
-    ss.read((char*)&command_count,     sizeof(command_count));
+    new_action.Commands.resize(command_count);
 
-    for (size_t i = 0; i < command_count; ++i)
+    for (auto& command : new_action.Commands)
     {
-        ss.read((char*)&str_length, sizeof(str_length));
-        str_length = std::min(str_length, str.length());
-        std::string command_serialized(str_length, '\0');
-        ss.read(&command_serialized[0], str_length);
-
-        ActionCommand new_command;
-        new_command.Deserialize(command_serialized);
-
-        new_action.Commands.push_back(new_command);
+        ActionCommandReadBinary(reader, command);
     }
 
-    ss.read((char*)&new_action.TargetUseTags, sizeof(TargetUseTags));
+    new_action.TargetUseTags = (reader.Read<unsigned char>() != 0);
+    reader.ReadString(new_action.TargetTags);
+    reader.ReadString(new_action.IconFilename);
 
-    ss.read((char*)&str_length, sizeof(str_length));
-    str_length = std::min(str_length, str.length());
-    new_action.TargetTags.resize(str_length);
-    ss.read(&new_action.TargetTags[0], str_length);
+    //Replace all data with the read action if there were no errors
+    if (!reader.IsValid())
+        return false;
 
-    ss.read((char*)&str_length, sizeof(str_length));
-    str_length = std::min(str_length, str.length());
-    new_action.IconFilename.resize(str_length);
-    ss.read(&new_action.IconFilename[0], str_length);
+    *this = std::move(new_action);
 
-    //Replace all data with the read action if there were no stream errors
-    if (ss.good())
-    {
-        *this = new_action;
+    #ifdef DPLUS_UI
+        //Check for potential translation strings
+        NameTranslationID  = ActionManager::GetTranslationIDForName(Name);
+        LabelTranslationID = ActionManager::GetTranslationIDForName(Label);
+    #endif
 
-        #ifdef DPLUS_UI
-            //Check for potential translation strings
-            NameTranslationID  = ActionManager::GetTranslationIDForName(Name);
-            LabelTranslationID = ActionManager::GetTranslationIDForName(Label);
-        #endif
-    }
+    return true;
+}
+
+void Action::Deserialize(const std::string& str)
+{
+    Deserialize(str.data(), str.size());
 }
 
 ActionManager::ActionManager()
@@ -42,9 +42,6 @@ struct ActionCommand
     unsigned int UIntArg = 0;
     std::string StrMain;
     std::string StrArg;
-
-    std::string Serialize() const;              //Serializes into binary data stored as string (contains NUL bytes), not suitable for storage
-    void Deserialize(const std::string& str);   //Deserializes from strings created by above function
 };
 
 typedef uint64_t ActionUID;
@@ -69,8 +66,9 @@ struct Action
         TRMGRStrID LabelTranslationID = tstr_NONE;
     #endif
 
-    std::string Serialize() const;              //Serializes into binary data stored as string (contains NUL bytes), not suitable for storage
-    void Deserialize(const std::string& str);   //Deserializes from strings created by above function
+    std::string Serialize() const;                      //Serializes into binary data stored as string (contains NUL bytes), not suitable for storage
+    bool Deserialize(const char* data, size_t size);    //Deserializes from data created by Serialize(), returns false and leaves action unchanged if invalid
+    void Deserialize(const std::string& str);
 };
 
 class ActionManager
@@ -7,12 +7,22 @@
 
 #include "openvr.h"
 
-static const int k_lDPBrowserAPIVersion = 5;
+static const int k_lDPBrowserAPIVersion = 6;
+static const int k_lDPBrowserAPIVersionMin = 5;                                         //Oldest browser process API version still accepted, see below
 LPCWSTR const g_WindowClassNameBrowserApp        = L"elvdesktopbrowser";
 LPCWSTR const g_WindowMessageNameBrowserApp      = L"WMIPC_DPLUS_BrowserCommand";
 const char* const g_AppKeyBrowserApp             = "elvissteinjr.DesktopPlusBrowser";
 const char* const g_RelativeWorkingDirBrowserApp = "DesktopPlusBrowser";                //Path relative to Desktop+ application directory
 const char* const g_ExeNameBrowserApp            = "DesktopPlusBrowser.exe";            //Path relative to g_RelativeWorkingDirBrowserApp
+LPCWSTR const g_CommandRingNamePrefixBrowserApp  = L"DPlusBrowserCommandRing_";       //Shared memory name of a client's command ring, followed by the client's process ID
+const unsigned int k_ulDPBrowserCommandRingSize  = 256 * 1024;
+
+//Commands are sent to the browser process in batches using the command stream from DPBrowserCommandStream.h, one record per command.
+//This is only done if the browser process reports an API version of k_lDPBrowserAPIVersion. Browser processes of version 5 don't know the stream and
+//get every command as individual window messages as described below instead.
+//Records carry the overlay handle, so dpbrowser_ipccmd_set_overlay_target is not used in the stream. The record value is the lParam described below,
+//or 0 where lParam is the overlay handle. String args are the record payload instead of dpbrowser_ipcstr_* messages.
+//Window messages are still used for dpbrowser_ipccmd_get_api_version, stream delivery and anything sent by the browser process.
 
 enum DPBrowserICPCommandID
 {
@@ -42,7 +52,7 @@ enum DPBrowserICPCommandID
     dpbrowser_ipccmd_refresh,                   //lParam = overlay_handle, will stop if the page is currently loading
     dpbrowser_ipccmd_global_set_fps,            //lParam = fps, global setting
     dpbrowser_ipccmd_cblock_set_enabled,        //lParam = enabled bool
-    dpbrowser_ipccmd_error_set_strings,         //No value in lParam, uses dpbrowser_ipcstr_tstr_error_* args
+    dpbrowser_ipccmd_error_set_strings,         //No value in lParam, uses dpbrowser_ipcstr_tstr_error_* args (stream payload: title, heading and message separated by NUL)
     dpbrowser_ipccmd_notify_ready,              //No value in lParam | Sent by browser process to dashboard & UI process
     dpbrowser_ipccmd_notify_nav_state,          //lParam = DPBrowserIPCNavStateFlags, uses set_overlay_target arg | Sent by browser process to UI process
     dpbrowser_ipccmd_notify_url_changed,        //lParam = overlay_handle, uses dpbrowser_ipcstr_url arg | Sent by browser process to UI process
@@ -51,6 +61,7 @@ enum DPBrowserICPCommandID
     dpbrowser_ipccmd_notify_lpointer_haptics,   //No value in lParam, triggers short UI interaction burst on primary device | Sent by browser process to dashboard process
     dpbrowser_ipccmd_notify_keyboard_show,      //lParam = show bool, uses set_overlay_target arg | Sent by browser process to UI process
     dpbrowser_ipccmd_notify_cblock_list_count,  //lParam = list count | Sent by browser process to UI process
+    dpbrowser_ipccmd_command_stream_wake,       //lParam = client process ID, new blocks are in the client's command ring
 };
 
 enum DPBrowserICPStringID
@@ -62,7 +73,8 @@ enum DPBrowserICPStringID
     dpbrowser_ipcstr_tstr_error_title,          //Error page translation string
     dpbrowser_ipcstr_tstr_error_heading,        //Error page translation string
     dpbrowser_ipcstr_tstr_error_message,        //Error page translation string
-    dpbrowser_ipcstr_MAX
+    dpbrowser_ipcstr_MAX,
+    dpbrowser_ipcdata_command_stream = 1100     //WM_COPYDATA command stream block, used when the command ring is full or not available. The client's command ring is drained first
 };
 
 enum DPBrowserIPCNavStateFlags : unsigned char
@@ -25,6 +25,10 @@ bool DPBrowserAPIClient::LaunchServerIfNotRunning()
     if (IsServerRunning())
         return true;
 
+    //Already launching, Update() takes care of the rest
+    if (m_IsServerLaunching)
+        return false;
+
     //Prepare command-line
     std::wstring browser_args_wstr = L"--DPBrowserServer ";
     browser_args_wstr += WStringConvertFromUTF8(ConfigManager::Get().GetValue(configid_str_browser_extra_arguments).c_str());
@@ -37,6 +41,8 @@ bool DPBrowserAPIClient::LaunchServerIfNotRunning()
     std::wstring browser_working_dir = WStringConvertFromUTF8( (ConfigManager::Get().GetApplicationPath() + g_RelativeWorkingDirBrowserApp).c_str() );
     std::wstring browser_exe_path    = browser_working_dir + L"/" + WStringConvertFromUTF8(g_ExeNameBrowserApp);
 
+    m_LaunchProcessID = 0;
+
     #ifndef DPLUS_UI
     //If the process is elevated, do *not* launch a web browser with admin privileges. We're not insane.
     if (ConfigManager::Get().GetValue(configid_bool_state_misc_process_elevated))
@@ -69,56 +75,124 @@ bool DPBrowserAPIClient::LaunchServerIfNotRunning()
             return false;
         }
 
+        m_LaunchProcessID = pi.dwProcessId;
+
         ::CloseHandle(pi.hProcess);
         ::CloseHandle(pi.hThread);
     }
 
-    //Wait for it to be ready
-    ULONGLONG start_tick = ::GetTickCount64();
+    //Don't wait for it to be ready. Commands issued until then are collected in m_PendingState and replayed by FinishServerLaunch()
+    m_IsServerLaunching = true;
+    m_LaunchStartTick   = ::GetTickCount64();
+    m_LaunchPollTick    = 0;
+
+    LOG_F(INFO, "Launching Desktop+ Browser process...");
+
+    return false;
+}
+
+void DPBrowserAPIClient::FinishServerLaunch(HWND server_window)
+{
+    m_IsServerLaunching  = false;
+    m_ServerWindowHandle = server_window;
+
+    //Check if the API versions are compatible
+    const int server_api_version = QueryServerAPIVersion();
 
-    while ( (m_ServerWindowHandle = ::FindWindow(g_WindowClassNameBrowserApp, nullptr), m_ServerWindowHandle == nullptr) &&
-            (::GetTickCount64() - start_tick < 10000) )                                                                     //Wait 10 seconds max (should usually be faster though)
+    if ( (server_api_version < k_lDPBrowserAPIVersionMin) || (server_api_version > k_lDPBrowserAPIVersion) )
     {
-        #ifndef DPLUS_UI
-            //Call busy update while waiting to appear a bit more responsive. Not ideal, but beats running in parallel and having to queue up all function calls when busy
-            if (OutputManager* outmgr = OutputManager::Get())
-            {
-                outmgr->BusyUpdate();
-                ::Sleep(outmgr->GetMaxRefreshDelay());
-            }
-        #else
-            ::Sleep(50);
-        #endif
+        m_HasServerAPIMismatch = true;
+
+        //Send quit message so the process doesn't linger around
+        ::PostMessage(m_ServerWindowHandle, WM_QUIT, 0, 0);
+
+        m_ServerWindowHandle = nullptr;
+        m_UseCommandStream   = false;
+        m_PendingState.Clear();
+
+        //Post config state to UI to allow displaying a warning since the UI doesn't try to launch the browser process on its own in most cases
+        IPCManager::Get().PostConfigMessageToUIApp(configid_bool_state_misc_browser_version_mismatch, true);
+
+        LOG_F(ERROR, "Desktop+ Browser API version does not match! Expected version %d to %d, but got %d", k_lDPBrowserAPIVersionMin, k_lDPBrowserAPIVersion, server_api_version);
+
+        return;
     }
 
-    //Check if the API versions match
-    if (m_ServerWindowHandle != nullptr)
-    {
-        const int server_api_version = (int)::SendMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_get_api_version, 0);
+    //Older browser processes still get commands as window messages
+    m_UseCommandStream = (server_api_version == k_lDPBrowserAPIVersion);
+
+    ResetCommandRing();
+    ApplyPendingSettings();
+    ReplayPendingState();
 
-        if (server_api_version != k_lDPBrowserAPIVersion)
+    #ifndef DPLUS_UI
+        //Rendering PID couldn't be set for browser overlays if the process was launched via the shell
+        if (m_LaunchProcessID == 0)
         {
-            m_HasServerAPIMismatch = true;
+            const DWORD server_pid = GetServerAppProcessID();
+
+            for (unsigned int i = 0; i < OverlayManager::Get().GetOverlayCount(); ++i)
+            {
+                const Overlay& overlay = OverlayManager::Get().GetOverlay(i);
 
-            //Send quit message so the process doesn't linger around
-            ::PostMessage(m_ServerWindowHandle, WM_QUIT, 0, 0);
+                if (overlay.GetTextureSource() == ovrl_texsource_browser)
+                {
+                    vr::VROverlay()->SetOverlayRenderingPid(overlay.GetHandle(), server_pid);
+                }
+            }
+        }
+    #endif
 
-            m_ServerWindowHandle = nullptr;
+    LOG_F(INFO, "Launched Desktop+ Browser process (API version %d)", server_api_version);
+}
 
-            //Post config state to UI to allow displaying a warning since the UI doesn't try to launch the browser process on its own in most cases
-            IPCManager::Get().PostConfigMessageToUIApp(configid_bool_state_misc_browser_version_mismatch, true);
+int DPBrowserAPIClient::QueryServerAPIVersion() const
+{
+    return (int)::SendMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_get_api_version, 0);
+}
 
-            LOG_F(ERROR, "Desktop+ Browser API version does not match! Expected version %d, but got %d", k_lDPBrowserAPIVersion, server_api_version);
+void DPBrowserAPIClient::ReplayPendingState()
+{
+    const auto& states = m_PendingState.GetStates();
 
-            return false;
+    //Goes through QueueCommand() so it's sent in whatever protocol the server supports
+    //Starts first, then duplications and then the rest, so every browser exists by the time it's referenced
+    for (const auto& state : states)
+    {
+        if (state.HasStart)
+        {
+            QueueCommand(dpbrowser_ipccmd_start_browser, state.OverlayHandle, state.UseTransparentBackground, state.StartURL);
         }
     }
 
-    ApplyPendingSettings();
+    for (const auto& state : states)
+    {
+        if (state.HasDuplicationSource)
+        {
+            QueueCommand(dpbrowser_ipccmd_duplicate_browser_output, state.DuplicationSourceHandle, (int64_t)state.OverlayHandle);
+        }
+    }
 
-    LOG_F(INFO, "Launched Desktop+ Browser process");
+    for (const auto& state : states)
+    {
+        if (state.HasURL)
+            QueueCommand(dpbrowser_ipccmd_set_url,       state.OverlayHandle, 0, state.URL);
+        if (state.HasResolution)
+            QueueCommand(dpbrowser_ipccmd_set_resoution, state.OverlayHandle, MAKELPARAM(state.Width, state.Height));
+        if (state.HasFPS)
+            QueueCommand(dpbrowser_ipccmd_set_fps,       state.OverlayHandle, state.FPS);
+        if (state.HasZoomLevel)
+            QueueCommand(dpbrowser_ipccmd_set_zoom,      state.OverlayHandle, pun_cast<LPARAM, float>(state.ZoomLevel));
+        if (state.HasOU3DCrop)
+            QueueCommand(dpbrowser_ipccmd_set_ou3d_crop, state.OverlayHandle, state.OU3DCropValue);
+        if (state.HasPause)
+            QueueCommand(dpbrowser_ipccmd_pause_browser, state.OverlayHandle, state.Pause);
+    }
 
-    return true;
+    m_PendingState.Clear();
+
+    //Send it all in one go if the command stream is used
+    FlushCommands();
 }
 
 bool DPBrowserAPIClient::IsServerRunning()
@@ -127,6 +201,10 @@ bool DPBrowserAPIClient::IsServerRunning()
     if ( (!m_IsServerAvailable) || (m_HasServerAPIMismatch) )
         return false;
 
+    //Not usable until Update() has finished the launch
+    if (m_IsServerLaunching)
+        return false;
+
     //Check if it's already running and update cached handle
     HWND window_handle = ::FindWindow(g_WindowClassNameBrowserApp, nullptr);
 
@@ -134,6 +212,11 @@ bool DPBrowserAPIClient::IsServerRunning()
     if (m_ServerWindowHandle != window_handle)
     {
         m_ServerWindowHandle = window_handle;
+
+        //The server wasn't launched by us here, so only the protocol is picked. Versions are checked on launch
+        m_UseCommandStream = ( (m_ServerWindowHandle != nullptr) && (QueryServerAPIVersion() == k_lDPBrowserAPIVersion) );
+
+        ResetCommandRing();
         ApplyPendingSettings();
     }
 
@@ -170,6 +253,143 @@ void DPBrowserAPIClient::ApplyPendingSettings()
     #endif
 }
 
+void DPBrowserAPIClient::InitCommandRing()
+{
+    const std::wstring mapping_name = g_CommandRingNamePrefixBrowserApp + std::to_wstring(::GetCurrentProcessId());
+    const DWORD mapping_size = (DWORD)DPBrowserCommandRing::GetRequiredMemorySize(k_ulDPBrowserCommandRingSize);
+
+    m_CommandRingMapping = ::CreateFileMapping(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0, mapping_size, mapping_name.c_str());
+
+    if (m_CommandRingMapping != nullptr)
+    {
+        m_CommandRingMemory = ::MapViewOfFile(m_CommandRingMapping, FILE_MAP_ALL_ACCESS, 0, 0, mapping_size);
+    }
+
+    if (m_CommandRingMemory != nullptr)
+    {
+        m_CommandRing.Init(m_CommandRingMemory, k_ulDPBrowserCommandRingSize);
+    }
+    else
+    {
+        LOG_F(WARNING, "Failed to create browser command ring, falling back to WM_COPYDATA");
+
+        if (m_CommandRingMapping != nullptr)
+        {
+            ::CloseHandle(m_CommandRingMapping);
+            m_CommandRingMapping = nullptr;
+        }
+    }
+}
+
+void DPBrowserAPIClient::ResetCommandRing()
+{
+    //Blocks not read by a previous browser process are of no use to a new one
+    m_CommandEncoder.Clear();
+
+    if (m_CommandRingMemory != nullptr)
+    {
+        m_CommandRing.Init(m_CommandRingMemory, k_ulDPBrowserCommandRingSize);
+    }
+}
+
+void DPBrowserAPIClient::QueueCommand(DPBrowserICPCommandID command_id, vr::VROverlayHandle_t overlay_handle, int64_t value, DPBrowserCmdCoalesceMode coalesce_mode)
+{
+    //Nothing to coalesce with window messages, so they're sent right away
+    if (!m_UseCommandStream)
+    {
+        SendLegacyCommand(command_id, overlay_handle, value, "");
+        return;
+    }
+
+    m_CommandEncoder.Add(command_id, overlay_handle, value, coalesce_mode);
+}
+
+void DPBrowserAPIClient::QueueCommand(DPBrowserICPCommandID command_id, vr::VROverlayHandle_t overlay_handle, int64_t value, const std::string& payload)
+{
+    if (!m_UseCommandStream)
+    {
+        SendLegacyCommand(command_id, overlay_handle, value, payload);
+        return;
+    }
+
+    m_CommandEncoder.Add(command_id, overlay_handle, value, payload);
+}
+
+void DPBrowserAPIClient::SendCommand(DPBrowserICPCommandID command_id, vr::VROverlayHandle_t overlay_handle, int64_t value, const std::string& payload)
+{
+    if (!m_UseCommandStream)
+    {
+        SendLegacyCommand(command_id, overlay_handle, value, payload);
+        return;
+    }
+
+    //Anything queued before is flushed with it, so the order of commands is kept
+    QueueCommand(command_id, overlay_handle, value, payload);
+    FlushCommands();
+}
+
+void DPBrowserAPIClient::SendLegacyCommand(DPBrowserICPCommandID command_id, vr::VROverlayHandle_t overlay_handle, int64_t value, const std::string& payload)
+{
+    if (m_ServerWindowHandle == nullptr)
+        return;
+
+    switch (command_id)
+    {
+        //Commands using lParam for other arguments, overlay handle is sent via set_overlay_target first
+        case dpbrowser_ipccmd_start_browser:
+        case dpbrowser_ipccmd_duplicate_browser_output:
+        case dpbrowser_ipccmd_pause_browser:
+        case dpbrowser_ipccmd_recreate_browser:
+        case dpbrowser_ipccmd_set_resoution:
+        case dpbrowser_ipccmd_set_fps:
+        case dpbrowser_ipccmd_set_zoom:
+        case dpbrowser_ipccmd_set_ou3d_crop:
+        case dpbrowser_ipccmd_mouse_move:
+        case dpbrowser_ipccmd_mouse_down:
+        case dpbrowser_ipccmd_mouse_up:
+        case dpbrowser_ipccmd_scroll:
+        case dpbrowser_ipccmd_keyboard_vkey:
+        case dpbrowser_ipccmd_keyboard_vkey_toggle:
+        case dpbrowser_ipccmd_keyboard_wchar:
+        {
+            if (command_id == dpbrowser_ipccmd_start_browser)
+            {
+                SendStringMessage(dpbrowser_ipcstr_url, payload);
+            }
+
+            ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_overlay_target, overlay_handle);
+            ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, command_id, (LPARAM)value);
+            break;
+        }
+        //Commands using lParam for the overlay handle
+        case dpbrowser_ipccmd_stop_browser:
+        case dpbrowser_ipccmd_set_url:
+        case dpbrowser_ipccmd_mouse_leave:
+        case dpbrowser_ipccmd_keyboard_string:
+        case dpbrowser_ipccmd_go_back:
+        case dpbrowser_ipccmd_go_forward:
+        case dpbrowser_ipccmd_refresh:
+        {
+            if (command_id == dpbrowser_ipccmd_set_url)
+            {
+                SendStringMessage(dpbrowser_ipcstr_url, payload);
+            }
+            else if (command_id == dpbrowser_ipccmd_keyboard_string)
+            {
+                SendStringMessage(dpbrowser_ipcstr_keyboard_string, payload);
+            }
+
+            ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, command_id, overlay_handle);
+            break;
+        }
+        //Global commands and error_set_strings, whose strings are sent by DPBrowser_ErrorPageSetStrings() directly
+        default:
+        {
+            ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, command_id, (LPARAM)value);
+        }
+    }
+}
+
 void DPBrowserAPIClient::SendStringMessage(DPBrowserICPStringID str_id, const std::string& str) const
 {
     HWND source_window = nullptr;
@@ -215,6 +435,11 @@ bool DPBrowserAPIClient::Init()
     //Register custom message ID
     m_Win32MessageID = ::RegisterWindowMessage(g_WindowMessageNameBrowserApp);
 
+    if (m_IsServerAvailable)
+    {
+        InitCommandRing();
+    }
+
     LOG_F(INFO, "Desktop+ Browser is %s", (IsBrowserAvailable()) ? "available" : "not available");
 
     return true;
@@ -226,12 +451,14 @@ void DPBrowserAPIClient::Quit()
     if (!IsServerRunning())
         return;
 
-    //Ask browser process to quit cleanly
+    //Send anything still queued and ask browser process to quit cleanly
+    FlushCommands();
     ::PostMessage(m_ServerWindowHandle, WM_QUIT, 0, 0);
 
     //Reset some variables, though this usually is just called during Desktop+ shutdown
     m_HasServerAPIMismatch = false;
     m_ServerWindowHandle   = nullptr;
+    m_UseCommandStream     = false;
 }
 
 bool DPBrowserAPIClient::IsBrowserAvailable() const
@@ -241,8 +468,9 @@ bool DPBrowserAPIClient::IsBrowserAvailable() const
 
 DWORD DPBrowserAPIClient::GetServerAppProcessID()
 {
+    //Process ID is known before the server is ready if it was launched directly
     if (!LaunchServerIfNotRunning())
-        return 0;
+        return (m_IsServerLaunching) ? m_LaunchProcessID : 0;
 
     DWORD pid = 0;
     ::GetWindowThreadProcessId(m_ServerWindowHandle, &pid);
@@ -286,7 +514,17 @@ void DPBrowserAPIClient::HandleIPCMessage(const MSG& msg)
         }
         case dpbrowser_ipccmd_notify_ready:
         {
-            ApplyPendingSettings();
+            if (m_IsServerLaunching)
+            {
+                if (HWND server_window = ::FindWindow(g_WindowClassNameBrowserApp, nullptr))
+                {
+                    FinishServerLaunch(server_window);
+                }
+            }
+            else
+            {
+                ApplyPendingSettings();
+            }
             break;
         }
         case dpbrowser_ipccmd_notify_nav_state:
@@ -406,103 +644,232 @@ void DPBrowserAPIClient::HandleIPCMessage(const MSG& msg)
     }
 }
 
+void DPBrowserAPIClient::Update()
+{
+    if (m_IsServerLaunching)
+    {
+        const ULONGLONG tick = ::GetTickCount64();
+
+        //Look for the server window every now and then until it's there or it took too long
+        if (tick - m_LaunchPollTick >= 50)
+        {
+            m_LaunchPollTick = tick;
+
+            if (HWND server_window = ::FindWindow(g_WindowClassNameBrowserApp, nullptr))
+            {
+                FinishServerLaunch(server_window);
+            }
+            else if (tick - m_LaunchStartTick >= 10000)                                                                     //Wait 10 seconds max (should usually be faster though)
+            {
+                m_IsServerLaunching = false;
+                m_PendingState.Clear();
+
+                LOG_F(ERROR, "Desktop+ Browser process did not become ready in time");
+            }
+        }
+    }
+
+    FlushCommands();
+}
+
+void DPBrowserAPIClient::FlushCommands()
+{
+    if (m_CommandEncoder.IsEmpty())
+        return;
+
+    //Don't call IsServerRunning() here, it may apply pending settings and end up in here again. Callers of the API functions have checked already
+    if (m_ServerWindowHandle == nullptr)
+    {
+        m_CommandEncoder.Clear();
+        return;
+    }
+
+    const unsigned char* data = m_CommandEncoder.GetData();
+    const DWORD data_size     = (DWORD)m_CommandEncoder.GetSize();
+    bool use_ring = true;
+
+    //The browser process is launched unelevated from an elevated dashboard process and can't open the shared memory, so WM_COPYDATA is used for everything then
+    #ifndef DPLUS_UI
+        use_ring = !ConfigManager::Get().GetValue(configid_bool_state_misc_process_elevated);
+    #endif
+
+    if ( (use_ring) && (m_CommandRing.Write(data, data_size)) )
+    {
+        ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_command_stream_wake, ::GetCurrentProcessId());
+    }
+    else    //Ring not available or full, send it directly
+    {
+        HWND source_window = nullptr;
+        #ifdef DPLUS_UI
+            if (UIManager* uimgr = UIManager::Get())
+            {
+                source_window = uimgr->GetWindowHandle();
+            }
+        #else
+            if (OutputManager* outmgr = OutputManager::Get())
+            {
+                source_window = OutputManager::Get()->GetWindowHandle();
+            }
+        #endif
+
+        COPYDATASTRUCT cds = {0};
+        cds.dwData = dpbrowser_ipcdata_command_stream;
+        cds.cbData = data_size;
+        cds.lpData = (void*)data;
+
+        ::SendMessage(m_ServerWindowHandle, WM_COPYDATA, (WPARAM)source_window, (LPARAM)(LPVOID)&cds);
+    }
+
+    m_CommandEncoder.Clear();
+}
+
 void DPBrowserAPIClient::DPBrowser_StartBrowser(vr::VROverlayHandle_t overlay_handle, const std::string& url, bool use_transparent_background)
 {
     if (!LaunchServerIfNotRunning())
+    {
+        if (m_IsServerLaunching)
+        {
+            m_PendingState.StartBrowser(overlay_handle, url, use_transparent_background);    //Replayed once the server is ready
+        }
         return;
+    }
 
-    SendStringMessage(dpbrowser_ipcstr_url, url);
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_overlay_target, overlay_handle);
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_start_browser, use_transparent_background);
+    SendCommand(dpbrowser_ipccmd_start_browser, overlay_handle, use_transparent_background, url);
 }
 
 void DPBrowserAPIClient::DPBrowser_DuplicateBrowserOutput(vr::VROverlayHandle_t overlay_handle_src, vr::VROverlayHandle_t overlay_handle_dst)
 {
     if (!LaunchServerIfNotRunning())
+    {
+        if (m_IsServerLaunching)
+        {
+            m_PendingState.DuplicateBrowserOutput(overlay_handle_src, overlay_handle_dst);
+        }
         return;
+    }
 
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_overlay_target, overlay_handle_src);
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_duplicate_browser_output, overlay_handle_dst);
+    SendCommand(dpbrowser_ipccmd_duplicate_browser_output, overlay_handle_src, (int64_t)overlay_handle_dst);
 }
 
 void DPBrowserAPIClient::DPBrowser_PauseBrowser(vr::VROverlayHandle_t overlay_handle, bool pause)
 {
     if (!LaunchServerIfNotRunning())
+    {
+        if (m_IsServerLaunching)
+        {
+            m_PendingState.SetPause(overlay_handle, pause);
+        }
         return;
+    }
 
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_overlay_target, overlay_handle);
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_pause_browser, pause);
+    SendCommand(dpbrowser_ipccmd_pause_browser, overlay_handle, pause);
 }
 
 void DPBrowserAPIClient::DPBrowser_RecreateBrowser(vr::VROverlayHandle_t overlay_handle, bool use_transparent_background)
 {
     if (!LaunchServerIfNotRunning())
+    {
+        if (m_IsServerLaunching)
+        {
+            m_PendingState.RecreateBrowser(overlay_handle, use_transparent_background);
+        }
         return;
+    }
 
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_overlay_target, overlay_handle);
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_recreate_browser, use_transparent_background);
+    SendCommand(dpbrowser_ipccmd_recreate_browser, overlay_handle, use_transparent_background);
 }
 
 void DPBrowserAPIClient::DPBrowser_StopBrowser(vr::VROverlayHandle_t overlay_handle)
 {
     if (!IsServerRunning())
+    {
+        if (m_IsServerLaunching)
+        {
+            m_PendingState.StopBrowser(overlay_handle);
+        }
         return;
+    }
 
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_stop_browser, overlay_handle);
+    SendCommand(dpbrowser_ipccmd_stop_browser, overlay_handle, 0);
 }
 
 void DPBrowserAPIClient::DPBrowser_SetURL(vr::VROverlayHandle_t overlay_handle, const std::string& url)
 {
     if (!LaunchServerIfNotRunning())
+    {
+        if (m_IsServerLaunching)
+        {
+            m_PendingState.SetURL(overlay_handle, url);
+        }
         return;
+    }
 
-    SendStringMessage(dpbrowser_ipcstr_url, url);
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_url, overlay_handle);
+    SendCommand(dpbrowser_ipccmd_set_url, overlay_handle, 0, url);
 }
 
 void DPBrowserAPIClient::DPBrowser_SetResolution(vr::VROverlayHandle_t overlay_handle, int width, int height)
 {
     if (!LaunchServerIfNotRunning())
+    {
+        if (m_IsServerLaunching)
+        {
+            m_PendingState.SetResolution(overlay_handle, width, height);
+        }
         return;
+    }
 
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_overlay_target, overlay_handle);
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_resoution, MAKELPARAM(width, height));
+    //Only the last resolution matters, so this is coalesced with other changes happening before the next flush
+    QueueCommand(dpbrowser_ipccmd_set_resoution, overlay_handle, MAKELPARAM(width, height), dpbrowser_cmdcoalesce_replace);
 }
 
 void DPBrowserAPIClient::DPBrowser_SetFPS(vr::VROverlayHandle_t overlay_handle, int fps)
 {
     if (!LaunchServerIfNotRunning())
+    {
+        if (m_IsServerLaunching)
+        {
+            m_PendingState.SetFPS(overlay_handle, fps);
+        }
         return;
+    }
 
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_overlay_target, overlay_handle);
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_fps, fps);
+    SendCommand(dpbrowser_ipccmd_set_fps, overlay_handle, fps);
 }
 
 void DPBrowserAPIClient::DPBrowser_SetZoomLevel(vr::VROverlayHandle_t overlay_handle, float zoom_level)
 {
     if (!LaunchServerIfNotRunning())
+    {
+        if (m_IsServerLaunching)
+        {
+            m_PendingState.SetZoomLevel(overlay_handle, zoom_level);
+        }
         return;
+    }
 
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_overlay_target, overlay_handle);
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_zoom, pun_cast<LPARAM, float>(zoom_level));
+    SendCommand(dpbrowser_ipccmd_set_zoom, overlay_handle, pun_cast<LPARAM, float>(zoom_level));
 }
 
 void DPBrowserAPIClient::DPBrowser_SetOverUnder3D(vr::VROverlayHandle_t overlay_handle, bool is_over_under_3D, int crop_x, int crop_y, int crop_width, int crop_height)
 {
-    if (!LaunchServerIfNotRunning())
-        return;
-
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_overlay_target, overlay_handle);
+    LPARAM crop_value = -1;
 
     if (is_over_under_3D)
     {
         DPRect dp_rect(crop_x, crop_y, crop_x + crop_width, crop_y + crop_height);
-        ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_ou3d_crop, (LPARAM)dp_rect.Pack16());
+        crop_value = (LPARAM)dp_rect.Pack16();
     }
-    else
+
+    if (!LaunchServerIfNotRunning())
     {
-        ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_ou3d_crop, -1);
+        if (m_IsServerLaunching)
+        {
+            m_PendingState.SetOU3DCrop(overlay_handle, crop_value);
+        }
+        return;
     }
+
+    SendCommand(dpbrowser_ipccmd_set_ou3d_crop, overlay_handle, crop_value);
 }
 
 void DPBrowserAPIClient::DPBrowser_MouseMove(vr::VROverlayHandle_t overlay_handle, int x, int y)
@@ -510,8 +877,8 @@ void DPBrowserAPIClient::DPBrowser_MouseMove(vr::VROverlayHandle_t overlay_handl
     if (!IsServerRunning())
         return;
 
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_overlay_target, overlay_handle);
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_mouse_move, MAKELPARAM(x, y));
+    //Called every frame while pointing at a browser overlay, so only the last position before the next flush is sent
+    QueueCommand(dpbrowser_ipccmd_mouse_move, overlay_handle, MAKELPARAM(x, y), dpbrowser_cmdcoalesce_replace);
 }
 
 void DPBrowserAPIClient::DPBrowser_MouseLeave(vr::VROverlayHandle_t overlay_handle)
@@ -519,7 +886,7 @@ void DPBrowserAPIClient::DPBrowser_MouseLeave(vr::VROverlayHandle_t overlay_hand
     if (!IsServerRunning())
         return;
 
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_mouse_leave, overlay_handle);
+    SendCommand(dpbrowser_ipccmd_mouse_leave, overlay_handle, 0);
 }
 
 void DPBrowserAPIClient::DPBrowser_MouseDown(vr::VROverlayHandle_t overlay_handle, vr::EVRMouseButton button)
@@ -527,8 +894,7 @@ void DPBrowserAPIClient::DPBrowser_MouseDown(vr::VROverlayHandle_t overlay_handl
     if (!IsServerRunning())
         return;
 
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_overlay_target, overlay_handle);
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_mouse_down, button);
+    SendCommand(dpbrowser_ipccmd_mouse_down, overlay_handle, button);
 }
 
 void DPBrowserAPIClient::DPBrowser_MouseUp(vr::VROverlayHandle_t overlay_handle, vr::EVRMouseButton button)
@@ -536,8 +902,7 @@ void DPBrowserAPIClient::DPBrowser_MouseUp(vr::VROverlayHandle_t overlay_handle,
     if (!IsServerRunning())
         return;
 
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_overlay_target, overlay_handle);
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_mouse_up, button);
+    SendCommand(dpbrowser_ipccmd_mouse_up, overlay_handle, button);
 }
 
 void DPBrowserAPIClient::DPBrowser_Scroll(vr::VROverlayHandle_t overlay_handle, float x_delta, float y_delta)
@@ -549,8 +914,8 @@ void DPBrowserAPIClient::DPBrowser_Scroll(vr::VROverlayHandle_t overlay_handle,
     DWORD x_delta_uint = pun_cast<DWORD, float>(x_delta);
     DWORD y_delta_uint = pun_cast<DWORD, float>(y_delta);
 
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_overlay_target, overlay_handle);
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_scroll, MAKEQWORD(x_delta_uint, y_delta_uint));
+    //Smooth scrolling sends deltas every frame, they're summed up until the next flush
+    QueueCommand(dpbrowser_ipccmd_scroll, overlay_handle, MAKEQWORD(x_delta_uint, y_delta_uint), dpbrowser_cmdcoalesce_add_float2);
 }
 
 void DPBrowserAPIClient::DPBrowser_KeyboardSetKeyState(vr::VROverlayHandle_t overlay_handle, DPBrowserIPCKeyboardKeystateFlags flags, unsigned char keycode)
@@ -558,8 +923,7 @@ void DPBrowserAPIClient::DPBrowser_KeyboardSetKeyState(vr::VROverlayHandle_t ove
     if (!LaunchServerIfNotRunning())
         return;
 
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_overlay_target, overlay_handle);
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_keyboard_vkey, MAKELPARAM(flags, keycode));
+    SendCommand(dpbrowser_ipccmd_keyboard_vkey, overlay_handle, MAKELPARAM(flags, keycode));
 }
 
 void DPBrowserAPIClient::DPBrowser_KeyboardToggleKey(vr::VROverlayHandle_t overlay_handle, unsigned char keycode)
@@ -567,8 +931,7 @@ void DPBrowserAPIClient::DPBrowser_KeyboardToggleKey(vr::VROverlayHandle_t overl
     if (!LaunchServerIfNotRunning())
         return;
 
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_overlay_target, overlay_handle);
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_keyboard_vkey_toggle, keycode);
+    SendCommand(dpbrowser_ipccmd_keyboard_vkey_toggle, overlay_handle, keycode);
 }
 
 void DPBrowserAPIClient::DPBrowser_KeyboardTypeWChar(vr::VROverlayHandle_t overlay_handle, wchar_t wchar, bool down)
@@ -576,14 +939,15 @@ void DPBrowserAPIClient::DPBrowser_KeyboardTypeWChar(vr::VROverlayHandle_t overl
     if (!LaunchServerIfNotRunning())
         return;
 
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_set_overlay_target, overlay_handle);
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_keyboard_wchar, MAKELPARAM(wchar, down));
+    SendCommand(dpbrowser_ipccmd_keyboard_wchar, overlay_handle, MAKELPARAM(wchar, down));
 }
 
 void DPBrowserAPIClient::DPBrowser_KeyboardTypeString(vr::VROverlayHandle_t overlay_handle, const std::string& str)
 {
-    SendStringMessage(dpbrowser_ipcstr_keyboard_string, str);
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_keyboard_string, overlay_handle);
+    if (!LaunchServerIfNotRunning())
+        return;
+
+    SendCommand(dpbrowser_ipccmd_keyboard_string, overlay_handle, 0, str);
 }
 
 void DPBrowserAPIClient::DPBrowser_GoBack(vr::VROverlayHandle_t overlay_handle)
@@ -591,7 +955,7 @@ void DPBrowserAPIClient::DPBrowser_GoBack(vr::VROverlayHandle_t overlay_handle)
     if (!LaunchServerIfNotRunning())
         return;
 
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_go_back, overlay_handle);
+    SendCommand(dpbrowser_ipccmd_go_back, overlay_handle, 0);
 }
 
 void DPBrowserAPIClient::DPBrowser_GoForward(vr::VROverlayHandle_t overlay_handle)
@@ -599,7 +963,7 @@ void DPBrowserAPIClient::DPBrowser_GoForward(vr::VROverlayHandle_t overlay_handl
     if (!LaunchServerIfNotRunning())
         return;
 
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_go_forward, overlay_handle);
+    SendCommand(dpbrowser_ipccmd_go_forward, overlay_handle, 0);
 }
 
 void DPBrowserAPIClient::DPBrowser_Refresh(vr::VROverlayHandle_t overlay_handle)
@@ -607,7 +971,7 @@ void DPBrowserAPIClient::DPBrowser_Refresh(vr::VROverlayHandle_t overlay_handle)
     if (!LaunchServerIfNotRunning())
         return;
 
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_refresh, overlay_handle);
+    SendCommand(dpbrowser_ipccmd_refresh, overlay_handle, 0);
 }
 
 void DPBrowserAPIClient::DPBrowser_GlobalSetFPS(int fps)
@@ -618,7 +982,7 @@ void DPBrowserAPIClient::DPBrowser_GlobalSetFPS(int fps)
         return;
     }
 
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_global_set_fps, fps);
+    SendCommand(dpbrowser_ipccmd_global_set_fps, vr::k_ulOverlayHandleInvalid, fps);
 }
 
 void DPBrowserAPIClient::DPBrowser_ContentBlockSetEnabled(bool enable)
@@ -629,7 +993,7 @@ void DPBrowserAPIClient::DPBrowser_ContentBlockSetEnabled(bool enable)
         return;
     }
 
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_cblock_set_enabled, enable);
+    SendCommand(dpbrowser_ipccmd_cblock_set_enabled, vr::k_ulOverlayHandleInvalid, enable);
 }
 
 void DPBrowserAPIClient::DPBrowser_ErrorPageSetStrings(const std::string& title, const std::string& heading, const std::string& message)
@@ -640,9 +1004,22 @@ void DPBrowserAPIClient::DPBrowser_ErrorPageSetStrings(const std::string& title,
         return;
     }
 
-    SendStringMessage(dpbrowser_ipcstr_tstr_error_title,   title);
-    SendStringMessage(dpbrowser_ipcstr_tstr_error_heading, heading);
-    SendStringMessage(dpbrowser_ipcstr_tstr_error_message, message);
+    if (!m_UseCommandStream)
+    {
+        SendStringMessage(dpbrowser_ipcstr_tstr_error_title,   title);
+        SendStringMessage(dpbrowser_ipcstr_tstr_error_heading, heading);
+        SendStringMessage(dpbrowser_ipcstr_tstr_error_message, message);
+
+        ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_error_set_strings, 0);
+        return;
+    }
+
+    //All three strings in one payload, separated by NUL
+    std::string payload = title;
+    payload += '\0';
+    payload += heading;
+    payload += '\0';
+    payload += message;
 
-    ::PostMessage(m_ServerWindowHandle, m_Win32MessageID, dpbrowser_ipccmd_error_set_strings, 0);
+    SendCommand(dpbrowser_ipccmd_error_set_strings, vr::k_ulOverlayHandleInvalid, 0, payload);
 }
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "DPBrowserAPI.h"
+#include "DPBrowserCommandStream.h"
+#include "DPBrowserPendingState.h"
 
 class DPBrowserAPIClient : public DPBrowserAPI
 {
@@ -9,18 +11,43 @@ class DPBrowserAPIClient : public DPBrowserAPI
         bool m_HasServerAPIMismatch = false;
         HWND m_ServerWindowHandle = nullptr;
         UINT m_Win32MessageID = 0;
+        bool m_UseCommandStream = false;                        //Set if the server supports the command stream, commands are sent as API version 5 window messages otherwise
+
+        //Launch state, the server process is launched without waiting for it to be ready
+        bool m_IsServerLaunching = false;
+        ULONGLONG m_LaunchStartTick = 0;
+        ULONGLONG m_LaunchPollTick = 0;
+        DWORD m_LaunchProcessID = 0;                            //0 if unknown (launched via shell)
+        DPBrowserPendingState m_PendingState;                   //State changes issued while launching, replayed once ready
 
         std::string m_IPCStrings[dpbrowser_ipcstr_MAX - dpbrowser_ipcstr_MIN];
         vr::VROverlayHandle_t m_IPCOverlayTarget = vr::k_ulOverlayHandleInvalid;
 
+        //Commands are collected here and sent as one block on flush
+        DPBrowserCommandEncoder m_CommandEncoder;
+        DPBrowserCommandRing m_CommandRing;
+        HANDLE m_CommandRingMapping = nullptr;
+        void* m_CommandRingMemory = nullptr;
+
         //Pending settings stored here when server isn't running yet and applied later on launch
         int m_PendingSettingGlobalFPS = -1;
         int m_PendingSettingContentBlockEnabled = -1;
         bool m_PendingTranslationStrings = true;
 
         bool LaunchServerIfNotRunning();                        //Should be called and checked for in most API implementations, also makes sure m_ServerWindowHandle is updated
+                                                                //Returns false while the server is still launching, state changes should be stored in m_PendingState then
         bool IsServerRunning();                                 //Also makes sure m_ServerWindowHandle is updated
+        void FinishServerLaunch(HWND server_window);            //Checks API version and replays pending state
+        int QueryServerAPIVersion() const;
+        void ReplayPendingState();
         void ApplyPendingSettings();
+        void InitCommandRing();
+        void ResetCommandRing();                                //Called when the server window changed
+        void QueueCommand(DPBrowserICPCommandID command_id, vr::VROverlayHandle_t overlay_handle, int64_t value, 
+                          DPBrowserCmdCoalesceMode coalesce_mode = dpbrowser_cmdcoalesce_none); //Sent on next flush, coalesced with the overlay's previous command if possible
+        void QueueCommand(DPBrowserICPCommandID command_id, vr::VROverlayHandle_t overlay_handle, int64_t value, const std::string& payload);
+        void SendCommand(DPBrowserICPCommandID command_id, vr::VROverlayHandle_t overlay_handle, int64_t value, const std::string& payload = "");  //Flushes right away
+        void SendLegacyCommand(DPBrowserICPCommandID command_id, vr::VROverlayHandle_t overlay_handle, int64_t value, const std::string& payload); //Sends as window messages
         void SendStringMessage(DPBrowserICPStringID str_id, const std::string& str) const;
 
         std::string& GetIPCString(DPBrowserICPStringID str_id); //Abstracts the minimum string ID away when acccessing m_IPCStrings
@@ -35,6 +62,8 @@ class DPBrowserAPIClient : public DPBrowserAPI
         UINT GetRegisteredMessageID() const;
 
         void HandleIPCMessage(const MSG& msg);
+        void Update();                                          //Finishes server launch when it's ready and flushes commands. Called once per frame
+        void FlushCommands();                                   //Sends queued commands to the browser process. Called by Update(), but also after every command not queued for coalescing
 
         //DPBrowserAPI:
         virtual void DPBrowser_StartBrowser(vr::VROverlayHandle_t overlay_handle, const std::string& url, bool use_transparent_background) override;
@@ -0,0 +1,318 @@
+#include "DPBrowserCommandStream.h"
+
+#include <cstring>
+#include <new>
+#include <algorithm>
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "Ring positions need to be lock-free to be shared between processes");
+
+//Record data is kept 8-byte aligned so the headers can be read in-place
+static size_t DPBrowserCmdAlign8(size_t size)
+{
+    return (size + 7) & ~size_t(7);
+}
+
+
+DPBrowserCommandEncoder::DPBrowserCommandEncoder()
+{
+    Clear();
+}
+
+size_t DPBrowserCommandEncoder::FindLastRecordOffset(uint64_t overlay_handle) const
+{
+    auto it = std::find_if(m_LastRecordOffsets.begin(), m_LastRecordOffsets.end(), [&](const auto& entry){ return (entry.first == overlay_handle); });
+
+    return (it != m_LastRecordOffsets.end()) ? it->second : 0;
+}
+
+void DPBrowserCommandEncoder::AddRecord(uint32_t command_id, uint64_t overlay_handle, int64_t value, const char* payload, uint32_t payload_size)
+{
+    const size_t offset = m_Buffer.size();
+    m_Buffer.resize(offset + sizeof(DPBrowserCmdRecordHeader) + DPBrowserCmdAlign8(payload_size), 0);
+
+    DPBrowserCmdRecordHeader record_header;
+    record_header.CommandID     = command_id;
+    record_header.PayloadSize   = payload_size;
+    record_header.OverlayHandle = overlay_handle;
+    record_header.Value         = value;
+
+    memcpy(&m_Buffer[offset], &record_header, sizeof(record_header));
+
+    if (payload_size != 0)
+    {
+        memcpy(&m_Buffer[offset + sizeof(record_header)], payload, payload_size);
+    }
+
+    m_RecordCount++;
+
+    //Remember as last record for this overlay
+    auto it = std::find_if(m_LastRecordOffsets.begin(), m_LastRecordOffsets.end(), [&](const auto& entry){ return (entry.first == overlay_handle); });
+
+    if (it != m_LastRecordOffsets.end())
+    {
+        it->second = offset;
+    }
+    else
+    {
+        m_LastRecordOffsets.emplace_back(overlay_handle, offset);
+    }
+}
+
+void DPBrowserCommandEncoder::Add(uint32_t command_id, uint64_t overlay_handle, int64_t value, DPBrowserCmdCoalesceMode coalesce_mode)
+{
+    if (coalesce_mode != dpbrowser_cmdcoalesce_none)
+    {
+        const size_t offset = FindLastRecordOffset(overlay_handle);
+
+        if (offset != 0)
+        {
+            DPBrowserCmdRecordHeader* record_header = (DPBrowserCmdRecordHeader*)&m_Buffer[offset];
+
+            if (record_header->CommandID == command_id)
+            {
+                if (coalesce_mode == dpbrowser_cmdcoalesce_add_float2)
+                {
+                    uint32_t prev_lo = uint32_t(uint64_t(record_header->Value) & 0xFFFFFFFF), prev_hi = uint32_t(uint64_t(record_header->Value) >> 32);
+                    uint32_t new_lo  = uint32_t(uint64_t(value) & 0xFFFFFFFF),                new_hi  = uint32_t(uint64_t(value) >> 32);
+                    float prev_x, prev_y, new_x, new_y;
+
+                    memcpy(&prev_x, &prev_lo, sizeof(float));
+                    memcpy(&prev_y, &prev_hi, sizeof(float));
+                    memcpy(&new_x,  &new_lo,  sizeof(float));
+                    memcpy(&new_y,  &new_hi,  sizeof(float));
+
+                    prev_x += new_x;
+                    prev_y += new_y;
+
+                    memcpy(&prev_lo, &prev_x, sizeof(float));
+                    memcpy(&prev_hi, &prev_y, sizeof(float));
+
+                    record_header->Value = int64_t(uint64_t(prev_lo) | (uint64_t(prev_hi) << 32));
+                }
+                else
+                {
+                    record_header->Value = value;
+                }
+
+                return;
+            }
+        }
+    }
+
+    AddRecord(command_id, overlay_handle, value, nullptr, 0);
+}
+
+void DPBrowserCommandEncoder::Add(uint32_t command_id, uint64_t overlay_handle, int64_t value, const std::string& payload)
+{
+    AddRecord(command_id, overlay_handle, value, payload.data(), (uint32_t)payload.size());
+}
+
+bool DPBrowserCommandEncoder::IsEmpty() const
+{
+    return (m_RecordCount == 0);
+}
+
+uint32_t DPBrowserCommandEncoder::GetRecordCount() const
+{
+    return m_RecordCount;
+}
+
+const unsigned char* DPBrowserCommandEncoder::GetData()
+{
+    DPBrowserCmdStreamHeader stream_header;
+    stream_header.Magic       = k_DPBrowserCmdStreamMagic;
+    stream_header.Version     = k_DPBrowserCmdStreamVersion;
+    stream_header.RecordCount = m_RecordCount;
+    stream_header.Size        = uint32_t(m_Buffer.size() - sizeof(DPBrowserCmdStreamHeader));
+
+    memcpy(m_Buffer.data(), &stream_header, sizeof(stream_header));
+
+    return m_Buffer.data();
+}
+
+size_t DPBrowserCommandEncoder::GetSize() const
+{
+    return m_Buffer.size();
+}
+
+void DPBrowserCommandEncoder::Clear()
+{
+    m_Buffer.assign(sizeof(DPBrowserCmdStreamHeader), 0);
+    m_RecordCount = 0;
+    m_LastRecordOffsets.clear();
+}
+
+
+DPBrowserCommandDecoder::DPBrowserCommandDecoder(const void* data, size_t size) : m_Data((const unsigned char*)data), m_Size(size), m_Offset(sizeof(DPBrowserCmdStreamHeader)),
+                                                                                    m_RecordCount(0), m_IsValid(false)
+{
+    if ( (m_Data == nullptr) || (m_Size < sizeof(DPBrowserCmdStreamHeader)) )
+        return;
+
+    DPBrowserCmdStreamHeader stream_header;
+    memcpy(&stream_header, m_Data, sizeof(stream_header));
+
+    if ( (stream_header.Magic != k_DPBrowserCmdStreamMagic) || (stream_header.Version != k_DPBrowserCmdStreamVersion) ||
+         (stream_header.Size > m_Size - sizeof(DPBrowserCmdStreamHeader)) )
+    {
+        return;
+    }
+
+    //Ignore anything past the size stated in the header
+    m_Size        = sizeof(DPBrowserCmdStreamHeader) + stream_header.Size;
+    m_RecordCount = stream_header.RecordCount;
+    m_IsValid     = true;
+}
+
+bool DPBrowserCommandDecoder::IsValid() const
+{
+    return m_IsValid;
+}
+
+uint32_t DPBrowserCommandDecoder::GetRecordCount() const
+{
+    return m_RecordCount;
+}
+
+bool DPBrowserCommandDecoder::Next(DPBrowserCmdRecord& record)
+{
+    if ( (!m_IsValid) || (m_Size - m_Offset < sizeof(DPBrowserCmdRecordHeader)) )
+        return false;
+
+    DPBrowserCmdRecordHeader record_header;
+    memcpy(&record_header, m_Data + m_Offset, sizeof(record_header));
+
+    const size_t payload_size_padded = DPBrowserCmdAlign8(record_header.PayloadSize);
+
+    if (payload_size_padded > m_Size - m_Offset - sizeof(record_header))
+    {
+        m_IsValid = false;  //Truncated, don't read further
+        return false;
+    }
+
+    record.CommandID     = record_header.CommandID;
+    record.OverlayHandle = record_header.OverlayHandle;
+    record.Value         = record_header.Value;
+    record.Payload       = (record_header.PayloadSize != 0) ? (const char*)(m_Data + m_Offset + sizeof(record_header)) : nullptr;
+    record.PayloadSize   = record_header.PayloadSize;
+
+    m_Offset += sizeof(record_header) + payload_size_padded;
+
+    return true;
+}
+
+
+void DPBrowserCommandRing::CopyIn(uint64_t pos, const void* src, uint32_t size)
+{
+    const uint32_t capacity = m_Header->Capacity;
+    const uint32_t start    = uint32_t(pos % capacity);
+    const uint32_t size_1   = std::min(size, capacity - start);
+
+    memcpy(m_Data + start, src, size_1);
+    memcpy(m_Data, (const unsigned char*)src + size_1, size - size_1);
+}
+
+void DPBrowserCommandRing::CopyOut(uint64_t pos, void* dst, uint32_t size) const
+{
+    const uint32_t capacity = m_Header->Capacity;
+    const uint32_t start    = uint32_t(pos % capacity);
+    const uint32_t size_1   = std::min(size, capacity - start);
+
+    memcpy(dst, m_Data + start, size_1);
+    memcpy((unsigned char*)dst + size_1, m_Data, size - size_1);
+}
+
+size_t DPBrowserCommandRing::GetRequiredMemorySize(uint32_t capacity)
+{
+    return sizeof(DPBrowserCmdRingHeader) + capacity;
+}
+
+void DPBrowserCommandRing::Init(void* memory, uint32_t capacity)
+{
+    m_Header = new (memory) DPBrowserCmdRingHeader;
+    m_Data   = (unsigned char*)memory + sizeof(DPBrowserCmdRingHeader);
+
+    m_Header->Magic    = k_DPBrowserCmdStreamMagic;
+    m_Header->Version  = k_DPBrowserCmdStreamVersion;
+    m_Header->Capacity = capacity;
+    m_Header->Padding  = 0;
+    m_Header->ReadPos.store(0, std::memory_order_relaxed);
+    m_Header->WritePos.store(0, std::memory_order_release);
+}
+
+bool DPBrowserCommandRing::Attach(void* memory, size_t memory_size)
+{
+    m_Header = nullptr;
+    m_Data   = nullptr;
+
+    if ( (memory == nullptr) || (memory_size < sizeof(DPBrowserCmdRingHeader)) )
+        return false;
+
+    DPBrowserCmdRingHeader* header = (DPBrowserCmdRingHeader*)memory;
+
+    if ( (header->Magic != k_DPBrowserCmdStreamMagic) || (header->Version != k_DPBrowserCmdStreamVersion) || (header->Capacity == 0) ||
+         (GetRequiredMemorySize(header->Capacity) > memory_size) )
+    {
+        return false;
+    }
+
+    m_Header = header;
+    m_Data   = (unsigned char*)memory + sizeof(DPBrowserCmdRingHeader);
+
+    return true;
+}
+
+bool DPBrowserCommandRing::IsValid() const
+{
+    return (m_Header != nullptr);
+}
+
+bool DPBrowserCommandRing::Write(const void* data, uint32_t size)
+{
+    if (m_Header == nullptr)
+        return false;
+
+    const uint64_t write_pos = m_Header->WritePos.load(std::memory_order_relaxed);
+    const uint64_t read_pos  = m_Header->ReadPos.load(std::memory_order_acquire);
+    const uint64_t required  = sizeof(uint32_t) + (uint64_t)size;
+
+    if (m_Header->Capacity - (write_pos - read_pos) < required)
+        return false;
+
+    //Blocks are stored as length + data
+    CopyIn(write_pos, &size, sizeof(uint32_t));
+    CopyIn(write_pos + sizeof(uint32_t), data, size);
+
+    m_Header->WritePos.store(write_pos + required, std::memory_order_release);
+
+    return true;
+}
+
+bool DPBrowserCommandRing::Read(std::vector<unsigned char>& block)
+{
+    if (m_Header == nullptr)
+        return false;
+
+    const uint64_t read_pos  = m_Header->ReadPos.load(std::memory_order_relaxed);
+    const uint64_t write_pos = m_Header->WritePos.load(std::memory_order_acquire);
+
+    if (write_pos - read_pos < sizeof(uint32_t))
+        return false;
+
+    uint32_t size = 0;
+    CopyOut(read_pos, &size, sizeof(uint32_t));
+
+    //Skip everything if the producer wrote a broken length somehow
+    if (write_pos - read_pos - sizeof(uint32_t) < size)
+    {
+        m_Header->ReadPos.store(write_pos, std::memory_order_release);
+        return false;
+    }
+
+    block.resize(size);
+    CopyOut(read_pos + sizeof(uint32_t), block.data(), size);
+
+    m_Header->ReadPos.store(read_pos + sizeof(uint32_t) + size, std::memory_order_release);
+
+    return true;
+}
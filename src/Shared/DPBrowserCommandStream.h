@@ -0,0 +1,119 @@
+//Versioned binary command stream used to send batched commands to the Desktop+ Browser process
+//Every record carries its target overlay handle, so there is no state like dpbrowser_ipccmd_set_overlay_target to keep in sync between commands.
+//This file doesn't depend on any platform headers. The transport (shared memory ring + wake message) is handled by DPBrowserAPIClient and the browser process.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <atomic>
+
+static const uint32_t k_DPBrowserCmdStreamMagic   = 0x53434244;     //"DBCS"
+static const uint32_t k_DPBrowserCmdStreamVersion = 1;
+
+struct DPBrowserCmdStreamHeader
+{
+    uint32_t Magic;
+    uint32_t Version;
+    uint32_t RecordCount;
+    uint32_t Size;                                  //Size of the records following the header in bytes
+};
+
+struct DPBrowserCmdRecordHeader
+{
+    uint32_t CommandID;
+    uint32_t PayloadSize;                           //Size of the payload following the record header. Padded to 8 bytes in the stream
+    uint64_t OverlayHandle;
+    int64_t  Value;
+};
+
+enum DPBrowserCmdCoalesceMode
+{
+    dpbrowser_cmdcoalesce_none,                     //Always adds a new record
+    dpbrowser_cmdcoalesce_replace,                  //Replaces the value of the overlay's last record if it has the same command ID
+    dpbrowser_cmdcoalesce_add_float2                //Adds both floats packed in value (low/high dword order) to the overlay's last record if it has the same command ID
+};
+
+//Decoded record. Payload points into the buffer passed to the decoder
+struct DPBrowserCmdRecord
+{
+    uint32_t CommandID     = 0;
+    uint64_t OverlayHandle = 0;
+    int64_t Value          = 0;
+    const char* Payload    = nullptr;
+    uint32_t PayloadSize   = 0;
+};
+
+class DPBrowserCommandEncoder
+{
+    private:
+        std::vector<unsigned char> m_Buffer;                            //Stream header + records
+        uint32_t m_RecordCount = 0;
+        std::vector<std::pair<uint64_t, size_t>> m_LastRecordOffsets;  //Overlay handle + buffer offset of the last record targeting it
+
+        size_t FindLastRecordOffset(uint64_t overlay_handle) const;    //Returns 0 if there is none (0 is the stream header)
+        void AddRecord(uint32_t command_id, uint64_t overlay_handle, int64_t value, const char* payload, uint32_t payload_size);
+
+    public:
+        DPBrowserCommandEncoder();
+
+        //Superseded records are only coalesced with the last record targeting the same overlay, so ordering relative to other commands on that overlay is kept
+        void Add(uint32_t command_id, uint64_t overlay_handle, int64_t value, DPBrowserCmdCoalesceMode coalesce_mode = dpbrowser_cmdcoalesce_none);
+        void Add(uint32_t command_id, uint64_t overlay_handle, int64_t value, const std::string& payload);
+
+        bool IsEmpty() const;
+        uint32_t GetRecordCount() const;
+        const unsigned char* GetData();                                 //Updates the stream header before returning, valid until the next call to Add() or Clear()
+        size_t GetSize() const;
+        void Clear();
+};
+
+class DPBrowserCommandDecoder
+{
+    private:
+        const unsigned char* m_Data;
+        size_t m_Size;
+        size_t m_Offset;
+        uint32_t m_RecordCount;
+        bool m_IsValid;
+
+    public:
+        DPBrowserCommandDecoder(const void* data, size_t size);
+
+        bool IsValid() const;                       //False if magic, version or size in the stream header are wrong
+        uint32_t GetRecordCount() const;
+        bool Next(DPBrowserCmdRecord& record);      //Returns false when there are no more records or the next one is malformed
+};
+
+//Single-producer single-consumer ring of stream blocks, placed in memory shared between the client and browser process
+struct DPBrowserCmdRingHeader
+{
+    uint32_t Magic;
+    uint32_t Version;
+    uint32_t Capacity;                              //Size of the data area following the header in bytes
+    uint32_t Padding;
+    std::atomic<uint64_t> WritePos;                 //Only written by the producer
+    std::atomic<uint64_t> ReadPos;                  //Only written by the consumer
+};
+
+class DPBrowserCommandRing
+{
+    private:
+        DPBrowserCmdRingHeader* m_Header = nullptr;
+        unsigned char* m_Data = nullptr;
+
+        void CopyIn(uint64_t pos, const void* src, uint32_t size);
+        void CopyOut(uint64_t pos, void* dst, uint32_t size) const;
+
+    public:
+        static size_t GetRequiredMemorySize(uint32_t capacity);
+
+        void Init(void* memory, uint32_t capacity); //Called by producer, resets the ring
+        bool Attach(void* memory, size_t memory_size);  //Called by consumer, validates the header written by the producer
+        bool IsValid() const;
+
+        bool Write(const void* data, uint32_t size);    //Returns false if there's not enough free space, nothing is written then
+        bool Read(std::vector<unsigned char>& block);   //Returns false if the ring is empty
+};
@@ -0,0 +1,123 @@
+#include "DPBrowserPendingState.h"
+
+#include <algorithm>
+
+DPBrowserPendingOverlayState& DPBrowserPendingState::GetState(uint64_t overlay_handle)
+{
+    auto it = std::find_if(m_States.begin(), m_States.end(), [&](const auto& state){ return (state.OverlayHandle == overlay_handle); });
+
+    if (it != m_States.end())
+        return *it;
+
+    m_States.emplace_back();
+    m_States.back().OverlayHandle = overlay_handle;
+
+    return m_States.back();
+}
+
+void DPBrowserPendingState::StartBrowser(uint64_t overlay_handle, const std::string& url, bool use_transparent_background)
+{
+    DPBrowserPendingOverlayState& state = GetState(overlay_handle);
+
+    state.HasStart                 = true;
+    state.StartURL                 = url;
+    state.UseTransparentBackground = use_transparent_background;
+
+    //Start already has the URL
+    state.HasURL = false;
+    state.URL.clear();
+}
+
+void DPBrowserPendingState::DuplicateBrowserOutput(uint64_t overlay_handle_src, uint64_t overlay_handle_dst)
+{
+    DPBrowserPendingOverlayState& state = GetState(overlay_handle_dst);
+
+    state.HasDuplicationSource    = true;
+    state.DuplicationSourceHandle = overlay_handle_src;
+}
+
+void DPBrowserPendingState::RecreateBrowser(uint64_t overlay_handle, bool use_transparent_background)
+{
+    auto it = std::find_if(m_States.begin(), m_States.end(), [&](const auto& state){ return (state.OverlayHandle == overlay_handle); });
+
+    if ( (it != m_States.end()) && (it->HasStart) )
+    {
+        it->UseTransparentBackground = use_transparent_background;
+    }
+}
+
+void DPBrowserPendingState::StopBrowser(uint64_t overlay_handle)
+{
+    m_States.erase(std::remove_if(m_States.begin(), m_States.end(), [&](const auto& state){ return (state.OverlayHandle == overlay_handle); }), m_States.end());
+}
+
+void DPBrowserPendingState::SetURL(uint64_t overlay_handle, const std::string& url)
+{
+    DPBrowserPendingOverlayState& state = GetState(overlay_handle);
+
+    if (state.HasStart)
+    {
+        state.StartURL = url;
+    }
+    else
+    {
+        state.HasURL = true;
+        state.URL    = url;
+    }
+}
+
+void DPBrowserPendingState::SetResolution(uint64_t overlay_handle, int width, int height)
+{
+    DPBrowserPendingOverlayState& state = GetState(overlay_handle);
+
+    state.HasResolution = true;
+    state.Width         = width;
+    state.Height        = height;
+}
+
+void DPBrowserPendingState::SetFPS(uint64_t overlay_handle, int fps)
+{
+    DPBrowserPendingOverlayState& state = GetState(overlay_handle);
+
+    state.HasFPS = true;
+    state.FPS    = fps;
+}
+
+void DPBrowserPendingState::SetZoomLevel(uint64_t overlay_handle, float zoom_level)
+{
+    DPBrowserPendingOverlayState& state = GetState(overlay_handle);
+
+    state.HasZoomLevel = true;
+    state.ZoomLevel    = zoom_level;
+}
+
+void DPBrowserPendingState::SetOU3DCrop(uint64_t overlay_handle, int64_t crop_value)
+{
+    DPBrowserPendingOverlayState& state = GetState(overlay_handle);
+
+    state.HasOU3DCrop   = true;
+    state.OU3DCropValue = crop_value;
+}
+
+void DPBrowserPendingState::SetPause(uint64_t overlay_handle, bool pause)
+{
+    DPBrowserPendingOverlayState& state = GetState(overlay_handle);
+
+    state.HasPause = true;
+    state.Pause    = pause;
+}
+
+bool DPBrowserPendingState::IsEmpty() const
+{
+    return m_States.empty();
+}
+
+void DPBrowserPendingState::Clear()
+{
+    m_States.clear();
+}
+
+const std::vector<DPBrowserPendingOverlayState>& DPBrowserPendingState::GetStates() const
+{
+    return m_States;
+}
@@ -0,0 +1,68 @@
+//Collects browser state changes issued while the browser process is still starting up, compacted to the latest state per overlay
+//Only the end result of the calls matters for replaying once the process is ready, so repeated changes to the same setting only keep the last value.
+//Transient input (mouse, keyboard, navigation) isn't stored, there's no page to send it to yet.
+//This file doesn't depend on any platform headers, DPBrowserAPIClient turns the stored state into commands.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct DPBrowserPendingOverlayState
+{
+    uint64_t OverlayHandle = 0;
+
+    bool HasStart = false;                          //Browser is started with StartURL and UseTransparentBackground, URL changes are merged into StartURL then
+    std::string StartURL;
+    bool UseTransparentBackground = false;
+
+    bool HasDuplicationSource = false;              //Overlay duplicates another browser overlay's output
+    uint64_t DuplicationSourceHandle = 0;
+
+    bool HasURL = false;
+    std::string URL;
+
+    bool HasResolution = false;
+    int Width  = 0;
+    int Height = 0;
+
+    bool HasFPS = false;
+    int FPS = 0;
+
+    bool HasZoomLevel = false;
+    float ZoomLevel = 1.0f;
+
+    bool HasOU3DCrop = false;
+    int64_t OU3DCropValue = -1;                     //As sent with dpbrowser_ipccmd_set_ou3d_crop
+
+    bool HasPause = false;
+    bool Pause = false;
+};
+
+class DPBrowserPendingState
+{
+    private:
+        std::vector<DPBrowserPendingOverlayState> m_States;     //In order of first appearance
+
+        DPBrowserPendingOverlayState& GetState(uint64_t overlay_handle);
+
+    public:
+        void StartBrowser(uint64_t overlay_handle, const std::string& url, bool use_transparent_background);
+        void DuplicateBrowserOutput(uint64_t overlay_handle_src, uint64_t overlay_handle_dst);
+        void RecreateBrowser(uint64_t overlay_handle, bool use_transparent_background);    //Only changes a pending start, as there's nothing to recreate yet otherwise
+        void StopBrowser(uint64_t overlay_handle);                                         //Drops everything pending for the overlay
+
+        void SetURL(uint64_t overlay_handle, const std::string& url);
+        void SetResolution(uint64_t overlay_handle, int width, int height);
+        void SetFPS(uint64_t overlay_handle, int fps);
+        void SetZoomLevel(uint64_t overlay_handle, float zoom_level);
+        void SetOU3DCrop(uint64_t overlay_handle, int64_t crop_value);
+        void SetPause(uint64_t overlay_handle, bool pause);
+
+        bool IsEmpty() const;
+        void Clear();
+
+        //States should be replayed in order, but starts before duplications and duplications before anything else, so sources exist when they're needed
+        const std::vector<DPBrowserPendingOverlayState>& GetStates() const;
+};
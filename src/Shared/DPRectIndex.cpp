@@ -0,0 +1,124 @@
+#include "DPRectIndex.h"
+
+#include <algorithm>
+#include <cmath>
+
+void DPRectIndex::Build(const std::vector<DPRect>& rects)
+{
+    Clear();
+    m_Rects = rects;
+
+    //Get bounds, ignoring empty or inverted rects as they can't contain anything
+    bool has_bounds = false;
+
+    for (const auto& rect : m_Rects)
+    {
+        if ( (rect.Min.x >= rect.Max.x) || (rect.Min.y >= rect.Max.y) )
+            continue;
+
+        if (!has_bounds)
+        {
+            m_Bounds = rect;
+            has_bounds = true;
+        }
+        else
+        {
+            m_Bounds.Add(rect);
+        }
+    }
+
+    if (!has_bounds)
+        return;
+
+    //Roughly two cells per rect on each axis, but keep the grid small as mask rects are usually large
+    const int cell_count = std::max(1, std::min(int(std::ceil(std::sqrt((float)m_Rects.size()))) * 2, 64));
+    const long long bounds_width  = (long long)m_Bounds.Max.x - m_Bounds.Min.x;
+    const long long bounds_height = (long long)m_Bounds.Max.y - m_Bounds.Min.y;
+
+    m_CellCountX = (int)std::min<long long>(cell_count, bounds_width);
+    m_CellCountY = (int)std::min<long long>(cell_count, bounds_height);
+    m_CellWidth  = (int)((bounds_width  + m_CellCountX - 1) / m_CellCountX);
+    m_CellHeight = (int)((bounds_height + m_CellCountY - 1) / m_CellCountY);
+
+    //Count entries per cell first, then fill them in a second pass so all entries end up in one array
+    m_CellOffsets.assign(m_CellCountX * m_CellCountY + 1, 0);
+
+    auto for_each_cell = [&](const DPRect& rect, auto func)
+    {
+        const int x_start = (int)(((long long)rect.Min.x - m_Bounds.Min.x) / m_CellWidth);
+        const int y_start = (int)(((long long)rect.Min.y - m_Bounds.Min.y) / m_CellHeight);
+        const int x_end   = (int)(((long long)rect.Max.x - 1 - m_Bounds.Min.x) / m_CellWidth);   //Max is exclusive
+        const int y_end   = (int)(((long long)rect.Max.y - 1 - m_Bounds.Min.y) / m_CellHeight);
+
+        for (int y = y_start; y <= y_end; ++y)
+        {
+            for (int x = x_start; x <= x_end; ++x)
+            {
+                func(y * m_CellCountX + x);
+            }
+        }
+    };
+
+    for (const auto& rect : m_Rects)
+    {
+        if ( (rect.Min.x >= rect.Max.x) || (rect.Min.y >= rect.Max.y) )
+            continue;
+
+        for_each_cell(rect, [&](int cell_id){ m_CellOffsets[cell_id + 1]++; });
+    }
+
+    for (size_t i = 1; i < m_CellOffsets.size(); ++i)
+    {
+        m_CellOffsets[i] += m_CellOffsets[i - 1];
+    }
+
+    m_CellRectIDs.resize(m_CellOffsets.back());
+    std::vector<int> cell_fill(m_CellOffsets.begin(), m_CellOffsets.end() - 1);
+
+    for (int i = 0; i < (int)m_Rects.size(); ++i)
+    {
+        const DPRect& rect = m_Rects[i];
+
+        if ( (rect.Min.x >= rect.Max.x) || (rect.Min.y >= rect.Max.y) )
+            continue;
+
+        for_each_cell(rect, [&](int cell_id){ m_CellRectIDs[cell_fill[cell_id]++] = i; });
+    }
+}
+
+void DPRectIndex::Clear()
+{
+    m_Rects.clear();
+    m_CellOffsets.clear();
+    m_CellRectIDs.clear();
+    m_Bounds     = DPRect();
+    m_CellCountX = 0;
+    m_CellCountY = 0;
+    m_CellWidth  = 1;
+    m_CellHeight = 1;
+}
+
+bool DPRectIndex::Contains(const Vector2Int& point) const
+{
+    if ( (m_CellCountX == 0) || (!m_Bounds.Contains(point)) )
+        return false;
+
+    const int x = (int)(((long long)point.x - m_Bounds.Min.x) / m_CellWidth);
+    const int y = (int)(((long long)point.y - m_Bounds.Min.y) / m_CellHeight);
+    const int cell_id = y * m_CellCountX + x;
+
+    for (int i = m_CellOffsets[cell_id], i_end = m_CellOffsets[cell_id + 1]; i < i_end; ++i)
+    {
+        if (m_Rects[m_CellRectIDs[i]].Contains(point))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+const std::vector<DPRect>& DPRectIndex::GetRects() const
+{
+    return m_Rects;
+}
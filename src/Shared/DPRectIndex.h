@@ -0,0 +1,29 @@
+//Uniform grid over a set of rectangles for fast point-in-any-rectangle tests, used for the laser pointer intersection masks
+//The grid covers the bounding box of all rectangles and each cell lists the rectangles overlapping it, so a hit test only looks at a handful of candidates.
+//Results are identical to testing every rectangle with DPRect::Contains(). Building is meant to be done only when the rectangle set actually changes.
+
+#pragma once
+
+#include <vector>
+
+#include "DPRect.h"
+
+class DPRectIndex
+{
+    private:
+        std::vector<DPRect> m_Rects;
+        std::vector<int> m_CellOffsets;             //Start of each cell's entries in m_CellRectIDs, with one extra entry at the end
+        std::vector<int> m_CellRectIDs;             //Indices into m_Rects, grouped by cell
+        DPRect m_Bounds;
+        int m_CellCountX = 0;
+        int m_CellCountY = 0;
+        int m_CellWidth  = 1;
+        int m_CellHeight = 1;
+
+    public:
+        void Build(const std::vector<DPRect>& rects);
+        void Clear();
+
+        bool Contains(const Vector2Int& point) const;
+        const std::vector<DPRect>& GetRects() const;    //Rects the index was built from
+};
@@ -35,6 +35,7 @@ char const* ini_section_name( ini_t const* ini, int section );
 int ini_property_count( ini_t const* ini, int section );
 char const* ini_property_name( ini_t const* ini, int section, int property );
 char const* ini_property_value( ini_t const* ini, int section, int property );
+void ini_property_list( ini_t const* ini, int section, char const** names, char const** values );
 
 int ini_find_section( ini_t const* ini, char const* name, int name_length );
 int ini_find_property( ini_t const* ini, int section, char const* name, int name_length );
@@ -272,6 +273,28 @@ std::vector<std::string> Ini::GetSectionList()
 
     return section_list;
 }
+
+std::vector<std::pair<std::string, std::string>> Ini::GetKeyValueList(const char* section) const
+{
+    std::vector<std::pair<std::string, std::string>> key_value_list;
+    int section_id = ini_find_section(m_IniPtr, section, 0);
+
+    if (section_id != INI_NOT_FOUND)
+    {
+        const int property_count = ini_property_count(m_IniPtr, section_id);
+        std::vector<const char*> names(property_count), values(property_count);
+        ini_property_list(m_IniPtr, section_id, names.data(), values.data());
+
+        key_value_list.reserve(property_count);
+
+        for (int i = 0; i < property_count; ++i)
+        {
+            key_value_list.emplace_back(names[i], values[i]);
+        }
+    }
+
+    return key_value_list;
+}
 //C++ Interface end. Below is normal ini.h code
 
 /**
@@ -473,6 +496,16 @@ less than the value returned by `ini_section_count`, or `ini_section_name` will
 `name=value`.
 
 
+ini_property_list
+-----------------
+
+    void ini_property_list( ini_t const* ini, int section, char const** names, char const** values )
+
+Desktop+: Fills `names` and `values`, which need to hold `ini_property_count` entries, with all properties of the section 
+with the specified index `section` in a single pass. Using `ini_property_name` and `ini_property_value` for every index
+instead has to search the property list on each call.
+
+
 ini_property_name
 -----------------
 
@@ -955,6 +988,27 @@ char const* ini_property_value( ini_t const* ini, int section, int property )
     }
 
 
+void ini_property_list( ini_t const* ini, int section, char const** names, char const** values )
+    {
+    int i;
+    int p;
+
+    if( ini && section >= 0 && section < ini->section_count )
+        {
+        p = 0;
+        for( i = 0; i < ini->property_count; ++i )
+            {
+            if( ini->properties[ i ].section == section )
+                {
+                names[ p ] = ini->properties[ i ].name_large ? ini->properties[ i ].name_large : ini->properties[ i ].name;
+                values[ p ] = ini->properties[ i ].value_large ? ini->properties[ i ].value_large : ini->properties[ i ].value;
+                ++p;
+                }
+            }
+        }
+    }
+
+
 int ini_find_section( ini_t const* ini, char const* name, int name_length )
     {
     int i;
@@ -1228,7 +1282,8 @@ contributors:
     Branimir Karadzic (INI_STRNICMP bugfix)
 
 revision history:
-    Desktop+    apply WSSDude's return of wrong sections and properties by find functions fix, fix reading empty properties,
+    Desktop+    add ini_property_list for listing a section's properties in one pass,
+                apply WSSDude's return of wrong sections and properties by find functions fix, fix reading empty properties,
                 fix characters past ASCII range to be detected as whitespace, fix wrong index deleting long property names/values,
                 fix whitespace-only property values causing the rest of the file to be used instead, allow trailing whitespace in property values
     1.2         using strnicmp for correct length compares, fixed copy-paste bug in ini_property_value_set
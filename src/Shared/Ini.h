@@ -4,6 +4,7 @@
 
 #include <string>
 #include <vector>
+#include <utility>
 
 typedef struct ini_t ini_t;
 
@@ -35,4 +36,5 @@ class Ini
         void RemoveKey(const char* section, const char* key);
 
         std::vector<std::string> GetSectionList();
+        std::vector<std::pair<std::string, std::string>> GetKeyValueList(const char* section) const;    //All keys and values of a section in file order
 };
\ No newline at end of file
@@ -297,6 +297,66 @@ Matrix4& Matrix4::invertEuclidean()
 ///////////////////////////////////////////////////////////////////////////////
 Matrix4& Matrix4::invertAffine()
 {
+#ifdef MATRICES_USE_SSE
+    // rows of R^-1 are the cross products of R's columns divided by the determinant, same math as Matrix3::invert()
+    const __m128 c0 = _mm_loadu_ps(&m[0]);
+    const __m128 c1 = _mm_loadu_ps(&m[4]);
+    const __m128 c2 = _mm_loadu_ps(&m[8]);
+
+    auto cross = [](__m128 a, __m128 b)
+    {
+        const __m128 a_yzx = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+        const __m128 b_yzx = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+        const __m128 a_zxy = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 1, 0, 2));
+        const __m128 b_zxy = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 1, 0, 2));
+        return _mm_sub_ps(_mm_mul_ps(a_yzx, b_zxy), _mm_mul_ps(a_zxy, b_yzx));
+    };
+
+    __m128 r0 = cross(c1, c2);
+    __m128 r1 = cross(c2, c0);
+    __m128 r2 = cross(c0, c1);
+
+    float det_parts[4];
+    _mm_storeu_ps(det_parts, _mm_mul_ps(c0, r0));
+    const float determinant = det_parts[0] + det_parts[1] + det_parts[2];
+
+    const float w0 = m[3], w1 = m[7], w2 = m[11];
+    __m128 r3 = _mm_setzero_ps();
+
+    if(fabs(determinant) <= EPSILON)
+    {
+        // cannot inverse, rotation part becomes identity
+        r0 = _mm_set_ps(0.0f, 0.0f, 0.0f, 1.0f);
+        r1 = _mm_set_ps(0.0f, 0.0f, 1.0f, 0.0f);
+        r2 = _mm_set_ps(0.0f, 1.0f, 0.0f, 0.0f);
+    }
+    else
+    {
+        const __m128 inv_determinant = _mm_set1_ps(1.0f / determinant);
+        r0 = _mm_mul_ps(inv_determinant, r0);
+        r1 = _mm_mul_ps(inv_determinant, r1);
+        r2 = _mm_mul_ps(inv_determinant, r2);
+    }
+
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+    // -R^-1 * T
+    __m128 t = _mm_mul_ps(r0, _mm_set1_ps(m[12]));
+    t = _mm_add_ps(t, _mm_mul_ps(r1, _mm_set1_ps(m[13])));
+    t = _mm_add_ps(t, _mm_mul_ps(r2, _mm_set1_ps(m[14])));
+    t = _mm_xor_ps(t, _mm_set1_ps(-0.0f));
+
+    const float w3 = m[15];
+    _mm_storeu_ps(&m[0],  r0);
+    _mm_storeu_ps(&m[4],  r1);
+    _mm_storeu_ps(&m[8],  r2);
+    _mm_storeu_ps(&m[12], t);
+
+    // last row should be unchanged (0,0,0,1)
+    m[3] = w0;  m[7] = w1;  m[11] = w2;  m[15] = w3;
+
+    return *this;
+#else
     // R^-1
     Matrix3 r(m[0],m[1],m[2], m[4],m[5],m[6], m[8],m[9],m[10]);
     r.invert();
@@ -317,6 +377,7 @@ Matrix4& Matrix4::invertAffine()
     //m[15] = 1.0f;
 
     return * this;
+#endif
 }
 
 
@@ -466,6 +527,22 @@ float Matrix4::getDeterminant()
 
 vr::HmdMatrix34_t Matrix4::toOpenVR34() const
 {
+#ifdef MATRICES_USE_SSE
+    vr::HmdMatrix34_t matrixObj;
+
+    // columns become rows of the 3x4 matrix, last row is dropped
+    __m128 c0 = _mm_loadu_ps(&m[0]);
+    __m128 c1 = _mm_loadu_ps(&m[4]);
+    __m128 c2 = _mm_loadu_ps(&m[8]);
+    __m128 c3 = _mm_loadu_ps(&m[12]);
+    _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+    _mm_storeu_ps(matrixObj.m[0], c0);
+    _mm_storeu_ps(matrixObj.m[1], c1);
+    _mm_storeu_ps(matrixObj.m[2], c2);
+
+    return matrixObj;
+#else
     vr::HmdMatrix34_t matrixObj = {0};
     matrixObj.m[0][0] = m[0];
     matrixObj.m[1][0] = m[1];
@@ -481,6 +558,7 @@ vr::HmdMatrix34_t Matrix4::toOpenVR34() const
     matrixObj.m[2][3] = m[14];
 
     return matrixObj;
+#endif
 }
 
 std::string Matrix4::toString() const
@@ -26,6 +26,12 @@
 #include "Vectors.h"
 #include "openvr.h"
 
+// Desktop+: SSE paths for the Matrix4 operations used every frame, results are the same as the scalar code they replace
+#if defined(_M_X64) || defined(__SSE2__)
+    #define MATRICES_USE_SSE
+    #include <xmmintrin.h>
+#endif
+
 ///////////////////////////////////////////////////////////////////////////
 // 2x2 matrix
 ///////////////////////////////////////////////////////////////////////////
@@ -685,12 +691,26 @@ inline Matrix4::Matrix4(float m00, float m01, float m02, float m03,
 
 inline Matrix4::Matrix4(const vr::HmdMatrix34_t& src)
 {
+#ifdef MATRICES_USE_SSE
+    // rows of the 3x4 matrix become columns
+    __m128 r0 = _mm_loadu_ps(src.m[0]);
+    __m128 r1 = _mm_loadu_ps(src.m[1]);
+    __m128 r2 = _mm_loadu_ps(src.m[2]);
+    __m128 r3 = _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f);
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+    _mm_storeu_ps(&m[0],  r0);
+    _mm_storeu_ps(&m[4],  r1);
+    _mm_storeu_ps(&m[8],  r2);
+    _mm_storeu_ps(&m[12], r3);
+#else
     set(
         src.m[0][0], src.m[1][0], src.m[2][0], 0.0f,
         src.m[0][1], src.m[1][1], src.m[2][1], 0.0f,
         src.m[0][2], src.m[1][2], src.m[2][2], 0.0f,
         src.m[0][3], src.m[1][3], src.m[2][3], 1.0f
         );
+#endif
 }
 
 inline Matrix4::Matrix4(const Vector3& right, const Vector3& up, const Vector3& forward)
@@ -878,29 +898,70 @@ inline Matrix4& Matrix4::operator-=(const Matrix4& rhs)
 
 inline Vector4 Matrix4::operator*(const Vector4& rhs) const
 {
+#ifdef MATRICES_USE_SSE
+    __m128 r = _mm_mul_ps(_mm_loadu_ps(&m[0]), _mm_set1_ps(rhs.x));
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_loadu_ps(&m[4]),  _mm_set1_ps(rhs.y)));
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_loadu_ps(&m[8]),  _mm_set1_ps(rhs.z)));
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_loadu_ps(&m[12]), _mm_set1_ps(rhs.w)));
+
+    float v[4];
+    _mm_storeu_ps(v, r);
+    return Vector4(v[0], v[1], v[2], v[3]);
+#else
     return Vector4(m[0]*rhs.x + m[4]*rhs.y + m[8]*rhs.z  + m[12]*rhs.w,
                    m[1]*rhs.x + m[5]*rhs.y + m[9]*rhs.z  + m[13]*rhs.w,
                    m[2]*rhs.x + m[6]*rhs.y + m[10]*rhs.z + m[14]*rhs.w,
                    m[3]*rhs.x + m[7]*rhs.y + m[11]*rhs.z + m[15]*rhs.w);
+#endif
 }
 
 
 
 inline Vector3 Matrix4::operator*(const Vector3& rhs) const
 {
+#ifdef MATRICES_USE_SSE
+    __m128 r = _mm_mul_ps(_mm_loadu_ps(&m[0]), _mm_set1_ps(rhs.x));
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_loadu_ps(&m[4]), _mm_set1_ps(rhs.y)));
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_loadu_ps(&m[8]), _mm_set1_ps(rhs.z)));
+
+    float v[4];
+    _mm_storeu_ps(v, r);
+    return Vector3(v[0], v[1], v[2]);
+#else
     return Vector3(m[0]*rhs.x + m[4]*rhs.y + m[8]*rhs.z,
                    m[1]*rhs.x + m[5]*rhs.y + m[9]*rhs.z,
                    m[2]*rhs.x + m[6]*rhs.y + m[10]*rhs.z);
+#endif
 }
 
 
 
 inline Matrix4 Matrix4::operator*(const Matrix4& n) const
 {
+#ifdef MATRICES_USE_SSE
+    // each column of the result is a linear combination of this matrix's columns
+    const __m128 c0 = _mm_loadu_ps(&m[0]);
+    const __m128 c1 = _mm_loadu_ps(&m[4]);
+    const __m128 c2 = _mm_loadu_ps(&m[8]);
+    const __m128 c3 = _mm_loadu_ps(&m[12]);
+    float result[16];
+
+    for(int i = 0; i < 16; i += 4)
+    {
+        __m128 r = _mm_mul_ps(c0, _mm_set1_ps(n[i]));
+        r = _mm_add_ps(r, _mm_mul_ps(c1, _mm_set1_ps(n[i + 1])));
+        r = _mm_add_ps(r, _mm_mul_ps(c2, _mm_set1_ps(n[i + 2])));
+        r = _mm_add_ps(r, _mm_mul_ps(c3, _mm_set1_ps(n[i + 3])));
+        _mm_storeu_ps(&result[i], r);
+    }
+
+    return Matrix4(result);
+#else
     return Matrix4(m[0]*n[0]  + m[4]*n[1]  + m[8]*n[2]  + m[12]*n[3],   m[1]*n[0]  + m[5]*n[1]  + m[9]*n[2]  + m[13]*n[3],   m[2]*n[0]  + m[6]*n[1]  + m[10]*n[2]  + m[14]*n[3],   m[3]*n[0]  + m[7]*n[1]  + m[11]*n[2]  + m[15]*n[3],
                    m[0]*n[4]  + m[4]*n[5]  + m[8]*n[6]  + m[12]*n[7],   m[1]*n[4]  + m[5]*n[5]  + m[9]*n[6]  + m[13]*n[7],   m[2]*n[4]  + m[6]*n[5]  + m[10]*n[6]  + m[14]*n[7],   m[3]*n[4]  + m[7]*n[5]  + m[11]*n[6]  + m[15]*n[7],
                    m[0]*n[8]  + m[4]*n[9]  + m[8]*n[10] + m[12]*n[11],  m[1]*n[8]  + m[5]*n[9]  + m[9]*n[10] + m[13]*n[11],  m[2]*n[8]  + m[6]*n[9]  + m[10]*n[10] + m[14]*n[11],  m[3]*n[8]  + m[7]*n[9]  + m[11]*n[10] + m[15]*n[11],
                    m[0]*n[12] + m[4]*n[13] + m[8]*n[14] + m[12]*n[15],  m[1]*n[12] + m[5]*n[13] + m[9]*n[14] + m[13]*n[15],  m[2]*n[12] + m[6]*n[13] + m[10]*n[14] + m[14]*n[15],  m[3]*n[12] + m[7]*n[13] + m[11]*n[14] + m[15]*n[15]);
+#endif
 }
 
 
@@ -6,6 +6,8 @@
 #include "Matrices.h"
 #include "Util.h"
 #include "COMWrapper.h"
+#include "TrackedPoseSnapshot.h"
+#include "OverlayStateMirror.h"
 
 namespace vr
 {
@@ -52,13 +54,13 @@ namespace vr
         if (device_index >= k_unMaxTrackedDeviceCount)
             return false;
 
-        TrackedDevicePose_t poses[k_unMaxTrackedDeviceCount];
-        VRSystem()->GetDeviceToAbsoluteTrackingPose(tracking_origin, IVRSystemEx::GetTimeNowToPhotons(), poses, k_unMaxTrackedDeviceCount);
+        //This is called for every pointer device and overlay, so only the device's pose is taken from the frame's snapshot instead of fetching all of them each time
+        const TrackedDevicePose_t pose = TrackedPoseSnapshot::Get().GetPose(device_index, tracking_origin);
 
-        if (!poses[device_index].bPoseIsValid)
+        if (!pose.bPoseIsValid)
             return false;
 
-        Matrix4 mat_device = poses[device_index].mDeviceToAbsoluteTracking;
+        Matrix4 mat_device = pose.mDeviceToAbsoluteTracking;
 
         if (use_tip_offset)
         {
@@ -421,7 +423,7 @@ namespace vr
             }
         }
 
-        return VROverlay()->DestroyOverlay(overlay_handle);
+        return OverlayStateMirror::Get().DestroyOverlay(overlay_handle);
     }
 
 
@@ -456,15 +458,31 @@ namespace vr
                    pos.x,    pos.y,    pos.z,    1.0f };
     }
 
+    void IVRSystemEx::TransformForceUpright(Matrix4& matrix)
+    {
+        //Based off of ComputeHMDFacingTransform()... might not be the best way to do it, but it works.
+        static const Vector3 up = {0.0f, 1.0f, 0.0f};
+
+        Matrix4 matrix_temp  = matrix;
+        Vector3 ovrl_start   = matrix_temp.translate_relative(0.0f, 0.0f, -0.001f).getTranslation();
+        Vector3 forward_temp = (ovrl_start - matrix.getTranslation()).normalize();
+        Vector3 right        = forward_temp.cross(up).normalize();
+        Vector3 forward      = up.cross(right).normalize();
+
+        Matrix4 mat_upright(right, up, forward * -1.0f);
+        mat_upright.setTranslation(ovrl_start);
+
+        matrix = mat_upright;
+    }
+
     Matrix4 IVRSystemEx::ComputeHMDFacingTransform(float distance)
     {
         //This is based on dashboard positioning code posted by Valve on the OpenVR GitHub
         static const Vector3 up = {0.0f, 1.0f, 0.0f};
 
-        TrackedDevicePose_t poses[k_unMaxTrackedDeviceCount];
-        VRSystem()->GetDeviceToAbsoluteTrackingPose(TrackingUniverseStanding, 0.0f /*don't predict anything here*/, poses, k_unMaxTrackedDeviceCount);
+        const TrackedDevicePose_t pose_hmd = TrackedPoseSnapshot::Get().GetPose(k_unTrackedDeviceIndex_Hmd, TrackingUniverseStanding, false /*don't predict anything here*/);
 
-        Matrix4 mat_hmd(poses[k_unTrackedDeviceIndex_Hmd].mDeviceToAbsoluteTracking);
+        Matrix4 mat_hmd(pose_hmd.mDeviceToAbsoluteTracking);
         mat_hmd.translate_relative(0.0f, 0.0f, 0.10f);
         Matrix4 mat_hmd_temp = mat_hmd;
 
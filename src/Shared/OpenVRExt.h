@@ -25,6 +25,9 @@ namespace vr
             //Rotate the matrix towards the given target position
             static void TransformLookAt(Matrix4& matrix, const Vector3 pos_target, const Vector3 up = {0.0f, 1.0f, 0.0f});
 
+            //Rotate the matrix so it's upright while keeping the direction it's facing
+            static void TransformForceUpright(Matrix4& matrix);
+
             //Returns transform similar to the dashboard transform (not a perfect match, though)
             static Matrix4 ComputeHMDFacingTransform(float distance);
 
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cassert>
+
+#include "ConfigManager.h"
+
+//Read-only view of a single overlay's config data, usable without switching the global current overlay via OverlayManager::SetCurrentOverlayID()
+//ConfigManager::GetValue() has to check at runtime if an ID is an overlay or global value and then look up the current overlay's data for every read.
+//The accessors here only take overlay IDs and are resolved to the right array by overload at compile-time, so they're a plain array read.
+//Views reference the overlay's config data directly and are invalidated by anything that adds, removes or swaps overlays, same as OverlayConfigData references
+class OverlayConfigView
+{
+    private:
+        unsigned int m_ID;
+        const OverlayConfigData& m_Data;
+
+    public:
+        OverlayConfigView(unsigned int id, const OverlayConfigData& data) : m_ID(id), m_Data(data) {}
+
+        unsigned int GetID()               const { return m_ID; }
+        const OverlayConfigData& GetData() const { return m_Data; }
+
+        bool               GetValue(ConfigID_Bool   configid) const { assert(configid < configid_bool_overlay_MAX);   return m_Data.ConfigBool[configid];   }
+        int                GetValue(ConfigID_Int    configid) const { assert(configid < configid_int_overlay_MAX);    return m_Data.ConfigInt[configid];    }
+        float              GetValue(ConfigID_Float  configid) const { assert(configid < configid_float_overlay_MAX);  return m_Data.ConfigFloat[configid];  }
+        uint64_t           GetValue(ConfigID_Handle configid) const { assert(configid < configid_handle_overlay_MAX); return m_Data.ConfigHandle[configid]; }
+        const std::string& GetValue(ConfigID_String configid) const { assert(configid < configid_str_overlay_MAX);    return m_Data.ConfigStr[configid];    }
+
+        const Matrix4& GetTransform() const { return m_Data.ConfigTransform; }
+};
@@ -10,6 +10,8 @@
 #include "InterprocessMessaging.h"
 #include "Util.h"
 #include "OpenVRExt.h"
+#include "OverlayStateMirror.h"
+#include "TrackedPoseSnapshot.h"
 
 OverlayDragger::OverlayDragger() : 
     m_DragModeDeviceID(-1),
@@ -39,7 +41,7 @@ void OverlayDragger::DragStartBase(bool is_gesture_drag)
     vr::TrackedDeviceIndex_t device_index = ConfigManager::Get().GetPrimaryLaserPointerDevice();
 
     vr::TrackedDevicePose_t poses[vr::k_unMaxTrackedDeviceCount];
-    vr::VRSystem()->GetDeviceToAbsoluteTrackingPose(vr::TrackingUniverseStanding, vr::IVRSystemEx::GetTimeNowToPhotons(), poses, vr::k_unMaxTrackedDeviceCount);
+    TrackedPoseSnapshot::Get().GetPoses(poses);
 
     //We have no dashboard device, but something still started a drag, eh? This happens when the dashboard is closed but the overlays are still interactive
     //There doesn't seem to be a way to get around this, so we guess by checking which of the two hand controllers are currently pointing at the overlay
@@ -76,7 +78,7 @@ void OverlayDragger::DragStartBase(bool is_gesture_drag)
             {
                 if (poses[vr::k_unTrackedDeviceIndex_Hmd].bPoseIsValid)
                 {
-                    vr::VROverlay()->SetOverlayTransformAbsolute(m_DragModeOverlayHandle, vr::TrackingUniverseStanding, &poses[vr::k_unTrackedDeviceIndex_Hmd].mDeviceToAbsoluteTracking);
+                    OverlayStateMirror::Get().SetOverlayTransformAbsolute(m_DragModeOverlayHandle, vr::TrackingUniverseStanding, &poses[vr::k_unTrackedDeviceIndex_Hmd].mDeviceToAbsoluteTracking);
                 }
                 break;
             }
@@ -86,7 +88,7 @@ void OverlayDragger::DragStartBase(bool is_gesture_drag)
 
                 if ( (index_right_hand != vr::k_unTrackedDeviceIndexInvalid) && (poses[index_right_hand].bPoseIsValid) )
                 {
-                    vr::VROverlay()->SetOverlayTransformAbsolute(m_DragModeOverlayHandle, vr::TrackingUniverseStanding, &poses[index_right_hand].mDeviceToAbsoluteTracking);
+                    OverlayStateMirror::Get().SetOverlayTransformAbsolute(m_DragModeOverlayHandle, vr::TrackingUniverseStanding, &poses[index_right_hand].mDeviceToAbsoluteTracking);
                 }
                 break;
             }
@@ -96,7 +98,7 @@ void OverlayDragger::DragStartBase(bool is_gesture_drag)
 
                 if ( (index_left_hand != vr::k_unTrackedDeviceIndexInvalid) && (poses[index_left_hand].bPoseIsValid) )
                 {
-                    vr::VROverlay()->SetOverlayTransformAbsolute(m_DragModeOverlayHandle, vr::TrackingUniverseStanding, &poses[index_left_hand].mDeviceToAbsoluteTracking);
+                    OverlayStateMirror::Get().SetOverlayTransformAbsolute(m_DragModeOverlayHandle, vr::TrackingUniverseStanding, &poses[index_left_hand].mDeviceToAbsoluteTracking);
                 }
                 break;
             }
@@ -106,7 +108,7 @@ void OverlayDragger::DragStartBase(bool is_gesture_drag)
 
                 if ( (index_tracker != vr::k_unTrackedDeviceIndexInvalid) && (poses[index_tracker].bPoseIsValid) )
                 {
-                    vr::VROverlay()->SetOverlayTransformAbsolute(m_DragModeOverlayHandle, vr::TrackingUniverseStanding, &poses[index_tracker].mDeviceToAbsoluteTracking);
+                    OverlayStateMirror::Get().SetOverlayTransformAbsolute(m_DragModeOverlayHandle, vr::TrackingUniverseStanding, &poses[index_tracker].mDeviceToAbsoluteTracking);
                 }
                 break;
             }
@@ -114,7 +116,7 @@ void OverlayDragger::DragStartBase(bool is_gesture_drag)
 
         vr::HmdMatrix34_t transform_target;
         vr::TrackingUniverseOrigin origin;
-        vr::VROverlay()->GetOverlayTransformAbsolute(m_DragModeOverlayHandle, &origin, &transform_target);
+        OverlayStateMirror::Get().GetOverlayTransformAbsolute(m_DragModeOverlayHandle, &origin, &transform_target);
         m_DragModeMatrixTargetStart   = transform_target;
         m_DragModeMatrixTargetCurrent = m_DragModeMatrixTargetStart;
     }
@@ -143,29 +145,12 @@ void OverlayDragger::DragGestureStartBase()
     }
     else
     {
-        vr::VROverlay()->GetOverlayWidthInMeters(m_DragModeOverlayHandle, &m_DragGestureScaleWidthStart);
+        OverlayStateMirror::Get().GetOverlayWidthInMeters(m_DragModeOverlayHandle, &m_DragGestureScaleWidthStart);
     }
 
     m_DragGestureActive = true;
 }
 
-void OverlayDragger::TransformForceUpright(Matrix4& transform) const
-{
-    //Based off of ComputeHMDFacingTransform()... might not be the best way to do it, but it works.
-    static const Vector3 up = {0.0f, 1.0f, 0.0f};
-
-    Matrix4 matrix_temp  = transform;
-    Vector3 ovrl_start   = matrix_temp.translate_relative(0.0f, 0.0f, -0.001f).getTranslation();
-    Vector3 forward_temp = (ovrl_start - transform.getTranslation()).normalize();
-    Vector3 right        = forward_temp.cross(up).normalize();
-    Vector3 forward      = up.cross(right).normalize();
-
-    Matrix4 mat_upright(right, up, forward * -1.0f);
-    mat_upright.setTranslation(ovrl_start);
-
-    transform = mat_upright;
-}
-
 void OverlayDragger::TransformForceDistance(Matrix4& transform, Vector3 reference_pos, float distance, bool use_cylinder_shape, bool auto_tilt) const
 {
     //Match origin y-position to the overlay's to achieve cylindrical position (acts as sphere otherwise)
@@ -236,9 +221,12 @@ void OverlayDragger::TransformSnapRotation(Matrix4& transform, float degrees, bo
 
 Matrix4 OverlayDragger::GetBaseOffsetMatrix()
 {
-    const OverlayConfigData& data = OverlayManager::Get().GetCurrentConfigData();
+    return GetBaseOffsetMatrix(OverlayManager::Get().GetConfigView(OverlayManager::Get().GetCurrentOverlayID()));
+}
 
-    return GetBaseOffsetMatrix((OverlayOrigin)data.ConfigInt[configid_int_overlay_origin], OverlayManager::Get().GetOriginConfigFromData(data));
+Matrix4 OverlayDragger::GetBaseOffsetMatrix(const OverlayConfigView& config)
+{
+    return GetBaseOffsetMatrix((OverlayOrigin)config.GetValue(configid_int_overlay_origin), OverlayManager::Get().GetOriginConfigFromData(config.GetData()));
 }
 
 Matrix4 OverlayDragger::GetBaseOffsetMatrix(OverlayOrigin overlay_origin)
@@ -261,36 +249,18 @@ Matrix4 OverlayDragger::GetBaseOffsetMatrix(OverlayOrigin overlay_origin, const
         }
         case ovrl_origin_hmd_floor:
         {
-            vr::TrackedDevicePose_t poses[vr::k_unTrackedDeviceIndex_Hmd + 1];
-            vr::VRSystem()->GetDeviceToAbsoluteTrackingPose(universe_origin, vr::IVRSystemEx::GetTimeNowToPhotons(), poses, vr::k_unTrackedDeviceIndex_Hmd + 1);
-
-            if (poses[vr::k_unTrackedDeviceIndex_Hmd].bPoseIsValid)
-            {
-                Matrix4 mat_pose = poses[vr::k_unTrackedDeviceIndex_Hmd].mDeviceToAbsoluteTracking;
-                Vector3 pos_offset = mat_pose.getTranslation();
-
-                //Force HMD pose upright to have it act as turning-only base position
-                if (origin_config.HMDFloorUseTurning)
-                {
-                    matrix = mat_pose;
-                    TransformForceUpright(matrix);
-                }
-
-                pos_offset.y = 0.0f;
-                matrix.setTranslation(pos_offset);
-            }
+            matrix = TrackedPoseSnapshot::Get().GetHMDFloorMatrix(origin_config.HMDFloorUseTurning);
             break;
         }
         case ovrl_origin_seated_universe:
         {
-            matrix = vr::VRSystem()->GetSeatedZeroPoseToStandingAbsoluteTrackingPose();
+            matrix = TrackedPoseSnapshot::Get().GetSeatedZeroPoseMatrix();
             break;
         }
         case ovrl_origin_dashboard:
         {
             //Adjust behavior if GamepadUI (SteamVR 2 dashboard) exists
-            vr::VROverlayHandle_t handle_gamepad_ui = vr::k_ulOverlayHandleInvalid;
-            vr::VROverlay()->FindOverlay("valve.steam.gamepadui.bar", &handle_gamepad_ui);
+            const vr::VROverlayHandle_t handle_gamepad_ui = TrackedPoseSnapshot::Get().GetGamepadUIOverlayHandle();
 
             //Update dashboard transform if it's visible or we never set the dashboard matrix before (IsDashboardVisible() can return false while visible)
             if ( (vr::VROverlay()->IsDashboardVisible()) || (m_DashboardMatLast.isZero()) )
@@ -301,7 +271,7 @@ Matrix4 OverlayDragger::GetBaseOffsetMatrix(OverlayOrigin overlay_origin, const
                 if (handle_gamepad_ui != vr::k_ulOverlayHandleInvalid)
                 {
                     //Double-checking dashboard overlay visibility for the case when IsDashboardVisible() is false while it's actually visible
-                    if (vr::VROverlay()->IsOverlayVisible(handle_gamepad_ui))
+                    if (OverlayStateMirror::Get().IsOverlayVisible(handle_gamepad_ui))
                     {
                         vr::HmdMatrix34_t matrix_overlay_dashboard;
 
@@ -323,17 +293,12 @@ Matrix4 OverlayDragger::GetBaseOffsetMatrix(OverlayOrigin overlay_origin, const
                     //That dashboard lives on the systemui overlay which used to be okay, 
                     //but nowadays taking coordinates from it gives transforms for docking elements which may or may not currently be in the dashboard
                     //We do want to support operation on it still to some degree, so we take the seemingly only stable reference that's left: Our own dashboard tab
-                    vr::VROverlayHandle_t ovrl_handle_dplus;
-                    vr::VROverlay()->FindOverlay("elvissteinjr.DesktopPlusDashboard", &ovrl_handle_dplus);
+                    const vr::VROverlayHandle_t ovrl_handle_dplus = TrackedPoseSnapshot::Get().GetDPlusDashboardOverlayHandle();
 
-                    if ((ovrl_handle_dplus != vr::k_ulOverlayHandleInvalid) && (vr::VROverlay()->IsOverlayVisible(ovrl_handle_dplus)))
+                    if ((ovrl_handle_dplus != vr::k_ulOverlayHandleInvalid) && (OverlayStateMirror::Get().IsOverlayVisible(ovrl_handle_dplus)))
                     {
-                        vr::HmdMatrix34_t matrix_dplus_tab;
-                        vr::TrackingUniverseOrigin origin = vr::TrackingUniverseStanding;
-
-                        vr::VROverlay()->GetTransformForOverlayCoordinates(ovrl_handle_dplus, origin, {0.5f, 0.0f}, &matrix_dplus_tab);
-
-                        m_DashboardMatLast = matrix_dplus_tab;
+                        bool is_matrix_valid = false;
+                        m_DashboardMatLast = TrackedPoseSnapshot::Get().GetDPlusDashboardTabMatrix(is_matrix_valid);
 
                         if (m_DashboardHMD_Y == -100.0f)    //If Desktop+ was started with the dashboard open, the value will still be default, so set it now
                         {
@@ -386,35 +351,26 @@ Matrix4 OverlayDragger::GetBaseOffsetMatrix(OverlayOrigin overlay_origin, const
 
             if (device_index != vr::k_unTrackedDeviceIndexInvalid)
             {
-                vr::TrackedDevicePose_t poses[vr::k_unMaxTrackedDeviceCount];
-                vr::VRSystem()->GetDeviceToAbsoluteTrackingPose(universe_origin, vr::IVRSystemEx::GetTimeNowToPhotons(), poses, vr::k_unMaxTrackedDeviceCount);
+                const vr::TrackedDevicePose_t pose = TrackedPoseSnapshot::Get().GetPose(device_index, universe_origin);
 
-                if (poses[device_index].bPoseIsValid)
+                if (pose.bPoseIsValid)
                 {
-                    matrix = poses[device_index].mDeviceToAbsoluteTracking;
+                    matrix = pose.mDeviceToAbsoluteTracking;
                 }
             }
             break;
         }
         case ovrl_origin_dplus_tab:
         {
-            vr::VROverlayHandle_t ovrl_handle_dplus;
-            vr::VROverlay()->FindOverlay("elvissteinjr.DesktopPlusDashboard", &ovrl_handle_dplus);
+            bool is_matrix_valid = false;
+            const Matrix4 matrix_dplus_tab = TrackedPoseSnapshot::Get().GetDPlusDashboardTabMatrix(is_matrix_valid);
 
-            if (ovrl_handle_dplus != vr::k_ulOverlayHandleInvalid)
+            if (is_matrix_valid)
             {
-                vr::HmdMatrix34_t matrix_dplus_tab;
-                vr::TrackingUniverseOrigin origin = vr::TrackingUniverseStanding;
-
-                vr::VROverlay()->GetTransformForOverlayCoordinates(ovrl_handle_dplus, origin, {0.5f, 0.0f}, &matrix_dplus_tab);
-
                 matrix = matrix_dplus_tab;
 
                 //Additional offset if GamepadUI (SteamVR 2 dashboard) exists
-                vr::VROverlayHandle_t handle_gamepad_ui = vr::k_ulOverlayHandleInvalid;
-                vr::VROverlay()->FindOverlay("valve.steam.gamepadui.bar", &handle_gamepad_ui);
-
-                if (handle_gamepad_ui != vr::k_ulOverlayHandleInvalid)
+                if (TrackedPoseSnapshot::Get().GetGamepadUIOverlayHandle() != vr::k_ulOverlayHandleInvalid)
                 {
                     matrix.translate(0.0f, -0.05f, 0.0f);
                 }
@@ -479,7 +435,7 @@ void OverlayDragger::DragStart(vr::VROverlayHandle_t overlay_handle, OverlayOrig
 void OverlayDragger::DragUpdate()
 {
     vr::TrackedDevicePose_t poses[vr::k_unMaxTrackedDeviceCount];
-    vr::VRSystem()->GetDeviceToAbsoluteTrackingPose(vr::TrackingUniverseStanding, vr::IVRSystemEx::GetTimeNowToPhotons(), poses, vr::k_unMaxTrackedDeviceCount);
+    TrackedPoseSnapshot::Get().GetPoses(poses);
 
     if (poses[m_DragModeDeviceID].bPoseIsValid)
     {
@@ -498,7 +454,7 @@ void OverlayDragger::DragUpdate()
 
             //Set transform
             vr::HmdMatrix34_t vrmat = m_DragModeMatrixTargetCurrent.toOpenVR34();
-            vr::VROverlay()->SetOverlayTransformAbsolute(m_DragModeOverlayHandle, vr::TrackingUniverseStanding, &vrmat);
+            OverlayStateMirror::Get().SetOverlayTransformAbsolute(m_DragModeOverlayHandle, vr::TrackingUniverseStanding, &vrmat);
         }
         else
         {
@@ -584,7 +540,7 @@ void OverlayDragger::DragUpdate()
             }
 
             vr::HmdMatrix34_t vrmat = m_DragModeMatrixTargetCurrent.toOpenVR34();
-            vr::VROverlay()->SetOverlayTransformAbsolute(m_DragModeOverlayHandle, vr::TrackingUniverseStanding, &vrmat);
+            OverlayStateMirror::Get().SetOverlayTransformAbsolute(m_DragModeOverlayHandle, vr::TrackingUniverseStanding, &vrmat);
         }
     }
 }
@@ -607,7 +563,7 @@ void OverlayDragger::DragAddDistance(float distance)
     }
     else
     {
-        vr::VROverlay()->GetOverlayWidthInMeters(m_DragModeOverlayHandle, &overlay_width);
+        OverlayStateMirror::Get().GetOverlayWidthInMeters(m_DragModeOverlayHandle, &overlay_width);
 
         #ifdef DPLUS_UI
             if (UIManager* uimgr = UIManager::Get())
@@ -649,7 +605,7 @@ void OverlayDragger::DragAddDistance(float distance)
     else
     {
         vr::TrackedDevicePose_t poses[vr::k_unMaxTrackedDeviceCount];
-        vr::VRSystem()->GetDeviceToAbsoluteTrackingPose(vr::TrackingUniverseStanding, vr::IVRSystemEx::GetTimeNowToPhotons(), poses, vr::k_unMaxTrackedDeviceCount);
+        TrackedPoseSnapshot::Get().GetPoses(poses);
 
         if (poses[m_DragModeDeviceID].bPoseIsValid)
         {
@@ -685,7 +641,7 @@ float OverlayDragger::DragAddWidth(float width)
     }
     else
     {
-        vr::VROverlay()->GetOverlayWidthInMeters(m_DragModeOverlayHandle, &overlay_width);
+        OverlayStateMirror::Get().GetOverlayWidthInMeters(m_DragModeOverlayHandle, &overlay_width);
 
         overlay_width_min = 0.50f; //Usually used with ImGui window UI overlays, so use higher minimum width
     }
@@ -728,7 +684,7 @@ float OverlayDragger::DragAddWidth(float width)
     }
 
     overlay_width = std::min(overlay_width, m_DragModeMaxWidth);
-    vr::VROverlay()->SetOverlayWidthInMeters(m_DragModeOverlayHandle, overlay_width);
+    OverlayStateMirror::Get().SetOverlayWidthInMeters(m_DragModeOverlayHandle, overlay_width);
 
     if (m_DragModeOverlayID != k_ulOverlayID_None)
     {
@@ -765,7 +721,7 @@ Matrix4 OverlayDragger::DragFinish()
     vr::HmdMatrix34_t transform_target;
     vr::TrackingUniverseOrigin origin;
 
-    vr::VROverlay()->GetOverlayTransformAbsolute(m_DragModeOverlayHandle, &origin, &transform_target);
+    OverlayStateMirror::Get().GetOverlayTransformAbsolute(m_DragModeOverlayHandle, &origin, &transform_target);
     Matrix4 matrix_target_finish = transform_target;
 
     Matrix4 matrix_target_base = GetBaseOffsetMatrix(m_DragModeOverlayOrigin, m_DragModeOverlayOriginConfig);
@@ -855,7 +811,7 @@ void OverlayDragger::DragGestureUpdate()
     {
         vr::TrackingUniverseOrigin universe_origin = vr::TrackingUniverseStanding;
         vr::TrackedDevicePose_t poses[vr::k_unMaxTrackedDeviceCount];
-        vr::VRSystem()->GetDeviceToAbsoluteTrackingPose(universe_origin, vr::IVRSystemEx::GetTimeNowToPhotons(), poses, vr::k_unMaxTrackedDeviceCount);
+        TrackedPoseSnapshot::Get().GetPoses(poses, universe_origin);
 
         if ( (poses[index_right].bPoseIsValid) && (poses[index_left].bPoseIsValid) )
         {
@@ -870,7 +826,7 @@ void OverlayDragger::DragGestureUpdate()
                 //Scale is just the start scale multiplied by the factor of changed controller distance
                 float width = m_DragGestureScaleWidthStart * (m_DragGestureScaleDistanceLast / m_DragGestureScaleDistanceStart);
                 width = std::min(width, m_DragModeMaxWidth);
-                vr::VROverlay()->SetOverlayWidthInMeters(m_DragModeOverlayHandle, width);
+                OverlayStateMirror::Get().SetOverlayWidthInMeters(m_DragModeOverlayHandle, width);
 
                 if (m_DragModeOverlayID != k_ulOverlayID_None)
                 {
@@ -913,7 +869,7 @@ void OverlayDragger::DragGestureUpdate()
                 mat_overlay.setTranslation(pos);
 
                 vr::HmdMatrix34_t vrmat = mat_overlay.toOpenVR34();
-                vr::VROverlay()->SetOverlayTransformAbsolute(m_DragModeOverlayHandle, vr::TrackingUniverseStanding, &vrmat);
+                OverlayStateMirror::Get().SetOverlayTransformAbsolute(m_DragModeOverlayHandle, vr::TrackingUniverseStanding, &vrmat);
             }
 
             m_DragGestureRotateMatLast = matrix_rotate_current;
@@ -969,33 +925,28 @@ void OverlayDragger::AbsoluteModeSet(bool is_active, float offset_forward)
 
 void OverlayDragger::UpdateDashboardHMD_Y()
 {
-    vr::VROverlayHandle_t ovrl_handle_dplus;
-    vr::VROverlay()->FindOverlay("elvissteinjr.DesktopPlusDashboard", &ovrl_handle_dplus);
+    const vr::VROverlayHandle_t ovrl_handle_dplus = TrackedPoseSnapshot::Get().GetDPlusDashboardOverlayHandle();
 
     //Use dashboard dummy if available and visible. It provides a way more reliable reference point
-    if ( (ovrl_handle_dplus != vr::k_ulOverlayHandleInvalid) && (vr::VROverlay()->IsOverlayVisible(ovrl_handle_dplus)) )
+    if ( (ovrl_handle_dplus != vr::k_ulOverlayHandleInvalid) && (OverlayStateMirror::Get().IsOverlayVisible(ovrl_handle_dplus)) )
     {
         //Adjust offset if GamepadUI (SteamVR 2 dashboard) exists
-        vr::VROverlayHandle_t handle_gamepad_ui = vr::k_ulOverlayHandleInvalid;
-        vr::VROverlay()->FindOverlay("valve.steam.gamepadui.bar", &handle_gamepad_ui);
+        const vr::VROverlayHandle_t handle_gamepad_ui = TrackedPoseSnapshot::Get().GetGamepadUIOverlayHandle();
 
-        vr::HmdMatrix34_t matrix_dplus_tab;
-        vr::TrackingUniverseOrigin origin = vr::TrackingUniverseStanding;
-        vr::VROverlay()->GetTransformForOverlayCoordinates(ovrl_handle_dplus, origin, {0.5f, 0.0f}, &matrix_dplus_tab);
+        bool is_matrix_valid = false;
+        const Matrix4 matrix_dplus_tab = TrackedPoseSnapshot::Get().GetDPlusDashboardTabMatrix(is_matrix_valid);
 
         //Rough height difference between dashboard dummy reference point and SystemUI reference point (slightly different with GamepadUI active)
         const float height_diff = (handle_gamepad_ui != vr::k_ulOverlayHandleInvalid) ? 0.505283f : 0.575283f;
-        m_DashboardHMD_Y = matrix_dplus_tab.m[1][3] + height_diff;
+        m_DashboardHMD_Y = matrix_dplus_tab.getTranslation().y + height_diff;
     }
     else //Otherwise use current headset pose. This works decently when looking straight, but drifts sligthly when not
     {
-        vr::TrackingUniverseOrigin universe_origin = vr::TrackingUniverseStanding;
-        vr::TrackedDevicePose_t poses[vr::k_unTrackedDeviceIndex_Hmd + 1];
-        vr::VRSystem()->GetDeviceToAbsoluteTrackingPose(universe_origin, 0 /*don't predict anything here*/, poses, vr::k_unTrackedDeviceIndex_Hmd + 1);
+        const vr::TrackedDevicePose_t pose_hmd = TrackedPoseSnapshot::Get().GetPose(vr::k_unTrackedDeviceIndex_Hmd, vr::TrackingUniverseStanding, false /*don't predict anything here*/);
 
-        if (poses[vr::k_unTrackedDeviceIndex_Hmd].bPoseIsValid)
+        if (pose_hmd.bPoseIsValid)
         {
-            Matrix4 mat_pose = poses[vr::k_unTrackedDeviceIndex_Hmd].mDeviceToAbsoluteTracking;
+            Matrix4 mat_pose = pose_hmd.mDeviceToAbsoluteTracking;
 
             //Offset pose 0.10 m forward to the actual center of the HMD pose. This is still pretty hacky, but minimizes deviation from not looking straight
             mat_pose.translate_relative(0.0f, 0.0f, 0.10f);
@@ -1007,12 +958,11 @@ void OverlayDragger::UpdateDashboardHMD_Y()
 
 void OverlayDragger::UpdateTempStandingPosition()
 {
-    vr::TrackedDevicePose_t poses[vr::k_unTrackedDeviceIndex_Hmd + 1];
-    vr::VRSystem()->GetDeviceToAbsoluteTrackingPose(vr::TrackingUniverseStanding, vr::IVRSystemEx::GetTimeNowToPhotons(), poses, vr::k_unTrackedDeviceIndex_Hmd + 1);
+    const vr::TrackedDevicePose_t pose_hmd = TrackedPoseSnapshot::Get().GetPose(vr::k_unTrackedDeviceIndex_Hmd);
 
-    if (poses[vr::k_unTrackedDeviceIndex_Hmd].bPoseIsValid)
+    if (pose_hmd.bPoseIsValid)
     {
-        Matrix4 mat_pose = poses[vr::k_unTrackedDeviceIndex_Hmd].mDeviceToAbsoluteTracking;
+        Matrix4 mat_pose = pose_hmd.mDeviceToAbsoluteTracking;
         Vector3 pos_hmd = mat_pose.getTranslation();
 
         //Allow for slight tolerance in position changes from head movement for a more fixed reference point
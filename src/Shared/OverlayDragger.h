@@ -2,6 +2,7 @@
 
 #include "Matrices.h"
 #include "ConfigManager.h"
+#include "OverlayConfigView.h"
 
 //Class handling dragging overlays with motion controllers, with support for all Desktop+ overlay origins
 class OverlayDragger
@@ -35,7 +36,6 @@ class OverlayDragger
         void DragStartBase(bool is_gesture_drag = false);
         void DragGestureStartBase();
 
-        void TransformForceUpright(Matrix4& transform) const;
         void TransformForceDistance(Matrix4& transform, Vector3 reference_pos, float distance, bool use_cylinder_shape = false, bool auto_tilt = false) const;
         void TransformSnapRotation(Matrix4& transform, float degrees, bool snap_x, bool snap_y, bool snap_z) const;
 
@@ -43,6 +43,7 @@ class OverlayDragger
         OverlayDragger();
 
         Matrix4 GetBaseOffsetMatrix();
+        Matrix4 GetBaseOffsetMatrix(const OverlayConfigView& config);
         Matrix4 GetBaseOffsetMatrix(OverlayOrigin overlay_origin);  //Not recommended to use with origins that have config values
         Matrix4 GetBaseOffsetMatrix(OverlayOrigin overlay_origin, const OverlayOriginConfig& origin_config);
         void ApplyDashboardScale(Matrix4& matrix);
@@ -13,6 +13,7 @@
 #include "WindowManager.h"
 #include "Util.h"
 #include "OpenVRExt.h"
+#include "OverlayStateMirror.h"
 #include "Logging.h"
 
 #include <sstream>
@@ -89,7 +90,7 @@ Matrix4 OverlayManager::GetOverlayTransformBase(vr::VROverlayHandle_t ovrl_handl
     {
         //Get texture bounds
         vr::VRTextureBounds_t bounds;
-        vr::VROverlay()->GetOverlayTextureBounds(ovrl_handle, &bounds);
+        OverlayStateMirror::Get().GetOverlayTextureBounds(ovrl_handle, &bounds);
 
         //Get 3D height factor
         float height_factor_3d = 1.0f;
@@ -119,7 +120,7 @@ Matrix4 OverlayManager::GetOverlayTransformBase(vr::VROverlayHandle_t ovrl_handl
         {
             #ifdef DPLUS_UI
                 vr::VROverlayHandle_t ovrl_handle_reference = vr::k_ulOverlayHandleInvalid;
-                vr::VROverlay()->FindOverlay("elvissteinjr.DesktopPlusTheaterReference", &ovrl_handle_reference);
+                OverlayStateMirror::Get().FindOverlay("elvissteinjr.DesktopPlusTheaterReference", &ovrl_handle_reference);
             #else
                 vr::VROverlayHandle_t ovrl_handle_reference = m_TheaterOverlayReferenceHandle;
             #endif
@@ -130,7 +131,7 @@ Matrix4 OverlayManager::GetOverlayTransformBase(vr::VROverlayHandle_t ovrl_handl
                 vr::HmdVector2_t pos{ovrl_pixel_width/2.0f, 0.0f};
                 vr::VROverlay()->SetOverlayCursorPositionOverride(ovrl_handle, &pos);
 
-                vr::VROverlay()->SetOverlayAlpha(ovrl_handle_reference, 0.25f);
+                OverlayStateMirror::Get().SetOverlayAlpha(ovrl_handle_reference, 0.25f);
 
                 //Grab its middle spot and return that
                 vr::VROverlay()->GetTransformForOverlayCoordinates(ovrl_handle_reference, vr::TrackingUniverseStanding, {0.5f, 0.5f}, &matrix);
@@ -161,6 +162,7 @@ unsigned int OverlayManager::DuplicateOverlay(const OverlayConfigData& data, uns
 
     #ifndef DPLUS_UI
         m_Overlays.emplace_back(id);
+        InvalidateOverlayIDCache();
     #endif
     m_OverlayConfigData.push_back(data);
 
@@ -206,6 +208,7 @@ unsigned int OverlayManager::AddOverlay(OverlayCaptureSource capture_source, int
 
     #ifndef DPLUS_UI
     m_Overlays.emplace_back(id);
+    InvalidateOverlayIDCache();
     #endif
     m_OverlayConfigData.push_back(OverlayConfigData());
 
@@ -383,16 +386,16 @@ void OverlayManager::SetTheaterOverlayID(unsigned int id)
 
         if (ovrl_error == vr::VROverlayError_None)
         {
-            vr::VROverlay()->SetOverlayFlag(ovrl_handle, vr::VROverlayFlags_NoDashboardTab,        true);
-            vr::VROverlay()->SetOverlayFlag(ovrl_handle, vr::VROverlayFlags_EnableControlBar,      true);
-            vr::VROverlay()->SetOverlayFlag(ovrl_handle, vr::VROverlayFlags_EnableControlBarClose, true);
-            vr::VROverlay()->SetOverlayFlag(ovrl_handle, vr::VROverlayFlags_MinimalControlBar,     true);
+            OverlayStateMirror::Get().SetOverlayFlag(ovrl_handle, vr::VROverlayFlags_NoDashboardTab,        true);
+            OverlayStateMirror::Get().SetOverlayFlag(ovrl_handle, vr::VROverlayFlags_EnableControlBar,      true);
+            OverlayStateMirror::Get().SetOverlayFlag(ovrl_handle, vr::VROverlayFlags_EnableControlBarClose, true);
+            OverlayStateMirror::Get().SetOverlayFlag(ovrl_handle, vr::VROverlayFlags_MinimalControlBar,     true);
 
             m_TheaterOverlayHandle = ovrl_handle;
 
             //Since the Theater Screen's width can't be queried, getting anything except the middle transform is difficult
             //We work around this restriction by using a cursor overlay as transform reference as it can be placed relative on the overlay and still be queried for its transform
-            ovrl_error = vr::VROverlay()->CreateOverlay("elvissteinjr.DesktopPlusTheaterReference", "Desktop+ Theater Screen Reference", &ovrl_handle);
+            ovrl_error = OverlayStateMirror::Get().CreateOverlay("elvissteinjr.DesktopPlusTheaterReference", "Desktop+ Theater Screen Reference", &ovrl_handle);
 
             if (ovrl_error == vr::VROverlayError_None)
             {
@@ -404,7 +407,7 @@ void OverlayManager::SetTheaterOverlayID(unsigned int id)
                 vr::HmdVector2_t hotspot{0.5f, 0.5f};
                 vr::HmdVector2_t pos{0.0f, 0.0f};
                 vr::VROverlay()->SetOverlayCursor(m_TheaterOverlayHandle, ovrl_handle);
-                vr::VROverlay()->SetOverlayTransformCursor(ovrl_handle, &hotspot);
+                OverlayStateMirror::Get().SetOverlayTransformCursor(ovrl_handle, &hotspot);
                 vr::VROverlay()->SetOverlayCursorPositionOverride(m_TheaterOverlayHandle, &pos);
 
                 m_TheaterOverlayReferenceHandle = ovrl_handle;
@@ -424,7 +427,8 @@ void OverlayManager::SetTheaterOverlayID(unsigned int id)
         //Return previous source overlay to its own handle
         Overlay& ovrl_source_prev = m_Overlays[m_CurrentTheaterOverlayID];
         ovrl_source_prev.SetHandle(m_CurrentTheaterOverlayOrigHandle);
-        vr::VROverlay()->SetOverlayAlpha(m_CurrentTheaterOverlayOrigHandle, ovrl_source.GetOpacity());  //Match opacity as its only set on changes
+        InvalidateOverlayIDCache();
+        OverlayStateMirror::Get().SetOverlayAlpha(m_CurrentTheaterOverlayOrigHandle, ovrl_source.GetOpacity());  //Match opacity as its only set on changes
         ovrl_source_prev.SetVisible(false);                                                             //Mark it as invisible and have OutputManager reset it later
 
         m_OverlayConfigData[m_CurrentTheaterOverlayID].ConfigHandle[configid_handle_overlay_state_overlay_handle] = m_CurrentTheaterOverlayOrigHandle;
@@ -441,9 +445,10 @@ void OverlayManager::SetTheaterOverlayID(unsigned int id)
     }
 
     m_CurrentTheaterOverlayOrigHandle = ovrl_source.GetHandle();
-    vr::VROverlay()->HideOverlay(m_CurrentTheaterOverlayOrigHandle);                     //Hide original overlay
-    vr::VROverlay()->SetOverlayAlpha(m_TheaterOverlayHandle, ovrl_source.GetOpacity());  //Match opacity as its only set on changes
+    OverlayStateMirror::Get().HideOverlay(m_CurrentTheaterOverlayOrigHandle);                     //Hide original overlay
+    OverlayStateMirror::Get().SetOverlayAlpha(m_TheaterOverlayHandle, ovrl_source.GetOpacity());  //Match opacity as its only set on changes
     ovrl_source.SetHandle(m_TheaterOverlayHandle);
+    InvalidateOverlayIDCache();
 
     m_CurrentTheaterOverlayID = id;
 
@@ -476,7 +481,8 @@ void OverlayManager::ClearTheaterOverlay(bool no_ui_update)
         //Return previous source overlay to its own handle
         Overlay& ovrl_source_prev = m_Overlays[m_CurrentTheaterOverlayID];
         ovrl_source_prev.SetHandle(m_CurrentTheaterOverlayOrigHandle);
-        vr::VROverlay()->SetOverlayAlpha(m_CurrentTheaterOverlayOrigHandle, ovrl_source_prev.GetOpacity());  //Match opacity as its only set on changes
+        InvalidateOverlayIDCache();
+        OverlayStateMirror::Get().SetOverlayAlpha(m_CurrentTheaterOverlayOrigHandle, ovrl_source_prev.GetOpacity());  //Match opacity as its only set on changes
         ovrl_source_prev.SetVisible(false);                                                                  //Mark it as invisible and have OutputManager reset it later
 
         m_OverlayConfigData[m_CurrentTheaterOverlayID].ConfigHandle[configid_handle_overlay_state_overlay_handle] = m_CurrentTheaterOverlayOrigHandle;
@@ -497,11 +503,11 @@ void OverlayManager::ClearTheaterOverlay(bool no_ui_update)
 
     if (m_TheaterOverlayHandle != vr::k_ulOverlayHandleInvalid)
     {
-        vr::VROverlay()->DestroyOverlay(m_TheaterOverlayHandle);
+        OverlayStateMirror::Get().DestroyOverlay(m_TheaterOverlayHandle);
 
         if (m_TheaterOverlayReferenceHandle != vr::k_ulOverlayHandleInvalid)
         {
-            vr::VROverlay()->DestroyOverlay(m_TheaterOverlayReferenceHandle);
+            OverlayStateMirror::Get().DestroyOverlay(m_TheaterOverlayReferenceHandle);
         }
     }
 
@@ -582,6 +588,11 @@ OverlayConfigData& OverlayManager::GetCurrentConfigData()
     return GetConfigData(m_CurrentOverlayID);
 }
 
+OverlayConfigView OverlayManager::GetConfigView(unsigned int id) const
+{
+    return OverlayConfigView(id, GetConfigData(id));
+}
+
 OverlayOriginConfig OverlayManager::GetOriginConfigFromData(const OverlayConfigData& data) const
 {
     OverlayOriginConfig origin_config;
@@ -605,11 +616,29 @@ void OverlayManager::SetCurrentOverlayID(unsigned int id)
 
 unsigned int OverlayManager::FindOverlayID(vr::VROverlayHandle_t handle) const
 {
-    const auto it = std::find_if(m_Overlays.cbegin(), m_Overlays.cend(), [&](const auto& overlay){ return (overlay.GetHandle() == handle); });
+    //Overlays get added, removed, swapped and have their handles exchanged for theater mode in a lot of places, so instead of keeping the cache in sync everywhere,
+    //hits are validated against the overlay and the cache is rebuilt when they don't match up anymore
+    //Misses don't rebuild it if it's still complete, so lookups of unknown handles stay cheap
+    auto it = m_OverlayIDCache.find(handle);
+    const bool is_stale = (it == m_OverlayIDCache.end()) ? (m_OverlayIDCacheOverlayCount != m_Overlays.size()) :
+                                                           ( (it->second >= m_Overlays.size()) || (m_Overlays[it->second].GetHandle() != handle) );
+
+    if (is_stale)
+    {
+        m_OverlayIDCache.clear();
+
+        for (unsigned int i = 0; i < m_Overlays.size(); ++i)
+        {
+            m_OverlayIDCache.emplace(m_Overlays[i].GetHandle(), i);
+        }
+
+        m_OverlayIDCacheOverlayCount = m_Overlays.size();
+        it = m_OverlayIDCache.find(handle);
+    }
 
-    if (it != m_Overlays.cend())
+    if ( (it != m_OverlayIDCache.end()) && (it->second < m_Overlays.size()) && (m_Overlays[it->second].GetHandle() == handle) )
     {
-        return it->GetID();
+        return m_Overlays[it->second].GetID();
     }
     else if (handle == m_CurrentTheaterOverlayOrigHandle)
     {
@@ -624,6 +653,12 @@ unsigned int OverlayManager::FindTheaterOverlayID() const
     return m_CurrentTheaterOverlayID;
 }
 
+void OverlayManager::InvalidateOverlayIDCache()
+{
+    m_OverlayIDCache.clear();
+    m_OverlayIDCacheOverlayCount = SIZE_MAX;
+}
+
 #else
 
 unsigned int OverlayManager::FindOverlayID(vr::VROverlayHandle_t handle) const
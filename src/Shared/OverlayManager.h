@@ -1,8 +1,10 @@
 #pragma once
 
 #include <algorithm>
+#include <unordered_map>
 
 #include "ConfigManager.h"
+#include "OverlayConfigView.h"
 
 #ifndef DPLUS_UI
     #include "Overlays.h"   //UI app only deals with overlay config data
@@ -34,6 +36,11 @@ class OverlayManager
             vr::VROverlayHandle_t m_TheaterOverlayReferenceHandle;      //Handle of the cursor overlay used as theater overlay reference transform
             vr::VROverlayHandle_t m_CurrentTheaterOverlayOrigHandle;    //Handle of the overlay originally held by current theater overlay
             unsigned int m_CurrentTheaterOverlayID;                     //ID of overlay the theater overlay duplicates
+
+            mutable std::unordered_map<vr::VROverlayHandle_t, unsigned int> m_OverlayIDCache;   //Handle to ID lookup cache for FindOverlayID(), validated on every hit
+            mutable size_t m_OverlayIDCacheOverlayCount = SIZE_MAX;     //Overlay count the cache was built for, misses only rebuild it if this changed
+
+            void InvalidateOverlayIDCache();                            //Call when overlays get a handle the cache can't know about yet
         #endif
         std::vector<OverlayConfigData> m_OverlayConfigData;
 
@@ -66,6 +73,7 @@ class OverlayManager
         OverlayConfigData& GetConfigData(unsigned int id);
         const OverlayConfigData& GetConfigData(unsigned int id) const;
         OverlayConfigData& GetCurrentConfigData();
+        OverlayConfigView GetConfigView(unsigned int id) const;             //Returns view of null overlay data on error
         OverlayOriginConfig GetOriginConfigFromData(const OverlayConfigData& data) const;
 
         unsigned int GetCurrentOverlayID() const;
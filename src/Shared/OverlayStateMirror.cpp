@@ -0,0 +1,614 @@
+#include "OverlayStateMirror.h"
+
+#include <cstring>
+
+static OverlayStateMirror g_OverlayStateMirror;
+
+vr::IVROverlay* OverlayStateMirror::GetInterface()
+{
+    m_Stats.RuntimeCalls++;
+    return (m_OverlayInterface != nullptr) ? m_OverlayInterface : vr::VROverlay();
+}
+
+OverlayStateMirror::OverlayState* OverlayStateMirror::FindOwnedState(vr::VROverlayHandle_t overlay_handle)
+{
+    auto it = m_OwnedOverlays.find(overlay_handle);
+    return (it != m_OwnedOverlays.end()) ? &it->second : nullptr;
+}
+
+bool OverlayStateMirror::IsSaved(bool is_saved)
+{
+    if (is_saved)
+    {
+        m_Stats.SavedCalls++;
+    }
+
+    return is_saved;
+}
+
+OverlayStateMirror& OverlayStateMirror::Get()
+{
+    return g_OverlayStateMirror;
+}
+
+void OverlayStateMirror::SetOverlayInterface(vr::IVROverlay* overlay_interface)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_OverlayInterface = overlay_interface;
+    }
+
+    Reset();
+}
+
+void OverlayStateMirror::BeginFrame()
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    m_FrameVisibility.clear();
+    m_FrameFoundOverlays.clear();
+    m_IsFrameMemoEnabled = true;
+}
+
+void OverlayStateMirror::Reset()
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    m_OwnedOverlays.clear();
+    m_OwnedOverlayKeys.clear();
+    m_FrameVisibility.clear();
+    m_FrameFoundOverlays.clear();
+}
+
+OverlayStateMirror::Stats OverlayStateMirror::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_Stats;
+}
+
+void OverlayStateMirror::ResetStats()
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Stats = Stats();
+}
+
+vr::EVROverlayError OverlayStateMirror::FindOverlay(const char* overlay_key, vr::VROverlayHandle_t* overlay_handle)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    auto it = m_OwnedOverlayKeys.find(overlay_key);
+    if (IsSaved(it != m_OwnedOverlayKeys.end()))
+    {
+        *overlay_handle = it->second;
+        return vr::VROverlayError_None;
+    }
+
+    it = m_FrameFoundOverlays.find(overlay_key);
+    if (IsSaved(it != m_FrameFoundOverlays.end()))
+    {
+        *overlay_handle = it->second;
+        return vr::VROverlayError_None;
+    }
+
+    //Overlays not found aren't remembered as they may be created by another process at any time
+    vr::EVROverlayError error = GetInterface()->FindOverlay(overlay_key, overlay_handle);
+
+    if ( (error == vr::VROverlayError_None) && (m_IsFrameMemoEnabled) )
+    {
+        m_FrameFoundOverlays[overlay_key] = *overlay_handle;
+    }
+
+    return error;
+}
+
+vr::EVROverlayError OverlayStateMirror::CreateOverlay(const char* overlay_key, const char* overlay_name, vr::VROverlayHandle_t* overlay_handle)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    vr::EVROverlayError error = GetInterface()->CreateOverlay(overlay_key, overlay_name, overlay_handle);
+
+    if (error == vr::VROverlayError_None)
+    {
+        m_OwnedOverlays[*overlay_handle] = OverlayState();  //New overlays are hidden, but other defaults are left to the runtime
+        m_OwnedOverlays[*overlay_handle].KnownProperties = ovrlstate_prop_visible;
+        m_OwnedOverlayKeys[overlay_key] = *overlay_handle;
+        m_FrameFoundOverlays.erase(overlay_key);
+    }
+
+    return error;
+}
+
+vr::EVROverlayError OverlayStateMirror::DestroyOverlay(vr::VROverlayHandle_t overlay_handle)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    vr::EVROverlayError error = GetInterface()->DestroyOverlay(overlay_handle);
+
+    //Forget about the overlay even on error, the handle is unusable either way
+    m_OwnedOverlays.erase(overlay_handle);
+    m_FrameVisibility.erase(overlay_handle);
+
+    for (auto it = m_OwnedOverlayKeys.begin(); it != m_OwnedOverlayKeys.end(); ++it)
+    {
+        if (it->second == overlay_handle)
+        {
+            m_OwnedOverlayKeys.erase(it);
+            break;
+        }
+    }
+
+    for (auto it = m_FrameFoundOverlays.begin(); it != m_FrameFoundOverlays.end(); ++it)
+    {
+        if (it->second == overlay_handle)
+        {
+            m_FrameFoundOverlays.erase(it);
+            break;
+        }
+    }
+
+    return error;
+}
+
+vr::EVROverlayError OverlayStateMirror::ShowOverlay(vr::VROverlayHandle_t overlay_handle)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    OverlayState* state = FindOwnedState(overlay_handle);
+    if (IsSaved( (state != nullptr) && (state->KnownProperties & ovrlstate_prop_visible) && (state->IsVisible) ))
+        return vr::VROverlayError_None;
+
+    vr::EVROverlayError error = GetInterface()->ShowOverlay(overlay_handle);
+
+    if (state != nullptr)
+    {
+        state->IsVisible = true;
+        state->KnownProperties = (error == vr::VROverlayError_None) ? state->KnownProperties | ovrlstate_prop_visible : state->KnownProperties & ~ovrlstate_prop_visible;
+    }
+
+    m_FrameVisibility.erase(overlay_handle);
+
+    return error;
+}
+
+vr::EVROverlayError OverlayStateMirror::HideOverlay(vr::VROverlayHandle_t overlay_handle)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    OverlayState* state = FindOwnedState(overlay_handle);
+    if (IsSaved( (state != nullptr) && (state->KnownProperties & ovrlstate_prop_visible) && (!state->IsVisible) ))
+        return vr::VROverlayError_None;
+
+    vr::EVROverlayError error = GetInterface()->HideOverlay(overlay_handle);
+
+    if (state != nullptr)
+    {
+        state->IsVisible = false;
+        state->KnownProperties = (error == vr::VROverlayError_None) ? state->KnownProperties | ovrlstate_prop_visible : state->KnownProperties & ~ovrlstate_prop_visible;
+    }
+
+    m_FrameVisibility.erase(overlay_handle);
+
+    return error;
+}
+
+bool OverlayStateMirror::IsOverlayVisible(vr::VROverlayHandle_t overlay_handle)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    OverlayState* state = FindOwnedState(overlay_handle);
+    if (state != nullptr)
+    {
+        if (IsSaved(state->KnownProperties & ovrlstate_prop_visible))
+            return state->IsVisible;
+
+        state->IsVisible = GetInterface()->IsOverlayVisible(overlay_handle);
+        state->KnownProperties |= ovrlstate_prop_visible;
+        return state->IsVisible;
+    }
+
+    auto it = m_FrameVisibility.find(overlay_handle);
+    if (IsSaved(it != m_FrameVisibility.end()))
+        return it->second;
+
+    const bool is_visible = GetInterface()->IsOverlayVisible(overlay_handle);
+
+    if (m_IsFrameMemoEnabled)
+    {
+        m_FrameVisibility[overlay_handle] = is_visible;
+    }
+
+    return is_visible;
+}
+
+vr::EVROverlayError OverlayStateMirror::SetOverlayAlpha(vr::VROverlayHandle_t overlay_handle, float alpha)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    OverlayState* state = FindOwnedState(overlay_handle);
+    if (IsSaved( (state != nullptr) && (state->KnownProperties & ovrlstate_prop_alpha) && (state->Alpha == alpha) ))
+        return vr::VROverlayError_None;
+
+    vr::EVROverlayError error = GetInterface()->SetOverlayAlpha(overlay_handle, alpha);
+
+    if ( (state != nullptr) && (error == vr::VROverlayError_None) )
+    {
+        state->Alpha = alpha;
+        state->KnownProperties |= ovrlstate_prop_alpha;
+    }
+
+    return error;
+}
+
+vr::EVROverlayError OverlayStateMirror::GetOverlayAlpha(vr::VROverlayHandle_t overlay_handle, float* alpha)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    OverlayState* state = FindOwnedState(overlay_handle);
+    if (IsSaved( (state != nullptr) && (state->KnownProperties & ovrlstate_prop_alpha) ))
+    {
+        *alpha = state->Alpha;
+        return vr::VROverlayError_None;
+    }
+
+    vr::EVROverlayError error = GetInterface()->GetOverlayAlpha(overlay_handle, alpha);
+
+    if ( (state != nullptr) && (error == vr::VROverlayError_None) )
+    {
+        state->Alpha = *alpha;
+        state->KnownProperties |= ovrlstate_prop_alpha;
+    }
+
+    return error;
+}
+
+vr::EVROverlayError OverlayStateMirror::SetOverlayColor(vr::VROverlayHandle_t overlay_handle, float red, float green, float blue)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    OverlayState* state = FindOwnedState(overlay_handle);
+    if (IsSaved( (state != nullptr) && (state->KnownProperties & ovrlstate_prop_color) &&
+                 (state->Color[0] == red) && (state->Color[1] == green) && (state->Color[2] == blue) ))
+    {
+        return vr::VROverlayError_None;
+    }
+
+    vr::EVROverlayError error = GetInterface()->SetOverlayColor(overlay_handle, red, green, blue);
+
+    if ( (state != nullptr) && (error == vr::VROverlayError_None) )
+    {
+        state->Color[0] = red;
+        state->Color[1] = green;
+        state->Color[2] = blue;
+        state->KnownProperties |= ovrlstate_prop_color;
+    }
+
+    return error;
+}
+
+vr::EVROverlayError OverlayStateMirror::GetOverlayColor(vr::VROverlayHandle_t overlay_handle, float* red, float* green, float* blue)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    OverlayState* state = FindOwnedState(overlay_handle);
+    if (IsSaved( (state != nullptr) && (state->KnownProperties & ovrlstate_prop_color) ))
+    {
+        *red   = state->Color[0];
+        *green = state->Color[1];
+        *blue  = state->Color[2];
+        return vr::VROverlayError_None;
+    }
+
+    vr::EVROverlayError error = GetInterface()->GetOverlayColor(overlay_handle, red, green, blue);
+
+    if ( (state != nullptr) && (error == vr::VROverlayError_None) )
+    {
+        state->Color[0] = *red;
+        state->Color[1] = *green;
+        state->Color[2] = *blue;
+        state->KnownProperties |= ovrlstate_prop_color;
+    }
+
+    return error;
+}
+
+vr::EVROverlayError OverlayStateMirror::SetOverlayWidthInMeters(vr::VROverlayHandle_t overlay_handle, float width_in_meters)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    OverlayState* state = FindOwnedState(overlay_handle);
+    if (IsSaved( (state != nullptr) && (state->KnownProperties & ovrlstate_prop_width) && (state->Width == width_in_meters) ))
+        return vr::VROverlayError_None;
+
+    vr::EVROverlayError error = GetInterface()->SetOverlayWidthInMeters(overlay_handle, width_in_meters);
+
+    if ( (state != nullptr) && (error == vr::VROverlayError_None) )
+    {
+        state->Width = width_in_meters;
+        state->KnownProperties |= ovrlstate_prop_width;
+    }
+
+    return error;
+}
+
+vr::EVROverlayError OverlayStateMirror::GetOverlayWidthInMeters(vr::VROverlayHandle_t overlay_handle, float* width_in_meters)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    OverlayState* state = FindOwnedState(overlay_handle);
+    if (IsSaved( (state != nullptr) && (state->KnownProperties & ovrlstate_prop_width) ))
+    {
+        *width_in_meters = state->Width;
+        return vr::VROverlayError_None;
+    }
+
+    vr::EVROverlayError error = GetInterface()->GetOverlayWidthInMeters(overlay_handle, width_in_meters);
+
+    if ( (state != nullptr) && (error == vr::VROverlayError_None) )
+    {
+        state->Width = *width_in_meters;
+        state->KnownProperties |= ovrlstate_prop_width;
+    }
+
+    return error;
+}
+
+vr::EVROverlayError OverlayStateMirror::SetOverlayTransformAbsolute(vr::VROverlayHandle_t overlay_handle, vr::ETrackingUniverseOrigin tracking_origin, const vr::HmdMatrix34_t* matrix)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    OverlayState* state = FindOwnedState(overlay_handle);
+    if (IsSaved( (state != nullptr) && (state->KnownProperties & ovrlstate_prop_transform) && (state->TransformOrigin == tracking_origin) &&
+                 (memcmp(&state->Transform, matrix, sizeof(vr::HmdMatrix34_t)) == 0) ))
+    {
+        return vr::VROverlayError_None;
+    }
+
+    vr::EVROverlayError error = GetInterface()->SetOverlayTransformAbsolute(overlay_handle, tracking_origin, matrix);
+
+    if (state != nullptr)
+    {
+        if (error == vr::VROverlayError_None)
+        {
+            state->TransformOrigin = tracking_origin;
+            state->Transform = *matrix;
+            state->KnownProperties |= ovrlstate_prop_transform;
+        }
+        else
+        {
+            state->KnownProperties &= ~ovrlstate_prop_transform;
+        }
+    }
+
+    return error;
+}
+
+vr::EVROverlayError OverlayStateMirror::GetOverlayTransformAbsolute(vr::VROverlayHandle_t overlay_handle, vr::ETrackingUniverseOrigin* tracking_origin, vr::HmdMatrix34_t* matrix)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    OverlayState* state = FindOwnedState(overlay_handle);
+    if (IsSaved( (state != nullptr) && (state->KnownProperties & ovrlstate_prop_transform) ))
+    {
+        *tracking_origin = state->TransformOrigin;
+        *matrix = state->Transform;
+        return vr::VROverlayError_None;
+    }
+
+    //Not cached on get as the overlay may be using a different transform type, in which case the runtime returns an error
+    return GetInterface()->GetOverlayTransformAbsolute(overlay_handle, tracking_origin, matrix);
+}
+
+vr::EVROverlayError OverlayStateMirror::SetOverlayTransformTrackedDeviceRelative(vr::VROverlayHandle_t overlay_handle, vr::TrackedDeviceIndex_t device_index, const vr::HmdMatrix34_t* matrix)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    OverlayState* state = FindOwnedState(overlay_handle);
+    if (state != nullptr)
+    {
+        state->KnownProperties &= ~ovrlstate_prop_transform;
+    }
+
+    return GetInterface()->SetOverlayTransformTrackedDeviceRelative(overlay_handle, device_index, matrix);
+}
+
+vr::EVROverlayError OverlayStateMirror::SetOverlayTransformCursor(vr::VROverlayHandle_t overlay_handle, const vr::HmdVector2_t* hotspot)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    OverlayState* state = FindOwnedState(overlay_handle);
+    if (state != nullptr)
+    {
+        state->KnownProperties &= ~ovrlstate_prop_transform;
+    }
+
+    return GetInterface()->SetOverlayTransformCursor(overlay_handle, hotspot);
+}
+
+vr::EVROverlayError OverlayStateMirror::SetOverlayFlag(vr::VROverlayHandle_t overlay_handle, vr::VROverlayFlags flag, bool enabled)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    OverlayState* state = FindOwnedState(overlay_handle);
+    if (IsSaved( (state != nullptr) && (state->FlagsKnown & flag) && (((state->FlagsEnabled & flag) != 0) == enabled) ))
+        return vr::VROverlayError_None;
+
+    vr::EVROverlayError error = GetInterface()->SetOverlayFlag(overlay_handle, flag, enabled);
+
+    if ( (state != nullptr) && (error == vr::VROverlayError_None) )
+    {
+        state->FlagsKnown |= flag;
+        state->FlagsEnabled = (enabled) ? state->FlagsEnabled | flag : state->FlagsEnabled & ~flag;
+    }
+
+    return error;
+}
+
+vr::EVROverlayError OverlayStateMirror::GetOverlayFlag(vr::VROverlayHandle_t overlay_handle, vr::VROverlayFlags flag, bool* enabled)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    OverlayState* state = FindOwnedState(overlay_handle);
+    if (IsSaved( (state != nullptr) && (state->FlagsKnown & flag) ))
+    {
+        *enabled = ((state->FlagsEnabled & flag) != 0);
+        return vr::VROverlayError_None;
+    }
+
+    vr::EVROverlayError error = GetInterface()->GetOverlayFlag(overlay_handle, flag, enabled);
+
+    if ( (state != nullptr) && (error == vr::VROverlayError_None) )
+    {
+        state->FlagsKnown |= flag;
+        state->FlagsEnabled = (*enabled) ? state->FlagsEnabled | flag : state->FlagsEnabled & ~flag;
+    }
+
+    return error;
+}
+
+vr::EVROverlayError OverlayStateMirror::SetOverlayInputMethod(vr::VROverlayHandle_t overlay_handle, vr::VROverlayInputMethod input_method)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    OverlayState* state = FindOwnedState(overlay_handle);
+    if (IsSaved( (state != nullptr) && (state->KnownProperties & ovrlstate_prop_input_method) && (state->InputMethod == input_method) ))
+        return vr::VROverlayError_None;
+
+    vr::EVROverlayError error = GetInterface()->SetOverlayInputMethod(overlay_handle, input_method);
+
+    if ( (state != nullptr) && (error == vr::VROverlayError_None) )
+    {
+        state->InputMethod = input_method;
+        state->KnownProperties |= ovrlstate_prop_input_method;
+    }
+
+    return error;
+}
+
+vr::EVROverlayError OverlayStateMirror::GetOverlayInputMethod(vr::VROverlayHandle_t overlay_handle, vr::VROverlayInputMethod* input_method)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    OverlayState* state = FindOwnedState(overlay_handle);
+    if (IsSaved( (state != nullptr) && (state->KnownProperties & ovrlstate_prop_input_method) ))
+    {
+        *input_method = state->InputMethod;
+        return vr::VROverlayError_None;
+    }
+
+    vr::EVROverlayError error = GetInterface()->GetOverlayInputMethod(overlay_handle, input_method);
+
+    if ( (state != nullptr) && (error == vr::VROverlayError_None) )
+    {
+        state->InputMethod = *input_method;
+        state->KnownProperties |= ovrlstate_prop_input_method;
+    }
+
+    return error;
+}
+
+vr::EVROverlayError OverlayStateMirror::SetOverlaySortOrder(vr::VROverlayHandle_t overlay_handle, uint32_t sort_order)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    OverlayState* state = FindOwnedState(overlay_handle);
+    if (IsSaved( (state != nullptr) && (state->KnownProperties & ovrlstate_prop_sort_order) && (state->SortOrder == sort_order) ))
+        return vr::VROverlayError_None;
+
+    vr::EVROverlayError error = GetInterface()->SetOverlaySortOrder(overlay_handle, sort_order);
+
+    if ( (state != nullptr) && (error == vr::VROverlayError_None) )
+    {
+        state->SortOrder = sort_order;
+        state->KnownProperties |= ovrlstate_prop_sort_order;
+    }
+
+    return error;
+}
+
+vr::EVROverlayError OverlayStateMirror::GetOverlaySortOrder(vr::VROverlayHandle_t overlay_handle, uint32_t* sort_order)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    OverlayState* state = FindOwnedState(overlay_handle);
+    if (IsSaved( (state != nullptr) && (state->KnownProperties & ovrlstate_prop_sort_order) ))
+    {
+        *sort_order = state->SortOrder;
+        return vr::VROverlayError_None;
+    }
+
+    vr::EVROverlayError error = GetInterface()->GetOverlaySortOrder(overlay_handle, sort_order);
+
+    if ( (state != nullptr) && (error == vr::VROverlayError_None) )
+    {
+        state->SortOrder = *sort_order;
+        state->KnownProperties |= ovrlstate_prop_sort_order;
+    }
+
+    return error;
+}
+
+vr::EVROverlayError OverlayStateMirror::SetOverlayTextureBounds(vr::VROverlayHandle_t overlay_handle, const vr::VRTextureBounds_t* texture_bounds)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    OverlayState* state = FindOwnedState(overlay_handle);
+    if (IsSaved( (state != nullptr) && (state->KnownProperties & ovrlstate_prop_texture_bounds) &&
+                 (memcmp(&state->TextureBounds, texture_bounds, sizeof(vr::VRTextureBounds_t)) == 0) ))
+    {
+        return vr::VROverlayError_None;
+    }
+
+    vr::EVROverlayError error = GetInterface()->SetOverlayTextureBounds(overlay_handle, texture_bounds);
+
+    if ( (state != nullptr) && (error == vr::VROverlayError_None) )
+    {
+        state->TextureBounds = *texture_bounds;
+        state->KnownProperties |= ovrlstate_prop_texture_bounds;
+    }
+
+    return error;
+}
+
+vr::EVROverlayError OverlayStateMirror::GetOverlayTextureBounds(vr::VROverlayHandle_t overlay_handle, vr::VRTextureBounds_t* texture_bounds)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    OverlayState* state = FindOwnedState(overlay_handle);
+    if (IsSaved( (state != nullptr) && (state->KnownProperties & ovrlstate_prop_texture_bounds) ))
+    {
+        *texture_bounds = state->TextureBounds;
+        return vr::VROverlayError_None;
+    }
+
+    vr::EVROverlayError error = GetInterface()->GetOverlayTextureBounds(overlay_handle, texture_bounds);
+
+    if ( (state != nullptr) && (error == vr::VROverlayError_None) )
+    {
+        state->TextureBounds = *texture_bounds;
+        state->KnownProperties |= ovrlstate_prop_texture_bounds;
+    }
+
+    return error;
+}
+
+bool OverlayStateMirror::PollNextOverlayEvent(vr::VROverlayHandle_t overlay_handle, vr::VREvent_t* vr_event, uint32_t vr_event_size)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    if (!GetInterface()->PollNextOverlayEvent(overlay_handle, vr_event, vr_event_size))
+        return false;
+
+    if ( (vr_event->eventType == vr::VREvent_OverlayShown) || (vr_event->eventType == vr::VREvent_OverlayHidden) )
+    {
+        OverlayState* state = FindOwnedState(overlay_handle);
+        if (state != nullptr)
+        {
+            state->IsVisible = (vr_event->eventType == vr::VREvent_OverlayShown);
+            state->KnownProperties |= ovrlstate_prop_visible;
+        }
+
+        m_FrameVisibility.erase(overlay_handle);
+    }
+
+    return true;
+}
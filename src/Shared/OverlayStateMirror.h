@@ -0,0 +1,116 @@
+//Write-through mirror of OpenVR overlay properties to avoid redundant runtime round-trips
+//Every IVROverlay call is a cross-process call into the SteamVR runtime, but a lot of them set values that didn't change or query values the process set itself.
+//Overlays created through this class are owned by the process and their properties only change through it, so values are cached for them:
+//Set calls with unchanged values are dropped and Get calls are answered from the cache. Properties not known yet are read from the runtime once.
+//This relies on all calls for the cached properties going through here. Functions have the same signatures as their IVROverlay counterparts for that reason.
+//Visibility and handles of other overlays (other processes, system and dashboard overlays) are only kept for the current frame, see BeginFrame().
+//Overlay events are checked for changes made by the runtime when polled through PollNextOverlayEvent().
+//The IVROverlay interface can be swapped out for testing. Interface is thread-safe.
+
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "openvr.h"
+
+class OverlayStateMirror
+{
+    public:
+        struct Stats
+        {
+            unsigned long long RuntimeCalls = 0;    //Calls passed on to the runtime
+            unsigned long long SavedCalls   = 0;    //Calls dropped or answered from cached state
+        };
+
+    private:
+        enum OverlayStateProperty
+        {
+            ovrlstate_prop_visible        = 1 << 0,
+            ovrlstate_prop_alpha          = 1 << 1,
+            ovrlstate_prop_color          = 1 << 2,
+            ovrlstate_prop_width          = 1 << 3,
+            ovrlstate_prop_transform      = 1 << 4,   //Only absolute transforms are cached, any other transform type clears this
+            ovrlstate_prop_input_method   = 1 << 5,
+            ovrlstate_prop_sort_order     = 1 << 6,
+            ovrlstate_prop_texture_bounds = 1 << 7
+        };
+
+        struct OverlayState
+        {
+            unsigned int KnownProperties = 0;       //OverlayStateProperty bits of the values below that are valid
+            bool IsVisible = false;
+            float Alpha = 1.0f;
+            float Color[3] = {1.0f, 1.0f, 1.0f};
+            float Width = 1.0f;
+            vr::ETrackingUniverseOrigin TransformOrigin = vr::TrackingUniverseStanding;
+            vr::HmdMatrix34_t Transform = {};
+            vr::VROverlayInputMethod InputMethod = vr::VROverlayInputMethod_None;
+            uint32_t SortOrder = 0;
+            vr::VRTextureBounds_t TextureBounds = {};
+            uint32_t FlagsKnown   = 0;              //VROverlayFlags bits whose state is known
+            uint32_t FlagsEnabled = 0;
+        };
+
+        mutable std::mutex m_Mutex;
+        vr::IVROverlay* m_OverlayInterface = nullptr;
+
+        //- Protected by m_Mutex
+        std::unordered_map<vr::VROverlayHandle_t, OverlayState> m_OwnedOverlays;
+        std::unordered_map<std::string, vr::VROverlayHandle_t> m_OwnedOverlayKeys;
+        std::unordered_map<vr::VROverlayHandle_t, bool> m_FrameVisibility;              //Visibility of overlays not owned, only valid for the current frame
+        std::unordered_map<std::string, vr::VROverlayHandle_t> m_FrameFoundOverlays;    //Successful FindOverlay() results for overlays not owned, only valid for the current frame
+        bool m_IsFrameMemoEnabled = false;
+        Stats m_Stats;
+
+        vr::IVROverlay* GetInterface();                 //m_OverlayInterface or vr::VROverlay(), counts as runtime call
+        OverlayState* FindOwnedState(vr::VROverlayHandle_t overlay_handle);
+        bool IsSaved(bool is_saved);                    //Counts a saved call if is_saved is true, returns is_saved
+
+    public:
+        static OverlayStateMirror& Get();
+
+        //Swaps out the interface calls are passed on to. nullptr to use vr::VROverlay(). Also clears all cached state
+        void SetOverlayInterface(vr::IVROverlay* overlay_interface);
+        //Clears cached state of overlays not owned by this process. Enables keeping that state during a frame when called once per frame, otherwise it's not kept at all
+        void BeginFrame();
+        //Clears all cached state, e.g. after OpenVR was shut down
+        void Reset();
+
+        Stats GetStats() const;
+        void ResetStats();
+
+        //- IVROverlay functions
+        vr::EVROverlayError FindOverlay(const char* overlay_key, vr::VROverlayHandle_t* overlay_handle);
+        vr::EVROverlayError CreateOverlay(const char* overlay_key, const char* overlay_name, vr::VROverlayHandle_t* overlay_handle);   //Overlay is treated as owned
+        vr::EVROverlayError DestroyOverlay(vr::VROverlayHandle_t overlay_handle);
+
+        vr::EVROverlayError ShowOverlay(vr::VROverlayHandle_t overlay_handle);
+        vr::EVROverlayError HideOverlay(vr::VROverlayHandle_t overlay_handle);
+        bool IsOverlayVisible(vr::VROverlayHandle_t overlay_handle);
+
+        vr::EVROverlayError SetOverlayAlpha(vr::VROverlayHandle_t overlay_handle, float alpha);
+        vr::EVROverlayError GetOverlayAlpha(vr::VROverlayHandle_t overlay_handle, float* alpha);
+        vr::EVROverlayError SetOverlayColor(vr::VROverlayHandle_t overlay_handle, float red, float green, float blue);
+        vr::EVROverlayError GetOverlayColor(vr::VROverlayHandle_t overlay_handle, float* red, float* green, float* blue);
+        vr::EVROverlayError SetOverlayWidthInMeters(vr::VROverlayHandle_t overlay_handle, float width_in_meters);
+        vr::EVROverlayError GetOverlayWidthInMeters(vr::VROverlayHandle_t overlay_handle, float* width_in_meters);
+
+        vr::EVROverlayError SetOverlayTransformAbsolute(vr::VROverlayHandle_t overlay_handle, vr::ETrackingUniverseOrigin tracking_origin, const vr::HmdMatrix34_t* matrix);
+        vr::EVROverlayError GetOverlayTransformAbsolute(vr::VROverlayHandle_t overlay_handle, vr::ETrackingUniverseOrigin* tracking_origin, vr::HmdMatrix34_t* matrix);
+        vr::EVROverlayError SetOverlayTransformTrackedDeviceRelative(vr::VROverlayHandle_t overlay_handle, vr::TrackedDeviceIndex_t device_index, const vr::HmdMatrix34_t* matrix);
+        vr::EVROverlayError SetOverlayTransformCursor(vr::VROverlayHandle_t overlay_handle, const vr::HmdVector2_t* hotspot);
+
+        vr::EVROverlayError SetOverlayFlag(vr::VROverlayHandle_t overlay_handle, vr::VROverlayFlags flag, bool enabled);
+        vr::EVROverlayError GetOverlayFlag(vr::VROverlayHandle_t overlay_handle, vr::VROverlayFlags flag, bool* enabled);
+        vr::EVROverlayError SetOverlayInputMethod(vr::VROverlayHandle_t overlay_handle, vr::VROverlayInputMethod input_method);
+        vr::EVROverlayError GetOverlayInputMethod(vr::VROverlayHandle_t overlay_handle, vr::VROverlayInputMethod* input_method);
+        vr::EVROverlayError SetOverlaySortOrder(vr::VROverlayHandle_t overlay_handle, uint32_t sort_order);
+        vr::EVROverlayError GetOverlaySortOrder(vr::VROverlayHandle_t overlay_handle, uint32_t* sort_order);
+        vr::EVROverlayError SetOverlayTextureBounds(vr::VROverlayHandle_t overlay_handle, const vr::VRTextureBounds_t* texture_bounds);
+        vr::EVROverlayError GetOverlayTextureBounds(vr::VROverlayHandle_t overlay_handle, vr::VRTextureBounds_t* texture_bounds);
+
+        //Also updates cached state from overlay shown/hidden events
+        bool PollNextOverlayEvent(vr::VROverlayHandle_t overlay_handle, vr::VREvent_t* vr_event, uint32_t vr_event_size);
+};
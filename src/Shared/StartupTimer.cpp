@@ -0,0 +1,91 @@
+#include "StartupTimer.h"
+
+#include <chrono>
+#include <cstdio>
+
+static long long StartupTimerGetTimeNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+StartupTimer::StartupTimer()
+{
+    m_StartTimeNs = StartupTimerGetTimeNs();
+}
+
+double StartupTimer::GetElapsedMs() const
+{
+    return (StartupTimerGetTimeNs() - m_StartTimeNs) / 1000000.0;
+}
+
+void StartupTimer::BeginStage(const char* name)
+{
+    if (m_IsStageActive)
+    {
+        EndStage();
+    }
+
+    m_Stages.emplace_back();
+    m_Stages.back().Name    = name;
+    m_Stages.back().StartMs = GetElapsedMs();
+
+    m_IsStageActive = true;
+}
+
+void StartupTimer::EndStage()
+{
+    if (!m_IsStageActive)
+        return;
+
+    Stage& stage = m_Stages.back();
+    stage.DurationMs = GetElapsedMs() - stage.StartMs;
+
+    m_IsStageActive = false;
+}
+
+double StartupTimer::GetTotalMs() const
+{
+    //Only the last stage can still be in progress
+    const size_t finished_count = m_Stages.size() - ((m_IsStageActive) ? 1 : 0);
+
+    if (finished_count == 0)
+        return 0.0;
+
+    const Stage& stage = m_Stages[finished_count - 1];
+    return stage.StartMs + stage.DurationMs;
+}
+
+std::string StartupTimer::GetReportJSON() const
+{
+    char buffer[64];
+    std::string report = "{\"total_ms\":";
+
+    snprintf(buffer, sizeof(buffer), "%.3f", GetTotalMs());
+    report += buffer;
+    report += ",\"stages\":[";
+
+    for (size_t i = 0; i < m_Stages.size(); ++i)
+    {
+        const Stage& stage = m_Stages[i];
+
+        //Names are plain identifiers set in code, so they don't need escaping
+        report += (i == 0) ? "{\"name\":\"" : ",{\"name\":\"";
+        report += stage.Name;
+
+        //Stage still in progress doesn't have a duration yet
+        if ( (m_IsStageActive) && (i + 1 == m_Stages.size()) )
+        {
+            snprintf(buffer, sizeof(buffer), "\",\"start_ms\":%.3f,\"duration_ms\":null}", stage.StartMs);
+        }
+        else
+        {
+            snprintf(buffer, sizeof(buffer), "\",\"start_ms\":%.3f,\"duration_ms\":%.3f}", stage.StartMs, stage.DurationMs);
+        }
+
+        report += buffer;
+    }
+
+    report += "]}";
+
+    return report;
+}
@@ -0,0 +1,34 @@
+//Records wall times of the start-up stages of the Desktop+ processes, which can be retrieved as a JSON string for the log
+//Stages run one after another on the calling thread. Timing starts when the StartupTimer is constructed.
+//This file doesn't depend on any platform headers.
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+class StartupTimer
+{
+    private:
+        struct Stage
+        {
+            std::string Name;
+            double StartMs    = 0.0;                //Relative to construction of the StartupTimer
+            double DurationMs = 0.0;
+        };
+
+        std::vector<Stage> m_Stages;
+        long long m_StartTimeNs = 0;
+        bool m_IsStageActive = false;
+
+        double GetElapsedMs() const;
+
+    public:
+        StartupTimer();
+
+        void BeginStage(const char* name);          //Ends the current stage first if there is one
+        void EndStage();
+
+        double GetTotalMs() const;                  //End of the last finished stage
+        std::string GetReportJSON() const;
+};
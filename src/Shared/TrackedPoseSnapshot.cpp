@@ -0,0 +1,241 @@
+#include "TrackedPoseSnapshot.h"
+
+#include <cstring>
+
+#include "OpenVRExt.h"
+#include "OverlayStateMirror.h"
+
+static TrackedPoseSnapshot g_TrackedPoseSnapshot;
+
+TrackedPoseSnapshot::PoseSet& TrackedPoseSnapshot::GetPoseSet(vr::ETrackingUniverseOrigin universe, bool predicted)
+{
+    PoseSet& pose_set = m_PoseSets[(universe == vr::TrackingUniverseSeated) ? 1 : 0][(predicted) ? 1 : 0];
+
+    if (!pose_set.IsValid)
+    {
+        if ( (predicted) && (!m_IsPredictionTimeValid) )
+        {
+            m_PredictionTime = vr::IVRSystemEx::GetTimeNowToPhotons();
+            m_IsPredictionTimeValid = true;
+        }
+
+        vr::VRSystem()->GetDeviceToAbsoluteTrackingPose(universe, (predicted) ? m_PredictionTime : 0.0f, pose_set.Poses, vr::k_unMaxTrackedDeviceCount);
+        pose_set.IsValid = true;
+    }
+
+    return pose_set;
+}
+
+const TrackedPoseSnapshot::SystemOverlayHandles& TrackedPoseSnapshot::GetSystemOverlayHandles()
+{
+    if (!m_IsSystemOverlayHandlesValid)
+    {
+        m_SystemOverlayHandles = SystemOverlayHandles();
+
+        OverlayStateMirror::Get().FindOverlay("valve.steam.gamepadui.bar",         &m_SystemOverlayHandles.GamepadUI);
+        OverlayStateMirror::Get().FindOverlay("system.systemui",                   &m_SystemOverlayHandles.SystemUI);
+        OverlayStateMirror::Get().FindOverlay("elvissteinjr.DesktopPlusDashboard", &m_SystemOverlayHandles.DPlusDashboard);
+
+        m_IsSystemOverlayHandlesValid = true;
+    }
+
+    return m_SystemOverlayHandles;
+}
+
+TrackedPoseSnapshot& TrackedPoseSnapshot::Get()
+{
+    return g_TrackedPoseSnapshot;
+}
+
+void TrackedPoseSnapshot::Invalidate()
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    for (auto& pose_sets_universe : m_PoseSets)
+    {
+        for (auto& pose_set : pose_sets_universe)
+        {
+            pose_set.IsValid = pose_set.IsInjected;
+        }
+    }
+
+    m_IsPredictionTimeValid          = false;
+    m_IsSeatedZeroPoseValid          = m_IsSeatedZeroPoseInjected;
+    m_IsHMDFloorMatrixValid[0]       = false;
+    m_IsHMDFloorMatrixValid[1]       = false;
+    m_IsDPlusDashboardTabMatrixValid = false;
+    m_IsSystemOverlayHandlesValid    = m_IsSystemOverlayHandlesInjected;
+}
+
+vr::TrackedDevicePose_t TrackedPoseSnapshot::GetPose(vr::TrackedDeviceIndex_t device_index, vr::ETrackingUniverseOrigin universe, bool predicted)
+{
+    if (device_index >= vr::k_unMaxTrackedDeviceCount)
+    {
+        vr::TrackedDevicePose_t pose_invalid = {0};
+        return pose_invalid;
+    }
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return GetPoseSet(universe, predicted).Poses[device_index];
+}
+
+void TrackedPoseSnapshot::GetPoses(vr::TrackedDevicePose_t* poses_out, vr::ETrackingUniverseOrigin universe, bool predicted)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    memcpy(poses_out, GetPoseSet(universe, predicted).Poses, sizeof(vr::TrackedDevicePose_t) * vr::k_unMaxTrackedDeviceCount);
+}
+
+float TrackedPoseSnapshot::GetPredictionTime()
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    if (!m_IsPredictionTimeValid)
+    {
+        m_PredictionTime = vr::IVRSystemEx::GetTimeNowToPhotons();
+        m_IsPredictionTimeValid = true;
+    }
+
+    return m_PredictionTime;
+}
+
+Matrix4 TrackedPoseSnapshot::GetSeatedZeroPoseMatrix()
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    if (!m_IsSeatedZeroPoseValid)
+    {
+        m_SeatedZeroPose = vr::VRSystem()->GetSeatedZeroPoseToStandingAbsoluteTrackingPose();
+        m_IsSeatedZeroPoseValid = true;
+    }
+
+    return m_SeatedZeroPose;
+}
+
+Matrix4 TrackedPoseSnapshot::GetHMDFloorMatrix(bool use_turning)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    const int matrix_index = (use_turning) ? 1 : 0;
+
+    if (!m_IsHMDFloorMatrixValid[matrix_index])
+    {
+        Matrix4 matrix;     //Identity
+        const vr::TrackedDevicePose_t& pose_hmd = GetPoseSet(vr::TrackingUniverseStanding, true).Poses[vr::k_unTrackedDeviceIndex_Hmd];
+
+        if (pose_hmd.bPoseIsValid)
+        {
+            Matrix4 mat_pose = pose_hmd.mDeviceToAbsoluteTracking;
+            Vector3 pos_offset = mat_pose.getTranslation();
+
+            //Force HMD pose upright to have it act as turning-only base position
+            if (use_turning)
+            {
+                matrix = mat_pose;
+                vr::IVRSystemEx::TransformForceUpright(matrix);
+            }
+
+            pos_offset.y = 0.0f;
+            matrix.setTranslation(pos_offset);
+        }
+
+        m_HMDFloorMatrix[matrix_index] = matrix;
+        m_IsHMDFloorMatrixValid[matrix_index] = true;
+    }
+
+    return m_HMDFloorMatrix[matrix_index];
+}
+
+Matrix4 TrackedPoseSnapshot::GetDPlusDashboardTabMatrix(bool& is_valid_out)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    const vr::VROverlayHandle_t ovrl_handle_dplus = GetSystemOverlayHandles().DPlusDashboard;
+    is_valid_out = (ovrl_handle_dplus != vr::k_ulOverlayHandleInvalid);
+
+    if (!is_valid_out)
+        return Matrix4();
+
+    if (!m_IsDPlusDashboardTabMatrixValid)
+    {
+        vr::HmdMatrix34_t matrix_dplus_tab;
+        vr::VROverlay()->GetTransformForOverlayCoordinates(ovrl_handle_dplus, vr::TrackingUniverseStanding, {0.5f, 0.0f}, &matrix_dplus_tab);
+
+        m_DPlusDashboardTabMatrix = matrix_dplus_tab;
+        m_IsDPlusDashboardTabMatrixValid = true;
+    }
+
+    return m_DPlusDashboardTabMatrix;
+}
+
+vr::VROverlayHandle_t TrackedPoseSnapshot::GetGamepadUIOverlayHandle()
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return GetSystemOverlayHandles().GamepadUI;
+}
+
+vr::VROverlayHandle_t TrackedPoseSnapshot::GetSystemUIOverlayHandle()
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return GetSystemOverlayHandles().SystemUI;
+}
+
+vr::VROverlayHandle_t TrackedPoseSnapshot::GetDPlusDashboardOverlayHandle()
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return GetSystemOverlayHandles().DPlusDashboard;
+}
+
+void TrackedPoseSnapshot::InjectPoses(const vr::TrackedDevicePose_t* poses, vr::ETrackingUniverseOrigin universe, bool predicted)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    PoseSet& pose_set = m_PoseSets[(universe == vr::TrackingUniverseSeated) ? 1 : 0][(predicted) ? 1 : 0];
+    memcpy(pose_set.Poses, poses, sizeof(vr::TrackedDevicePose_t) * vr::k_unMaxTrackedDeviceCount);
+    pose_set.IsValid    = true;
+    pose_set.IsInjected = true;
+
+    //Derived values need to be computed from the injected poses
+    m_IsHMDFloorMatrixValid[0] = false;
+    m_IsHMDFloorMatrixValid[1] = false;
+}
+
+void TrackedPoseSnapshot::InjectSeatedZeroPoseMatrix(const Matrix4& matrix)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    m_SeatedZeroPose           = matrix;
+    m_IsSeatedZeroPoseValid    = true;
+    m_IsSeatedZeroPoseInjected = true;
+}
+
+void TrackedPoseSnapshot::InjectSystemOverlayHandles(vr::VROverlayHandle_t gamepad_ui, vr::VROverlayHandle_t system_ui, vr::VROverlayHandle_t dplus_dashboard)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    m_SystemOverlayHandles.GamepadUI      = gamepad_ui;
+    m_SystemOverlayHandles.SystemUI       = system_ui;
+    m_SystemOverlayHandles.DPlusDashboard = dplus_dashboard;
+    m_IsSystemOverlayHandlesValid    = true;
+    m_IsSystemOverlayHandlesInjected = true;
+    m_IsDPlusDashboardTabMatrixValid = false;
+}
+
+void TrackedPoseSnapshot::ClearInjected()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+
+        for (auto& pose_sets_universe : m_PoseSets)
+        {
+            for (auto& pose_set : pose_sets_universe)
+            {
+                pose_set.IsInjected = false;
+            }
+        }
+
+        m_IsSeatedZeroPoseInjected       = false;
+        m_IsSystemOverlayHandlesInjected = false;
+    }
+
+    Invalidate();
+}
@@ -0,0 +1,77 @@
+//Per-frame snapshot of tracked device poses and other tracking-related state that is otherwise queried from OpenVR again and again in a single frame
+//Everything is sampled lazily on first access after Invalidate(), which is called once per main loop iteration, so all users in the same frame get the same values.
+//Values can be injected to run the users' math without an OpenVR runtime. Injected values stay until ClearInjected() is called.
+//Interface is thread-safe, values are returned as copies
+
+#pragma once
+
+#include <mutex>
+
+#include "openvr.h"
+#include "Matrices.h"
+
+class TrackedPoseSnapshot
+{
+    private:
+        struct PoseSet
+        {
+            bool IsValid    = false;
+            bool IsInjected = false;
+            vr::TrackedDevicePose_t Poses[vr::k_unMaxTrackedDeviceCount];
+        };
+
+        struct SystemOverlayHandles
+        {
+            vr::VROverlayHandle_t GamepadUI      = vr::k_ulOverlayHandleInvalid;   //"valve.steam.gamepadui.bar", only exists with the SteamVR 2 dashboard
+            vr::VROverlayHandle_t SystemUI       = vr::k_ulOverlayHandleInvalid;   //"system.systemui"
+            vr::VROverlayHandle_t DPlusDashboard = vr::k_ulOverlayHandleInvalid;   //"elvissteinjr.DesktopPlusDashboard"
+        };
+
+        mutable std::mutex m_Mutex;
+
+        //- Protected by m_Mutex
+        PoseSet m_PoseSets[2][2];                   //[Standing, Seated][Unpredicted, Predicted]
+        float m_PredictionTime = 0.0f;
+        bool m_IsPredictionTimeValid = false;
+
+        Matrix4 m_SeatedZeroPose;
+        bool m_IsSeatedZeroPoseValid    = false;
+        bool m_IsSeatedZeroPoseInjected = false;
+
+        Matrix4 m_HMDFloorMatrix[2];                //[Position only, Turning]
+        bool m_IsHMDFloorMatrixValid[2] = {false, false};
+
+        Matrix4 m_DPlusDashboardTabMatrix;
+        bool m_IsDPlusDashboardTabMatrixValid = false;
+
+        SystemOverlayHandles m_SystemOverlayHandles;
+        bool m_IsSystemOverlayHandlesValid    = false;
+        bool m_IsSystemOverlayHandlesInjected = false;
+
+        PoseSet& GetPoseSet(vr::ETrackingUniverseOrigin universe, bool predicted);    //Samples the set if needed, m_Mutex must be locked
+        const SystemOverlayHandles& GetSystemOverlayHandles();                       //Looks up handles if needed, m_Mutex must be locked
+
+    public:
+        static TrackedPoseSnapshot& Get();
+
+        void Invalidate();                          //Marks everything not injected to be sampled again on next access. Called once per frame
+
+        //Predicted poses use the time to photons sampled once per snapshot, unpredicted poses use the current time
+        vr::TrackedDevicePose_t GetPose(vr::TrackedDeviceIndex_t device_index, vr::ETrackingUniverseOrigin universe = vr::TrackingUniverseStanding, bool predicted = true);
+        void GetPoses(vr::TrackedDevicePose_t* poses_out, vr::ETrackingUniverseOrigin universe = vr::TrackingUniverseStanding, bool predicted = true); //poses_out has to be of k_unMaxTrackedDeviceCount size
+        float GetPredictionTime();
+
+        Matrix4 GetSeatedZeroPoseMatrix();                          //Seated zero pose to standing absolute tracking pose
+        Matrix4 GetHMDFloorMatrix(bool use_turning);                //HMD position on the floor, optionally with upright HMD rotation. Identity if HMD pose is invalid
+        Matrix4 GetDPlusDashboardTabMatrix(bool& is_valid_out);     //Transform of the top center of the Desktop+ dashboard tab. Invalid if the overlay doesn't exist
+
+        vr::VROverlayHandle_t GetGamepadUIOverlayHandle();
+        vr::VROverlayHandle_t GetSystemUIOverlayHandle();
+        vr::VROverlayHandle_t GetDPlusDashboardOverlayHandle();
+
+        //Injection of synthetic values, used instead of querying OpenVR until ClearInjected() is called
+        void InjectPoses(const vr::TrackedDevicePose_t* poses, vr::ETrackingUniverseOrigin universe = vr::TrackingUniverseStanding, bool predicted = true);
+        void InjectSeatedZeroPoseMatrix(const Matrix4& matrix);
+        void InjectSystemOverlayHandles(vr::VROverlayHandle_t gamepad_ui, vr::VROverlayHandle_t system_ui, vr::VROverlayHandle_t dplus_dashboard);
+        void ClearInjected();
+};
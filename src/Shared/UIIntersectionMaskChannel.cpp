@@ -0,0 +1,162 @@
+#include "UIIntersectionMaskChannel.h"
+
+#include <cstring>
+#include <new>
+#include <algorithm>
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "Generation counters need to be lock-free to be shared between processes");
+
+size_t UIIntersectionMaskChannel::GetRequiredMemorySize()
+{
+    return sizeof(UIMaskChannelHeader);
+}
+
+uint64_t UIIntersectionMaskChannel::ComputeHash(const uint64_t* packed_rects, size_t count)
+{
+    //FNV-1a over the packed values
+    uint64_t hash = 14695981039346656037ULL;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        hash ^= packed_rects[i];
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+void UIIntersectionMaskChannel::Init(void* memory)
+{
+    m_Header = new (memory) UIMaskChannelHeader;
+
+    m_Header->Magic   = k_UIMaskChannelMagic;
+    m_Header->Version = k_UIMaskChannelVersion;
+
+    for (auto& buffer : m_Header->Buffers)
+    {
+        buffer.Generation.store(0, std::memory_order_relaxed);
+        buffer.RectCount = 0;
+        buffer.Padding   = 0;
+    }
+
+    m_Header->Generation.store(0, std::memory_order_release);
+
+    m_HasPublished       = false;
+    m_LastReadGeneration = 0;
+}
+
+bool UIIntersectionMaskChannel::Attach(void* memory, size_t memory_size)
+{
+    m_Header = nullptr;
+
+    if ( (memory == nullptr) || (memory_size < GetRequiredMemorySize()) )
+        return false;
+
+    UIMaskChannelHeader* header = (UIMaskChannelHeader*)memory;
+
+    if ( (header->Magic != k_UIMaskChannelMagic) || (header->Version != k_UIMaskChannelVersion) )
+        return false;
+
+    m_Header = header;
+
+    m_HasPublished       = false;
+    m_LastReadGeneration = 0;
+
+    return true;
+}
+
+void UIIntersectionMaskChannel::Detach()
+{
+    m_Header = nullptr;
+}
+
+bool UIIntersectionMaskChannel::IsValid() const
+{
+    return (m_Header != nullptr);
+}
+
+bool UIIntersectionMaskChannel::Publish(const std::vector<DPRect>& rects)
+{
+    if (m_Header == nullptr)
+        return false;
+
+    const size_t rect_count = std::min(rects.size(), (size_t)k_UIMaskChannelMaxRects);
+
+    m_PackedRects.resize(rect_count);
+    for (size_t i = 0; i < rect_count; ++i)
+    {
+        m_PackedRects[i] = rects[i].Pack16();
+    }
+
+    //Hash is only a quick way out for the common case of a changed mask, same hash still needs a full compare
+    const uint64_t hash = ComputeHash(m_PackedRects.data(), m_PackedRects.size());
+
+    if ( (m_HasPublished) && (hash == m_LastPublishedHash) && (m_PackedRects == m_LastPublishedRects) )
+        return false;
+
+    const uint64_t generation = m_Header->Generation.load(std::memory_order_relaxed) + 1;
+    UIMaskChannelBuffer& buffer = m_Header->Buffers[generation % 2];
+
+    //Mark buffer as being written before touching the data, readers of the previous generation in this buffer will notice and retry
+    buffer.Generation.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    buffer.RectCount = (uint32_t)rect_count;
+    if (rect_count != 0)
+    {
+        memcpy(buffer.Rects, m_PackedRects.data(), rect_count * sizeof(uint64_t));
+    }
+
+    buffer.Generation.store(generation, std::memory_order_release);
+    m_Header->Generation.store(generation, std::memory_order_release);
+
+    m_LastPublishedRects.swap(m_PackedRects);
+    m_LastPublishedHash = hash;
+    m_HasPublished = true;
+
+    return true;
+}
+
+bool UIIntersectionMaskChannel::ReadIfChanged(std::vector<DPRect>& rects)
+{
+    if (m_Header == nullptr)
+        return false;
+
+    //The writer only publishes once per frame, so running into it more than a few times in a row means something is off. Try again next time then
+    for (int attempt = 0; attempt < 4; ++attempt)
+    {
+        const uint64_t generation = m_Header->Generation.load(std::memory_order_acquire);
+
+        if (generation == m_LastReadGeneration)
+            return false;
+
+        const UIMaskChannelBuffer& buffer = m_Header->Buffers[generation % 2];
+
+        if (buffer.Generation.load(std::memory_order_acquire) != generation)
+            continue;
+
+        const uint32_t rect_count = std::min(buffer.RectCount, k_UIMaskChannelMaxRects);
+        m_PackedRects.resize(rect_count);
+
+        if (rect_count != 0)
+        {
+            memcpy(m_PackedRects.data(), buffer.Rects, rect_count * sizeof(uint64_t));
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if (buffer.Generation.load(std::memory_order_relaxed) != generation)
+            continue;
+
+        rects.resize(rect_count);
+        for (uint32_t i = 0; i < rect_count; ++i)
+        {
+            rects[i].Unpack16(m_PackedRects[i]);
+        }
+
+        m_LastReadGeneration = generation;
+        return true;
+    }
+
+    return false;
+}
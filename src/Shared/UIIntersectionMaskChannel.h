@@ -0,0 +1,63 @@
+//Shared memory channel for the UI's laser pointer intersection mask, published by the UI process and read by the dashboard process
+//The mask is double-buffered with a generation counter. The UI publishes every frame, but only writes a new generation when the rects actually changed,
+//and the dashboard only has to check the counter each frame to pick up changes without any per-rect messages.
+//Buffers use a sequence check like a seqlock, so a reader never sees a partially written mask and just tries again on the next frame if it got unlucky.
+//This file doesn't depend on any platform headers. The shared memory itself is handled by UIManager and LaserPointer.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <atomic>
+
+#include "DPRect.h"
+
+static const uint32_t k_UIMaskChannelMagic    = 0x4B534D55;     //"UMSK"
+static const uint32_t k_UIMaskChannelVersion  = 1;
+static const uint32_t k_UIMaskChannelMaxRects = 512;            //Rects past this are dropped. The UI has a handful of windows at most, so this is never reached in practice
+
+struct UIMaskChannelBuffer
+{
+    std::atomic<uint64_t> Generation;               //Generation of the mask in this buffer, 0 while being written
+    uint32_t RectCount;
+    uint32_t Padding;
+    uint64_t Rects[k_UIMaskChannelMaxRects];        //Packed with DPRect::Pack16()
+};
+
+struct UIMaskChannelHeader
+{
+    uint32_t Magic;
+    uint32_t Version;
+    std::atomic<uint64_t> Generation;               //Latest published generation, 0 if nothing was published yet. Buffer in use is Generation % 2
+    UIMaskChannelBuffer Buffers[2];
+};
+
+class UIIntersectionMaskChannel
+{
+    private:
+        UIMaskChannelHeader* m_Header = nullptr;
+
+        //Writer state
+        std::vector<uint64_t> m_PackedRects;
+        std::vector<uint64_t> m_LastPublishedRects;
+        uint64_t m_LastPublishedHash = 0;
+        bool m_HasPublished = false;
+
+        //Reader state
+        uint64_t m_LastReadGeneration = 0;
+
+    public:
+        static size_t GetRequiredMemorySize();
+        static uint64_t ComputeHash(const uint64_t* packed_rects, size_t count);
+
+        void Init(void* memory);                    //Called by the writer when it created the memory, resets the channel
+        bool Attach(void* memory, size_t memory_size);  //Validates the header of existing memory. Writers continue with the stored generation
+        void Detach();
+        bool IsValid() const;
+
+        //Returns true if a new generation was published, false if the rects are the same as last time
+        bool Publish(const std::vector<DPRect>& rects);
+        //Returns true if rects were set from a generation that hasn't been read yet
+        bool ReadIfChanged(std::vector<DPRect>& rects);
+};
@@ -497,6 +497,24 @@ bool WStringCompareNatural(std::wstring& str1, std::wstring& str2)
                               str1.c_str(), (int)str1.size(), str2.c_str(), (int)str2.size(), nullptr, nullptr, 0) == CSTR_LESS_THAN);
 }
 
+std::string WStringGetSortKeyNatural(const std::wstring& str)
+{
+    const DWORD flags = LCMAP_SORTKEY | LINGUISTIC_IGNORECASE | SORT_DIGITSASNUMBERS;
+    std::string sort_key;
+
+    //Size includes the terminating null byte, which is left out of the returned string
+    int key_size = ::LCMapStringEx(LOCALE_NAME_USER_DEFAULT, flags, str.c_str(), (int)str.size(), nullptr, 0, nullptr, nullptr, 0);
+
+    if (key_size > 0)
+    {
+        sort_key.resize(key_size);
+        key_size = ::LCMapStringEx(LOCALE_NAME_USER_DEFAULT, flags, str.c_str(), (int)str.size(), (LPWSTR)&sort_key[0], key_size, nullptr, nullptr, 0);
+        sort_key.resize((key_size > 0) ? key_size - 1 : 0);
+    }
+
+    return sort_key;
+}
+
 //This ain't pretty, but GetKeyNameText() works with scancodes, which are not exactly the same and the output strings aren't that nice either (and always localized)
 //Should this be translatable?
 const char* g_VK_name[256] = 
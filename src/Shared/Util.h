@@ -74,6 +74,7 @@ void WStringReplaceAll(std::wstring& source, const std::wstring& from, const std
 bool IsWCharInvalidForFileName(wchar_t wchar);
 void SanitizeFileNameWString(std::wstring& str);
 bool WStringCompareNatural(std::wstring& str1, std::wstring& str2);
+std::string WStringGetSortKeyNatural(const std::wstring& str);   //Byte-wise comparison of the keys sorts like WStringCompareNatural() without the per-comparison cost
 
 //Virtual Keycode string mapping
 const char* GetStringForKeyCode(unsigned char keycode);
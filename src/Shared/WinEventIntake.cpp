@@ -0,0 +1,156 @@
+#include "WinEventIntake.h"
+
+#include <algorithm>
+
+std::vector<WinEventHookRange> WinEventPlanHookRanges(std::vector<uint32_t> event_ids)
+{
+    std::vector<WinEventHookRange> ranges;
+
+    std::sort(event_ids.begin(), event_ids.end());
+    event_ids.erase(std::unique(event_ids.begin(), event_ids.end()), event_ids.end());
+
+    for (uint32_t event_id : event_ids)
+    {
+        if ( (!ranges.empty()) && (ranges.back().EventMax + 1 == event_id) )
+        {
+            ranges.back().EventMax = event_id;
+        }
+        else
+        {
+            WinEventHookRange range;
+            range.EventMin = event_id;
+            range.EventMax = event_id;
+            ranges.push_back(range);
+        }
+    }
+
+    return ranges;
+}
+
+unsigned int WinEventCoalescer::MergeFlags(unsigned int pending_flags, unsigned int new_flags)
+{
+    //Hidden windows are removed from the list, so nothing else matters for them until they're shown again
+    if (new_flags & wineventupd_hidden)
+        return wineventupd_hidden;
+
+    if (new_flags & wineventupd_shown)
+        return (pending_flags & ~wineventupd_hidden) | new_flags;
+
+    //Title change of a window about to be hidden doesn't matter
+    if (pending_flags & wineventupd_hidden)
+        return pending_flags;
+
+    return pending_flags | new_flags;
+}
+
+void WinEventCoalescer::SetInterval(uint64_t interval_ms)
+{
+    m_IntervalMs = interval_ms;
+}
+
+uint64_t WinEventCoalescer::GetInterval() const
+{
+    return m_IntervalMs;
+}
+
+unsigned int WinEventCoalescer::Push(uint64_t window_id, unsigned int update_flags, uint64_t time_ms)
+{
+    if (update_flags == wineventupd_none)
+        return wineventupd_none;
+
+    auto it = m_Windows.find(window_id);
+
+    //Quiet window, pass through
+    if ( (it == m_Windows.end()) || ((it->second.PendingFlags == wineventupd_none) && (it->second.LastOutTime + m_IntervalMs <= time_ms)) )
+    {
+        m_Windows[window_id].LastOutTime = time_ms;
+        return update_flags;
+    }
+
+    WindowState& state = it->second;
+
+    if (state.PendingFlags == wineventupd_none)
+    {
+        m_PendingCount++;
+    }
+
+    state.PendingFlags = MergeFlags(state.PendingFlags, update_flags);
+
+    return wineventupd_none;
+}
+
+void WinEventCoalescer::Remove(uint64_t window_id)
+{
+    auto it = m_Windows.find(window_id);
+
+    if (it != m_Windows.end())
+    {
+        if (it->second.PendingFlags != wineventupd_none)
+        {
+            m_PendingCount--;
+        }
+
+        m_Windows.erase(it);
+    }
+}
+
+void WinEventCoalescer::Clear()
+{
+    m_Windows.clear();
+    m_PendingCount = 0;
+}
+
+void WinEventCoalescer::PopDue(uint64_t time_ms, std::vector<Update>& updates_out)
+{
+    for (auto it = m_Windows.begin(); it != m_Windows.end();)
+    {
+        WindowState& state = it->second;
+
+        if (state.LastOutTime + m_IntervalMs <= time_ms)
+        {
+            if (state.PendingFlags != wineventupd_none)
+            {
+                updates_out.push_back({it->first, state.PendingFlags});
+
+                state.PendingFlags = wineventupd_none;
+                state.LastOutTime  = time_ms;
+                m_PendingCount--;
+            }
+            else
+            {
+                it = m_Windows.erase(it);
+                continue;
+            }
+        }
+
+        ++it;
+    }
+}
+
+bool WinEventCoalescer::HasPending() const
+{
+    return (m_PendingCount != 0);
+}
+
+bool WinEventCoalescer::IsEmpty() const
+{
+    return m_Windows.empty();
+}
+
+uint64_t WinEventCoalescer::GetNextDueTime() const
+{
+    uint64_t due_time = UINT64_MAX;
+
+    if (m_PendingCount == 0)
+        return due_time;
+
+    for (const auto& window : m_Windows)
+    {
+        if (window.second.PendingFlags != wineventupd_none)
+        {
+            due_time = std::min(due_time, window.second.LastOutTime + m_IntervalMs);
+        }
+    }
+
+    return due_time;
+}
@@ -0,0 +1,71 @@
+//Helpers for keeping the WindowManager thread's win event intake small
+//WinEventPlanHookRanges() turns the set of event IDs that are actually handled into as few non-overlapping hook ranges as possible without including any other events,
+//so no event is delivered twice and unrelated high-frequency events (value, selection, reorder...) aren't delivered at all.
+//WinEventCoalescer throttles per-window updates derived from title and show/hide events. The first update of a window is passed through right away,
+//further ones within the interval are merged and handed out once the interval has passed. Events that must not be delayed (focus, destroy) aren't meant to go through it.
+//This file doesn't depend on any platform headers.
+
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+struct WinEventHookRange
+{
+    uint32_t EventMin = 0;
+    uint32_t EventMax = 0;
+
+    bool operator==(const WinEventHookRange& b) const { return ((EventMin == b.EventMin) && (EventMax == b.EventMax)); }
+    bool operator!=(const WinEventHookRange& b) const { return !(*this == b); }
+};
+
+//Returns sorted ranges covering exactly the given event IDs. Duplicate IDs are fine
+std::vector<WinEventHookRange> WinEventPlanHookRanges(std::vector<uint32_t> event_ids);
+
+enum WinEventUpdateFlags
+{
+    wineventupd_none   = 0,
+    wineventupd_shown  = 1 << 0,
+    wineventupd_title  = 1 << 1,
+    wineventupd_hidden = 1 << 2                     //Replaces any other pending update, shown and hidden are never set together
+};
+
+class WinEventCoalescer
+{
+    public:
+        struct Update
+        {
+            uint64_t WindowID;
+            unsigned int Flags;                     //WinEventUpdateFlags
+        };
+
+    private:
+        struct WindowState
+        {
+            uint64_t LastOutTime = 0;
+            unsigned int PendingFlags = wineventupd_none;
+        };
+
+        std::unordered_map<uint64_t, WindowState> m_Windows;
+        uint64_t m_IntervalMs = 250;
+        unsigned int m_PendingCount = 0;            //Windows with PendingFlags != wineventupd_none
+
+        static unsigned int MergeFlags(unsigned int pending_flags, unsigned int new_flags);
+
+    public:
+        void SetInterval(uint64_t interval_ms);
+        uint64_t GetInterval() const;
+
+        //Returns flags to handle right away or wineventupd_none if the update was merged into a pending one
+        unsigned int Push(uint64_t window_id, unsigned int update_flags, uint64_t time_ms);
+        //Drops pending updates and history of the window, e.g. when it was destroyed
+        void Remove(uint64_t window_id);
+        void Clear();
+
+        //Appends pending updates that are due and forgets about windows that have been quiet for a full interval
+        void PopDue(uint64_t time_ms, std::vector<Update>& updates_out);
+        bool HasPending() const;
+        bool IsEmpty() const;                       //True if no windows are tracked, pending or not
+        uint64_t GetNextDueTime() const;            //Returns UINT64_MAX if nothing is pending
+};
@@ -10,11 +10,97 @@
 #include "ConfigManager.h"
 #include "InterprocessMessaging.h"
 #include "Util.h"
+#include "WindowMetadataResolver.h"
 
 #ifndef DPLUS_UI
     #include "InputSimulator.h"
 #endif
 
+//Win32 side of WindowMetadataResolver
+class WindowMetadataPlatformWin32 : public WindowMetadataPlatform
+{
+    public:
+        virtual uint32_t GetWindowProcessID(uint64_t window_id) override
+        {
+            DWORD process_id = 0;
+            ::GetWindowThreadProcessId((HWND)window_id, &process_id);
+
+            return process_id;
+        }
+
+        virtual uint64_t OpenProcess(uint32_t process_id) override
+        {
+            //Least access permissions needed so we can get elevated process names too
+            return (uint64_t)::OpenProcess(PROCESS_QUERY_LIMITED_INFORMATION, FALSE, process_id);
+        }
+
+        virtual void CloseProcess(uint64_t process_handle) override
+        {
+            ::CloseHandle((HANDLE)process_handle);
+        }
+
+        virtual bool IsProcessRunning(uint64_t process_handle) override
+        {
+            DWORD exit_code = 0;
+            return ( (::GetExitCodeProcess((HANDLE)process_handle, &exit_code)) && (exit_code == STILL_ACTIVE) );
+        }
+
+        virtual std::string GetProcessExeName(uint64_t process_handle) override
+        {
+            std::string exe_name;
+            WCHAR exe_buffer[MAX_PATH];
+
+            //GetProcessImageFileNameW has more info than we need, but works with PROCESS_QUERY_LIMITED_INFORMATION
+            if (::GetProcessImageFileNameW((HANDLE)process_handle, exe_buffer, MAX_PATH) != 0)
+            {
+                exe_name = StringConvertFromUTF16(exe_buffer);
+
+                //Cut off the path we're not interested in
+                std::size_t pos = exe_name.find_last_of("\\");
+                if ((pos != std::string::npos) && (pos + 1 < exe_name.length())) //String should be well-formed, but let's be careful
+                {
+                    exe_name = exe_name.substr(pos + 1);
+                }
+            }
+
+            return exe_name;
+        }
+
+        virtual IconResult GetWindowIcon(uint64_t window_id, unsigned int timeout_ms, uint64_t& icon_out) override
+        {
+            //Plain SendMessage() would block forever on a hung window. SMTO_ABORTIFHUNG returns right away for windows already considered hung, the timeout covers the rest
+            DWORD_PTR result = 0;
+
+            if (::SendMessageTimeoutW((HWND)window_id, WM_GETICON, ICON_BIG, 0, SMTO_ABORTIFHUNG, timeout_ms, &result) == 0)
+            {
+                return (::GetLastError() == ERROR_TIMEOUT) ? icon_result_timeout : icon_result_failed;
+            }
+
+            icon_out = (uint64_t)result;
+            return icon_result_ok;
+        }
+
+        virtual uint64_t GetFallbackIcon(uint64_t window_id) override
+        {
+            HICON icon_handle = (HICON)::GetClassLongPtr((HWND)window_id, GCLP_HICON);
+
+            if (icon_handle == nullptr)
+            {
+                icon_handle = ::LoadIcon(nullptr, IDI_APPLICATION);
+            }
+
+            return (uint64_t)icon_handle;
+        }
+
+        virtual uint64_t GetTimeMs() override
+        {
+            return ::GetTickCount64();
+        }
+};
+
+static WindowMetadataPlatformWin32 g_WindowMetadataPlatformWin32;
+static WindowMetadataResolver g_WindowMetadataResolver(g_WindowMetadataPlatformWin32);  //Shared by the WindowManager thread and the main thread, so metadata is only resolved once per process
+
 WindowManager g_WindowManager;
 
 bool inline MatchTitleAndClassName(WindowInfo const& window, std::wstring const& title, std::wstring const& className)
@@ -93,7 +179,6 @@ bool IsCapturableWindow(WindowInfo const& window)
 WindowInfo::WindowInfo(HWND window_handle)
 {
     m_WindowHandle = window_handle;
-    m_Icon = nullptr;
 
     if (m_WindowHandle == nullptr)
     {
@@ -125,7 +210,7 @@ WindowInfo::WindowInfo(HWND window_handle)
 
 HICON WindowInfo::GetIcon() const
 {
-    return (m_Icon == nullptr) ? m_Icon = GetIcon(m_WindowHandle) : m_Icon;
+    return GetIcon(m_WindowHandle);
 }
 
 const std::wstring& WindowInfo::GetTitle() const
@@ -191,34 +276,10 @@ bool WindowInfo::UpdateWindowTitle()
 
 std::string WindowInfo::GetExeName(HWND window_handle)
 {
-    std::string exe_name;
-
     if (window_handle == nullptr)
-        return exe_name;
-
-    DWORD proc_id;
-    ::GetWindowThreadProcessId(window_handle, &proc_id);
-    HANDLE proc_handle = ::OpenProcess(PROCESS_QUERY_LIMITED_INFORMATION, FALSE, proc_id);
-    if (proc_handle)
-    {
-        WCHAR exe_buffer[MAX_PATH];
-        //GetProcessImageFileNameW has more info than we need, but takes the least access permissions so we can get elevated process names through it
-        if (::GetProcessImageFileNameW(proc_handle, exe_buffer, MAX_PATH) != 0)
-        {
-            exe_name = StringConvertFromUTF16(exe_buffer);
+        return "";
 
-            //Cut off the path we're not interested in
-            std::size_t pos = exe_name.find_last_of("\\");
-            if ((pos != std::string::npos) && (pos + 1 < exe_name.length())) //String should be well-formed, but let's be careful
-            {
-                exe_name = exe_name.substr(pos + 1);
-            }
-        }
-
-        ::CloseHandle(proc_handle);
-    }
-
-    return exe_name;
+    return g_WindowMetadataResolver.GetExeName((uint64_t)window_handle);
 }
 
 HWND WindowInfo::GetWindowHandle() const
@@ -228,20 +289,12 @@ HWND WindowInfo::GetWindowHandle() const
 
 HICON WindowInfo::GetIcon(HWND window_handle)
 {
-    HICON icon_handle = nullptr;
-    icon_handle = (HICON)::SendMessage(window_handle, WM_GETICON, ICON_BIG, 0);
-
-    if (icon_handle == nullptr)
-    {
-        icon_handle = (HICON)::GetClassLongPtr(window_handle, GCLP_HICON);
-    }
-
-    if (icon_handle == nullptr)
-    {
-        icon_handle = ::LoadIcon(nullptr, IDI_APPLICATION);
-    }
+    return (HICON)g_WindowMetadataResolver.GetIcon((uint64_t)window_handle);
+}
 
-    return icon_handle;
+bool WindowInfo::IsIconFinal(HWND window_handle)
+{
+    return g_WindowMetadataResolver.IsIconFinal((uint64_t)window_handle);
 }
 
 HWND WindowInfo::FindClosestWindowForTitle(const std::string& title_str, const std::string& class_str, const std::string& exe_str, const std::vector<WindowInfo>& window_list,
@@ -424,6 +477,7 @@ const WindowInfo& WindowManager::WindowListAdd(HWND window)
     if (it == m_WindowList.end())
     {
         m_WindowList.emplace_back(window);
+        m_WindowListRevision++;
         return m_WindowList.back();
     }
 
@@ -440,6 +494,7 @@ std::wstring WindowManager::WindowListRemove(HWND window)
     {
         last_title = it->GetTitle();
         m_WindowList.erase(it);
+        m_WindowListRevision++;
     }
 
     return last_title;
@@ -453,6 +508,9 @@ WindowInfo const* WindowManager::WindowListUpdateTitle(HWND window, bool* has_ti
     {
         bool title_changed = it->UpdateWindowTitle();
 
+        if (title_changed)
+            m_WindowListRevision++;
+
         if (has_title_changed != nullptr)
             *has_title_changed = title_changed;
 
@@ -489,6 +547,16 @@ WindowInfo const* WindowManager::WindowListFindWindow(HWND window) const
     return nullptr;
 }
 
+unsigned int WindowManager::WindowListGetRevision() const
+{
+    return m_WindowListRevision;
+}
+
+unsigned int WindowManager::WindowListGetIconGeneration() const
+{
+    return g_WindowMetadataResolver.GetIconGeneration();
+}
+
 bool WindowManager::IsTextInputFocused()
 {
     //Wait for the text input focused state to be stable for before reporting any changes
@@ -729,6 +797,7 @@ bool WindowManager::IsHoveringCapturableTitleBar(HWND window, int cursor_x, int
 void WindowManager::WindowListInit()
 {
     m_WindowList.clear();
+    m_WindowListRevision++;
 
     EnumWindows([](HWND hwnd, LPARAM lParam)
                 {
@@ -747,6 +816,13 @@ void WindowManager::WindowListInit()
                     return TRUE;
                 },
                 (LPARAM)&m_WindowList);
+
+    #ifdef DPLUS_UI
+        for (const WindowInfo& window : m_WindowList)
+        {
+            g_WindowMetadataResolver.PrefetchIcon((uint64_t)window.GetWindowHandle());
+        }
+    #endif
 }
 
 void WindowManager::HandleWinEvent(DWORD win_event, HWND hwnd, LONG id_object, LONG id_child, DWORD event_thread, DWORD event_time)
@@ -759,51 +835,35 @@ void WindowManager::HandleWinEvent(DWORD win_event, HWND hwnd, LONG id_object, L
         }
     #endif
 
+    //Everything else is about windows themselves. Reject events for other objects before doing any Win32 calls, cursor location changes and such end up here a lot
+    if ( (win_event != EVENT_SYSTEM_FOREGROUND) && ((hwnd == nullptr) || (id_object != OBJID_WINDOW) || (id_child != CHILDID_SELF)) )
+        return;
+
     switch (win_event)
     {
         case EVENT_OBJECT_DESTROY:
+        {
+            //Never delayed, also drops pending updates for the window
+            m_ThreadWinListUpdateCoalescer.Remove((uint64_t)hwnd);
+            g_WindowMetadataResolver.RemoveWindow((uint64_t)hwnd);
+            SendWinListUpdate(hwnd, wineventupd_hidden);
+            return;
+        }
         case EVENT_OBJECT_HIDE:
         case EVENT_OBJECT_CLOAKED:
         {
-            if ( (id_object == OBJID_WINDOW) && (id_child == CHILDID_SELF) && (hwnd != nullptr) )
-            {
-                #ifdef DPLUS_UI
-                    IPCManager::Get().PostMessageToUIApp(ipcmsg_action, ipcact_winmanager_winlist_remove, (LPARAM)hwnd);
-                #else
-                    IPCManager::Get().PostMessageToDashboardApp(ipcmsg_action, ipcact_winmanager_winlist_remove, (LPARAM)hwnd);
-                #endif
-            }
+            PushWinListUpdate(hwnd, wineventupd_hidden);
             return;
         }
         case EVENT_OBJECT_SHOW:
         case EVENT_OBJECT_UNCLOAKED:
         {
-            if ( (id_object == OBJID_WINDOW) && (id_child == CHILDID_SELF) && (hwnd != nullptr) && (GetAncestor(hwnd, GA_ROOT) == hwnd) && (GetWindowTextLengthW(hwnd) > 0) )
-            {
-                WindowInfo info(hwnd);
-
-                if (IsCapturableWindow(info))
-                {
-                    #ifdef DPLUS_UI
-                        IPCManager::Get().PostMessageToUIApp(ipcmsg_action, ipcact_winmanager_winlist_add, (LPARAM)hwnd);
-                    #else
-                        IPCManager::Get().PostMessageToDashboardApp(ipcmsg_action, ipcact_winmanager_winlist_add, (LPARAM)hwnd);
-                    #endif
-                }
-            }
+            PushWinListUpdate(hwnd, wineventupd_shown);
             return;
         }
         case EVENT_OBJECT_NAMECHANGE:
         {
-            if ( (id_object == OBJID_WINDOW) && (id_child == CHILDID_SELF) && (hwnd != nullptr) && (::GetAncestor(hwnd, GA_ROOT) == hwnd) && (::GetWindowTextLengthW(hwnd) > 0) )
-            {
-                //We don't bother checking if the window is capturable here. Windows that were created with an empty title may get late added from this (which then checks).
-                #ifdef DPLUS_UI
-                    IPCManager::Get().PostMessageToUIApp(ipcmsg_action, ipcact_winmanager_winlist_update, (LPARAM)hwnd);
-                #else
-                    IPCManager::Get().PostMessageToDashboardApp(ipcmsg_action, ipcact_winmanager_winlist_update, (LPARAM)hwnd);
-                #endif
-            }
+            PushWinListUpdate(hwnd, wineventupd_title);
             return;
         }
 
@@ -834,9 +894,12 @@ void WindowManager::HandleWinEvent(DWORD win_event, HWND hwnd, LONG id_object, L
         case EVENT_OBJECT_LOCATIONCHANGE:
         case EVENT_SYSTEM_MOVESIZEEND:
         {
+            //Location changes are only of interest for the target and dragged window. Checked first since they're sent for every window moving on screen
+            if ( (win_event == EVENT_OBJECT_LOCATIONCHANGE) && (hwnd != m_DragWindow) && (hwnd != m_ThreadLocalData.TargetWindow) )
+                return;
+
             //Limit to visible top-level windows
-            if ( (hwnd == nullptr) || (id_object != OBJID_WINDOW) || (id_child != CHILDID_SELF) || (GetWindowTextLength(hwnd) == 0) || 
-                 (!::IsWindowVisible(hwnd)) || (::GetAncestor(hwnd, GA_ROOT) != hwnd) )
+            if ( (GetWindowTextLength(hwnd) == 0) || (!::IsWindowVisible(hwnd)) || (::GetAncestor(hwnd, GA_ROOT) != hwnd) )
             {
                 return;
             }
@@ -1026,33 +1089,117 @@ void WindowManager::HandleTextInputMouseClick()
     m_ThreadTextInputFocusClickTick = ::GetTickCount64();
 }
 
-void WindowManager::WindowManager::WinEventProc(HWINEVENTHOOK /*event_hook_handle*/, DWORD win_event, HWND hwnd, LONG id_object, LONG id_child, DWORD event_thread, DWORD event_time)
+void WindowManager::PushWinListUpdate(HWND hwnd, unsigned int update_flags)
 {
-    Get().HandleWinEvent(win_event, hwnd, id_object, id_child, event_thread, event_time);
+    const unsigned int flags_now = m_ThreadWinListUpdateCoalescer.Push((uint64_t)hwnd, update_flags, ::GetTickCount64());
+
+    if (flags_now != wineventupd_none)
+    {
+        SendWinListUpdate(hwnd, flags_now);
+    }
+
+    //Timer keeps running while the coalescer tracks any windows, see FlushWinListUpdates()
+    if (m_ThreadWinListUpdateTimerID == 0)
+    {
+        m_ThreadWinListUpdateTimerID = ::SetTimer(nullptr, 0, (UINT)m_ThreadWinListUpdateCoalescer.GetInterval(), nullptr);
+    }
 }
 
-void WindowManager::ManageEventHooks(HWINEVENTHOOK& hook_handle_move_size, HWINEVENTHOOK& hook_handle_location_change, HWINEVENTHOOK& hook_handle_foreground, HWINEVENTHOOK& hook_handle_destroy_show,
-                                     HWINEVENTHOOK& hook_handle_caret)
+void WindowManager::SendWinListUpdate(HWND hwnd, unsigned int update_flags)
 {
-    #ifndef DPLUS_UI
+    //Only top-level windows with a title are of interest. Checked here instead of on every event so coalesced updates only check once
+    if ( (update_flags & (wineventupd_shown | wineventupd_title)) && ((::GetAncestor(hwnd, GA_ROOT) != hwnd) || (::GetWindowTextLengthW(hwnd) == 0)) )
+        return;
+
+    if (update_flags & wineventupd_shown)
+    {
+        WindowInfo info(hwnd);
+
+        if (IsCapturableWindow(info))
+        {
+            #ifdef DPLUS_UI
+                //Get the icon ready before the window list is drawn with it
+                g_WindowMetadataResolver.PrefetchIcon((uint64_t)hwnd);
+
+                IPCManager::Get().PostMessageToUIApp(ipcmsg_action, ipcact_winmanager_winlist_add, (LPARAM)hwnd);
+            #else
+                IPCManager::Get().PostMessageToDashboardApp(ipcmsg_action, ipcact_winmanager_winlist_add, (LPARAM)hwnd);
+            #endif
+        }
+    }
 
-    if ( (m_ThreadLocalData.BlockDrag) && (hook_handle_move_size == nullptr) )
+    if (update_flags & wineventupd_title)
     {
-        hook_handle_move_size       = ::SetWinEventHook(EVENT_SYSTEM_MOVESIZESTART, EVENT_SYSTEM_MOVESIZEEND, nullptr, WindowManager::WinEventProc, 0, 0, 
-                                                        WINEVENT_OUTOFCONTEXT | WINEVENT_SKIPOWNPROCESS);
-        hook_handle_location_change = ::SetWinEventHook(EVENT_OBJECT_LOCATIONCHANGE, EVENT_OBJECT_LOCATIONCHANGE, nullptr, WindowManager::WinEventProc, 0, 0,
-                                                        WINEVENT_OUTOFCONTEXT | WINEVENT_SKIPOWNPROCESS);
+        //We don't bother checking if the window is capturable here. Windows that were created with an empty title may get late added from this (which then checks).
+        #ifdef DPLUS_UI
+            IPCManager::Get().PostMessageToUIApp(ipcmsg_action, ipcact_winmanager_winlist_update, (LPARAM)hwnd);
+        #else
+            IPCManager::Get().PostMessageToDashboardApp(ipcmsg_action, ipcact_winmanager_winlist_update, (LPARAM)hwnd);
+        #endif
     }
-    else if ( (!m_ThreadLocalData.BlockDrag) && (hook_handle_move_size != nullptr) )
+
+    if (update_flags & wineventupd_hidden)
     {
-        UnhookWinEvent(hook_handle_move_size);
-        UnhookWinEvent(hook_handle_location_change);
+        #ifdef DPLUS_UI
+            IPCManager::Get().PostMessageToUIApp(ipcmsg_action, ipcact_winmanager_winlist_remove, (LPARAM)hwnd);
+        #else
+            IPCManager::Get().PostMessageToDashboardApp(ipcmsg_action, ipcact_winmanager_winlist_remove, (LPARAM)hwnd);
+        #endif
+    }
+}
 
-        hook_handle_move_size       = nullptr;
-        hook_handle_location_change = nullptr;
+void WindowManager::FlushWinListUpdates()
+{
+    const ULONGLONG tick = ::GetTickCount64();
+
+    std::vector<WinEventCoalescer::Update> updates;
+    m_ThreadWinListUpdateCoalescer.PopDue(tick, updates);
+
+    for (const WinEventCoalescer::Update& update : updates)
+    {
+        SendWinListUpdate((HWND)update.WindowID, update.Flags);
     }
 
-    if (hook_handle_foreground == nullptr)
+    //Windows are forgotten after being quiet for an interval, so the timer stops once things calm down
+    if (m_ThreadWinListUpdateCoalescer.IsEmpty())
+    {
+        ::KillTimer(nullptr, m_ThreadWinListUpdateTimerID);
+        m_ThreadWinListUpdateTimerID = 0;
+    }
+    else
+    {
+        ULONGLONG delay = m_ThreadWinListUpdateCoalescer.GetInterval();
+
+        if (m_ThreadWinListUpdateCoalescer.HasPending())
+        {
+            const ULONGLONG due_tick = m_ThreadWinListUpdateCoalescer.GetNextDueTime();
+            delay = (due_tick > tick) ? due_tick - tick : USER_TIMER_MINIMUM;
+        }
+
+        m_ThreadWinListUpdateTimerID = ::SetTimer(nullptr, m_ThreadWinListUpdateTimerID, (UINT)delay, nullptr);
+    }
+}
+
+void WindowManager::WindowManager::WinEventProc(HWINEVENTHOOK /*event_hook_handle*/, DWORD win_event, HWND hwnd, LONG id_object, LONG id_child, DWORD event_thread, DWORD event_time)
+{
+    Get().HandleWinEvent(win_event, hwnd, id_object, id_child, event_thread, event_time);
+}
+
+void WindowManager::ManageEventHooks()
+{
+    std::vector<uint32_t> event_ids = {EVENT_OBJECT_DESTROY, EVENT_OBJECT_SHOW, EVENT_OBJECT_HIDE, EVENT_OBJECT_NAMECHANGE, EVENT_OBJECT_CLOAKED, EVENT_OBJECT_UNCLOAKED};
+
+    #ifndef DPLUS_UI
+
+    //Foreground and caret events for text input focus tracking. Location changes are also used for drag handling
+    event_ids.insert(event_ids.end(), {EVENT_SYSTEM_FOREGROUND, EVENT_OBJECT_CREATE, EVENT_OBJECT_LOCATIONCHANGE});
+
+    if (m_ThreadLocalData.BlockDrag)
+    {
+        event_ids.insert(event_ids.end(), {EVENT_SYSTEM_MOVESIZESTART, EVENT_SYSTEM_MOVESIZEEND});
+    }
+
+    if (m_ThreadEventHookRanges.empty())
     {
         //Set initial elevated process focus state beforehand
         DWORD process_id;
@@ -1061,23 +1208,35 @@ void WindowManager::ManageEventHooks(HWINEVENTHOOK& hook_handle_move_size, HWINE
 
         //Send process elevation state to UI
         IPCManager::Get().PostConfigMessageToUIApp(configid_bool_state_window_focused_process_elevated, IsProcessElevated(process_id));
-
-        hook_handle_foreground = ::SetWinEventHook(EVENT_SYSTEM_FOREGROUND, EVENT_SYSTEM_FOREGROUND, nullptr, WindowManager::WinEventProc, 0, 0, WINEVENT_OUTOFCONTEXT | WINEVENT_SKIPOWNPROCESS);
-    }
-
-    if (hook_handle_caret == nullptr)
-    {
-        hook_handle_caret = ::SetWinEventHook(EVENT_OBJECT_CREATE, EVENT_OBJECT_LOCATIONCHANGE, nullptr, WindowManager::WinEventProc, 0, 0, WINEVENT_OUTOFCONTEXT | WINEVENT_SKIPOWNPROCESS);
     }
 
     #endif
 
-    if (hook_handle_destroy_show == nullptr)
+    //Only hook ranges that changed so no events are missed for the others
+    std::vector<WinEventHookRange> ranges_new = WinEventPlanHookRanges(event_ids);
+    std::vector<HWINEVENTHOOK> hooks_new;
+
+    for (const WinEventHookRange& range : ranges_new)
     {
-        hook_handle_destroy_show = ::SetWinEventHook(EVENT_OBJECT_DESTROY, /*EVENT_OBJECT_SHOW*/EVENT_OBJECT_UNCLOAKED, nullptr, WindowManager::WinEventProc, 0, 0,
-                                                     WINEVENT_OUTOFCONTEXT | WINEVENT_SKIPOWNPROCESS);
+        auto it = std::find(m_ThreadEventHookRanges.begin(), m_ThreadEventHookRanges.end(), range);
+
+        if (it != m_ThreadEventHookRanges.end())
+        {
+            const size_t index = std::distance(m_ThreadEventHookRanges.begin(), it);
+            hooks_new.push_back(m_ThreadEventHooks[index]);
+            m_ThreadEventHooks[index] = nullptr;
+        }
+        else
+        {
+            hooks_new.push_back(::SetWinEventHook(range.EventMin, range.EventMax, nullptr, WindowManager::WinEventProc, 0, 0, WINEVENT_OUTOFCONTEXT | WINEVENT_SKIPOWNPROCESS));
+        }
     }
 
+    UnhookEventHooks();     //Remaining hooks are no longer needed
+
+    m_ThreadEventHookRanges = ranges_new;
+    m_ThreadEventHooks      = hooks_new;
+
     //Reset drag window state when target window is nullptr
     if (m_ThreadLocalData.TargetWindow == nullptr)
     {
@@ -1091,6 +1250,20 @@ void WindowManager::ManageEventHooks(HWINEVENTHOOK& hook_handle_move_size, HWINE
     }
 }
 
+void WindowManager::UnhookEventHooks()
+{
+    for (HWINEVENTHOOK hook_handle : m_ThreadEventHooks)
+    {
+        if (hook_handle != nullptr)
+        {
+            ::UnhookWinEvent(hook_handle);
+        }
+    }
+
+    m_ThreadEventHooks.clear();
+    m_ThreadEventHookRanges.clear();
+}
+
 DWORD WindowManager::WindowManagerThreadEntry(void* /*param*/)
 {
     //Copy thread data for lock-free reads later
@@ -1102,13 +1275,7 @@ DWORD WindowManager::WindowManagerThreadEntry(void* /*param*/)
     }
 
     //Create event hooks
-    HWINEVENTHOOK hook_handle_move_size       = nullptr;
-    HWINEVENTHOOK hook_handle_location_change = nullptr;
-    HWINEVENTHOOK hook_handle_foreground      = nullptr;
-    HWINEVENTHOOK hook_handle_destroy_show    = nullptr;
-    HWINEVENTHOOK hook_handle_caret           = nullptr;
-
-    Get().ManageEventHooks(hook_handle_move_size, hook_handle_location_change, hook_handle_foreground, hook_handle_destroy_show, hook_handle_caret);
+    Get().ManageEventHooks();
 
     //Wait for callbacks, update or quit message
     MSG msg;
@@ -1134,7 +1301,7 @@ DWORD WindowManager::WindowManagerThreadEntry(void* /*param*/)
                 wman.m_ThreadLocalData = wman.m_ThreadData;
             }
 
-            wman.ManageEventHooks(hook_handle_move_size, hook_handle_location_change, hook_handle_foreground, hook_handle_destroy_show, hook_handle_caret);
+            wman.ManageEventHooks();
 
             //Notify main thread we're done
             {
@@ -1147,13 +1314,24 @@ DWORD WindowManager::WindowManagerThreadEntry(void* /*param*/)
         {
             Get().HandleTextInputMouseClick();
         }
+        else if ( (msg.message == WM_TIMER) && (msg.hwnd == nullptr) && (msg.wParam == Get().m_ThreadWinListUpdateTimerID) )
+        {
+            Get().FlushWinListUpdates();
+        }
+    }
+
+    WindowManager& wman = Get();
+
+    wman.UnhookEventHooks();
+
+    //Pending updates are dropped, the window list is initialized again when the thread is started the next time
+    if (wman.m_ThreadWinListUpdateTimerID != 0)
+    {
+        ::KillTimer(nullptr, wman.m_ThreadWinListUpdateTimerID);
+        wman.m_ThreadWinListUpdateTimerID = 0;
     }
 
-    ::UnhookWinEvent(hook_handle_move_size);
-    ::UnhookWinEvent(hook_handle_location_change);
-    ::UnhookWinEvent(hook_handle_foreground);
-    ::UnhookWinEvent(hook_handle_destroy_show);
-    ::UnhookWinEvent(hook_handle_caret);
+    wman.m_ThreadWinListUpdateCoalescer.Clear();
 
     return 0;
 }
@@ -6,11 +6,12 @@
 #include <vector>
 #include <mutex>
 
+#include "WinEventIntake.h"
+
 class WindowInfo
 {
     private:
         HWND m_WindowHandle;
-        mutable HICON m_Icon;              //Is nullptr until requested by calling GetIcon() for the first time
         std::wstring m_Title;
         std::wstring m_ClassName;
         mutable std::string m_ExeName;     //Is empty until requested by calling GetExeName() for the first time
@@ -22,7 +23,7 @@ class WindowInfo
         bool operator!=(const WindowInfo& info) { return !(*this == info); }
 
         HWND GetWindowHandle() const;
-        HICON GetIcon() const;
+        HICON GetIcon() const;             //May be a fallback icon until the window's own icon is resolved
         const std::wstring& GetTitle() const;
         const std::wstring& GetWindowClassName() const;
         const std::string& GetExeName() const;
@@ -34,6 +35,7 @@ class WindowInfo
 
         static std::string GetExeName(HWND window_handle);
         static HICON GetIcon(HWND window_handle);
+        static bool IsIconFinal(HWND window_handle);    //False while GetIcon() returns a fallback icon that may still change
         static HWND FindClosestWindowForTitle(const std::string& title_str, const std::string& class_str, const std::string& exe_str, const std::vector<WindowInfo>& window_list, 
                                               bool use_strict_matching = false);
 };
@@ -83,6 +85,8 @@ class WindowManager
         WindowInfo const* WindowListUpdateTitle(HWND window, bool* has_title_changed = nullptr); //Returns pointer to updated window (may be nullptr)
         const std::vector<WindowInfo>& WindowListGet() const;
         WindowInfo const* WindowListFindWindow(HWND window) const;
+        unsigned int WindowListGetRevision() const;                                              //Changes whenever windows are added, removed or their titles change
+        unsigned int WindowListGetIconGeneration() const;                                        //Changes whenever a window's icon got resolved, which happens after it was added
 
         bool IsTextInputFocused();
         void UpdateTextInputFocusedState(bool new_state);                                        //Update main thread accessible state in response to message sent by WindowManager thread
@@ -111,6 +115,7 @@ class WindowManager
         HWND m_TempTopMostWindow        = nullptr;
 
         std::vector<WindowInfo> m_WindowList;
+        unsigned int m_WindowListRevision = 0;
 
         bool m_IsTextInputFocused                = false;
         bool m_IsTextInputFocusedPending         = false;
@@ -137,6 +142,12 @@ class WindowManager
         HWND m_ThreadTextInputFocusCaretWindow    = nullptr;
         ULONGLONG m_ThreadTextInputFocusClickTick = 0;
 
+        //    Win event intake
+        std::vector<HWINEVENTHOOK> m_ThreadEventHooks;
+        std::vector<WinEventHookRange> m_ThreadEventHookRanges;
+        WinEventCoalescer m_ThreadWinListUpdateCoalescer;    //Title and show/hide updates sent to the other process, keyed by HWND
+        UINT_PTR m_ThreadWinListUpdateTimerID = 0;
+
         //- Only called by main thread
         void WindowListInit();
 
@@ -144,10 +155,13 @@ class WindowManager
         void HandleWinEvent(DWORD win_event, HWND hwnd, LONG id_object, LONG id_child, DWORD event_thread, DWORD event_time);
         void HandleCaretWinEvent(DWORD win_event, HWND hwnd);
         void HandleTextInputMouseClick();
+        void PushWinListUpdate(HWND hwnd, unsigned int update_flags);                           //Passes update through WinEventCoalescer, sent right away or later from FlushWinListUpdates()
+        void SendWinListUpdate(HWND hwnd, unsigned int update_flags);
+        void FlushWinListUpdates();
 
         static void CALLBACK WinEventProc(HWINEVENTHOOK event_hook_handle, DWORD win_event, HWND hwnd, LONG id_object, LONG id_child, DWORD event_thread, DWORD event_time);
-        void ManageEventHooks(HWINEVENTHOOK& hook_handle_move_size, HWINEVENTHOOK& hook_handle_location_change, HWINEVENTHOOK& hook_handle_foreground, HWINEVENTHOOK& hook_handle_destroy_show,
-                              HWINEVENTHOOK& hook_handle_caret);
+        void ManageEventHooks();
+        void UnhookEventHooks();
 
         static DWORD WindowManagerThreadEntry(void* param);
 };
\ No newline at end of file
@@ -0,0 +1,276 @@
+#include "WindowMetadataResolver.h"
+
+static const uint64_t k_ProcessSweepInterval = 10000;
+
+WindowMetadataResolver::WindowMetadataResolver(WindowMetadataPlatform& platform) : m_Platform(platform)
+{
+}
+
+WindowMetadataResolver::~WindowMetadataResolver()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Shutdown = true;
+    }
+
+    m_IconQueueCV.notify_all();
+
+    if (m_Worker.joinable())
+    {
+        m_Worker.join();
+    }
+
+    for (const auto& process : m_Processes)
+    {
+        m_Platform.CloseProcess(process.second.ProcessHandle);
+    }
+}
+
+void WindowMetadataResolver::SweepExitedProcesses()
+{
+    for (auto it = m_Processes.begin(); it != m_Processes.end();)
+    {
+        if (!m_Platform.IsProcessRunning(it->second.ProcessHandle))
+        {
+            m_Platform.CloseProcess(it->second.ProcessHandle);
+            it = m_Processes.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+WindowMetadataResolver::IconEntry& WindowMetadataResolver::FindOrAddIconEntry(uint64_t window_id)
+{
+    auto it = m_Icons.find(window_id);
+
+    if (it == m_Icons.end())
+    {
+        it = m_Icons.emplace(window_id, IconEntry()).first;
+        it->second.Icon = m_Platform.GetFallbackIcon(window_id);
+    }
+
+    return it->second;
+}
+
+bool WindowMetadataResolver::IsIconRequestDue(const IconEntry& entry, uint64_t time_ms) const
+{
+    return ( (!entry.IsFinal) && (!entry.IsPending) && (entry.RetryTime <= time_ms) );
+}
+
+bool WindowMetadataResolver::QueueIconRequest(IconEntry& entry, uint64_t window_id)
+{
+    if (!IsIconRequestDue(entry, m_Platform.GetTimeMs()))
+        return false;
+
+    entry.IsPending = true;
+    m_IconQueue.push_back(window_id);
+
+    if (!m_Worker.joinable())
+    {
+        m_Worker = std::thread(&WindowMetadataResolver::WorkerLoop, this);
+    }
+
+    return true;
+}
+
+void WindowMetadataResolver::ResolveIcon(std::unique_lock<std::mutex>& lock, uint64_t window_id)
+{
+    //Window may have been removed while this was queued
+    if (m_Icons.find(window_id) == m_Icons.end())
+        return;
+
+    m_Stats.IconQueries++;
+
+    //The window is waited on without holding the lock so other windows can still be looked up
+    uint64_t icon = 0;
+
+    lock.unlock();
+    const WindowMetadataPlatform::IconResult result = m_Platform.GetWindowIcon(window_id, m_IconTimeoutMs, icon);
+    lock.lock();
+
+    auto it = m_Icons.find(window_id);
+    if (it == m_Icons.end())
+        return;
+
+    IconEntry& entry = it->second;
+    const uint64_t icon_prev = entry.Icon;
+    const bool is_final_prev = entry.IsFinal;
+    entry.IsPending = false;
+    entry.Attempts++;
+
+    switch (result)
+    {
+        case WindowMetadataPlatform::icon_result_ok:
+        {
+            //Keep the fallback if the window doesn't have an icon of its own
+            if (icon != 0)
+            {
+                entry.Icon = icon;
+            }
+
+            entry.IsFinal = true;
+            break;
+        }
+        case WindowMetadataPlatform::icon_result_timeout:
+        {
+            m_Stats.IconTimeouts++;
+
+            if (entry.Attempts >= m_IconAttemptsMax)
+            {
+                entry.IsFinal = true;
+            }
+            else
+            {
+                entry.RetryTime = m_Platform.GetTimeMs() + ((uint64_t)m_IconRetryDelayMs << (entry.Attempts - 1));
+            }
+            break;
+        }
+        case WindowMetadataPlatform::icon_result_failed:
+        {
+            entry.IsFinal = true;
+            break;
+        }
+    }
+
+    if ( (entry.Icon != icon_prev) || (entry.IsFinal != is_final_prev) )
+    {
+        m_IconGeneration++;
+    }
+}
+
+void WindowMetadataResolver::WorkerLoop()
+{
+    std::unique_lock<std::mutex> lock(m_Mutex);
+
+    for (;;)
+    {
+        m_IconQueueCV.wait(lock, [&]{ return ( (m_Shutdown) || (!m_IconQueue.empty()) ); });
+
+        if (m_Shutdown)
+            return;
+
+        const uint64_t window_id = m_IconQueue.front();
+        m_IconQueue.pop_front();
+
+        ResolveIcon(lock, window_id);
+    }
+}
+
+void WindowMetadataResolver::SetIconTimeout(unsigned int timeout_ms, unsigned int retry_delay_ms, unsigned int attempts_max)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    m_IconTimeoutMs    = timeout_ms;
+    m_IconRetryDelayMs = retry_delay_ms;
+    m_IconAttemptsMax  = attempts_max;
+}
+
+std::string WindowMetadataResolver::GetExeName(uint64_t window_id)
+{
+    const uint32_t process_id = m_Platform.GetWindowProcessID(window_id);
+
+    if (process_id == 0)
+        return "";
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    //No need to check if the process is still running on a hit. The open handle keeps the ID from being reused, so the window can only belong to the cached process
+    auto it = m_Processes.find(process_id);
+    if (it != m_Processes.end())
+    {
+        m_Stats.ExeCacheHits++;
+        return it->second.ExeName;
+    }
+
+    const uint64_t time_ms = m_Platform.GetTimeMs();
+    if (time_ms >= m_ProcessSweepTime + k_ProcessSweepInterval)
+    {
+        SweepExitedProcesses();
+        m_ProcessSweepTime = time_ms;
+    }
+
+    const uint64_t process_handle = m_Platform.OpenProcess(process_id);
+    if (process_handle == 0)
+        return "";
+
+    m_Stats.ExeQueries++;
+
+    ProcessEntry entry;
+    entry.ProcessHandle = process_handle;
+    entry.ExeName = m_Platform.GetProcessExeName(process_handle);
+
+    //Failures aren't cached so they're tried again next time
+    if (entry.ExeName.empty())
+    {
+        m_Platform.CloseProcess(process_handle);
+        return "";
+    }
+
+    m_Processes[process_id] = entry;
+
+    return entry.ExeName;
+}
+
+uint64_t WindowMetadataResolver::GetIcon(uint64_t window_id)
+{
+    uint64_t icon = 0;
+    bool is_queued = false;
+
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+
+        IconEntry& entry = FindOrAddIconEntry(window_id);
+        icon = entry.Icon;
+        is_queued = QueueIconRequest(entry, window_id);
+    }
+
+    if (is_queued)
+    {
+        m_IconQueueCV.notify_one();
+    }
+
+    return icon;
+}
+
+void WindowMetadataResolver::PrefetchIcon(uint64_t window_id)
+{
+    bool is_queued = false;
+
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        is_queued = QueueIconRequest(FindOrAddIconEntry(window_id), window_id);
+    }
+
+    if (is_queued)
+    {
+        m_IconQueueCV.notify_one();
+    }
+}
+
+bool WindowMetadataResolver::IsIconFinal(uint64_t window_id) const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    auto it = m_Icons.find(window_id);
+    return ( (it != m_Icons.end()) && (it->second.IsFinal) );
+}
+
+unsigned int WindowMetadataResolver::GetIconGeneration() const
+{
+    return m_IconGeneration;
+}
+
+void WindowMetadataResolver::RemoveWindow(uint64_t window_id)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Icons.erase(window_id);
+}
+
+WindowMetadataResolver::Stats WindowMetadataResolver::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_Stats;
+}
@@ -0,0 +1,113 @@
+//Resolves window metadata that is expensive or unsafe to query, i.e. process exe names and window icons
+//Exe names are cached per process. Cached processes are kept open, which keeps the process ID from being reused while the entry exists. Entries of processes that exited are dropped.
+//Icons are requested from the window on a worker thread, with a timeout so a hung application can't hold up the other windows. On timeout the fallback icon is kept and the request
+//is retried a few times with increasing delays. Icons can be prefetched so they're usually resolved before anyone asks for them. Callers never wait for an icon.
+//All platform calls go through WindowMetadataPlatform, which can be replaced to run this without real windows.
+//This file doesn't depend on any platform headers. Interface is thread-safe.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+class WindowMetadataPlatform
+{
+    public:
+        enum IconResult
+        {
+            icon_result_ok,                         //Icon may still be 0 if the window doesn't provide one
+            icon_result_timeout,
+            icon_result_failed
+        };
+
+        virtual ~WindowMetadataPlatform() {}
+
+        virtual uint32_t GetWindowProcessID(uint64_t window_id) = 0;                                     //Returns 0 if the window doesn't exist
+        virtual uint64_t OpenProcess(uint32_t process_id) = 0;                                           //Returns 0 on failure
+        virtual void CloseProcess(uint64_t process_handle) = 0;
+        virtual bool IsProcessRunning(uint64_t process_handle) = 0;
+        virtual std::string GetProcessExeName(uint64_t process_handle) = 0;                              //File name without path
+        virtual IconResult GetWindowIcon(uint64_t window_id, unsigned int timeout_ms, uint64_t& icon_out) = 0;
+        virtual uint64_t GetFallbackIcon(uint64_t window_id) = 0;                                        //Must not block
+        virtual uint64_t GetTimeMs() = 0;
+};
+
+class WindowMetadataResolver
+{
+    public:
+        struct Stats
+        {
+            unsigned long long ExeQueries   = 0;    //GetProcessExeName() calls
+            unsigned long long ExeCacheHits = 0;
+            unsigned long long IconQueries  = 0;    //GetWindowIcon() calls
+            unsigned long long IconTimeouts = 0;
+        };
+
+    private:
+        struct ProcessEntry
+        {
+            uint64_t ProcessHandle = 0;
+            std::string ExeName;
+        };
+
+        struct IconEntry
+        {
+            uint64_t Icon = 0;                      //Fallback icon until IsFinal is set
+            uint64_t RetryTime = 0;
+            unsigned int Attempts = 0;
+            bool IsFinal   = false;
+            bool IsPending = false;                 //Currently being resolved or queued for the worker thread
+        };
+
+        WindowMetadataPlatform& m_Platform;
+        unsigned int m_IconTimeoutMs = 100;
+        unsigned int m_IconRetryDelayMs = 1000;    //Doubled on every further retry
+        unsigned int m_IconAttemptsMax = 4;
+
+        //- Protected by m_Mutex
+        mutable std::mutex m_Mutex;
+        std::unordered_map<uint32_t, ProcessEntry> m_Processes;
+        std::unordered_map<uint64_t, IconEntry> m_Icons;
+        uint64_t m_ProcessSweepTime = 0;
+        Stats m_Stats;
+
+        std::atomic<unsigned int> m_IconGeneration{0};
+
+        std::deque<uint64_t> m_IconQueue;
+        std::condition_variable m_IconQueueCV;
+        std::thread m_Worker;                       //Only created once an icon is requested
+        bool m_Shutdown = false;
+
+        //- Called with m_Mutex locked
+        void SweepExitedProcesses();
+        IconEntry& FindOrAddIconEntry(uint64_t window_id);
+        bool IsIconRequestDue(const IconEntry& entry, uint64_t time_ms) const;
+        bool QueueIconRequest(IconEntry& entry, uint64_t window_id);               //Returns true if queued, the worker thread needs to be notified after unlocking then
+        void ResolveIcon(std::unique_lock<std::mutex>& lock, uint64_t window_id);  //Entry must be marked pending. Unlocks while waiting for the window
+
+        void WorkerLoop();
+
+    public:
+        WindowMetadataResolver(WindowMetadataPlatform& platform);
+        ~WindowMetadataResolver();
+
+        void SetIconTimeout(unsigned int timeout_ms, unsigned int retry_delay_ms, unsigned int attempts_max);
+
+        std::string GetExeName(uint64_t window_id);
+        //Returns a fallback icon while the window's icon isn't resolved yet. Queues it for the worker thread like PrefetchIcon() if it's neither pending nor waiting to be retried
+        uint64_t GetIcon(uint64_t window_id);
+        void PrefetchIcon(uint64_t window_id);
+        bool IsIconFinal(uint64_t window_id) const;
+        //Changes whenever an icon got final or different from what GetIcon() returned before, so callers can tell when icons they cached may be outdated
+        unsigned int GetIconGeneration() const;
+        //Forgets the window, e.g. when it was destroyed
+        void RemoveWindow(uint64_t window_id);
+
+        Stats GetStats() const;
+};